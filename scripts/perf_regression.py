@@ -0,0 +1,146 @@
+"""End-to-end performance regression check.
+
+Runs every AthenaPerf scenario in its own process, writes the merged results as JSON and compares
+them with a stored baseline. Exits with 1 if a metric is worse than the baseline by more than its
+tolerance, so the script can gate an upgrade.
+
+Usage (from the repository root, after a Release build):
+    python scripts/perf_regression.py --perf-bin build/AthenaPerf
+    python scripts/perf_regression.py --perf-bin build/AthenaPerf --update-baseline
+
+Baselines are machine specific: record one per machine (--update-baseline) before comparing.
+"""
+
+import argparse
+import json
+import os
+import platform
+import subprocess
+import sys
+import tempfile
+
+# Fixed workloads, the baseline is only meaningful if these do not change.
+SCENARIOS = {
+    "testnet": ["--scenario", "testnet", "--config", "testNet.bin", "--steps", "50000", "--submit-every", "10",
+                "--checkpoints", "20"],
+    "generated-10000": ["--scenario", "generated", "--operators", "10000", "--seed", "1", "--steps", "200"],
+    "generated-100000": ["--scenario", "generated", "--operators", "100000", "--seed", "1", "--steps", "50"],
+}
+
+# metric: (direction, default relative tolerance). "higher" = larger is better.
+METRICS = {
+    "stepsPerSecond": ("higher", 0.10),
+    "checkpointMBPerSecond": ("higher", 0.15),
+    "allocationsPerStep": ("lower", 0.02),
+    "allocatedBytesPerStep": ("lower", 0.05),
+    "peakRssKb": ("lower", 0.10),
+}
+
+# Workload descriptors that must match exactly, a difference means the comparison is not like for like.
+EXACT = ["operators", "executedSteps", "checkpointBytes"]
+
+
+def run_scenario(perf_bin, name, args):
+    with tempfile.TemporaryDirectory() as work_dir:
+        out_path = os.path.join(work_dir, "result.json")
+        full_args = [perf_bin] + [os.path.abspath(a) if a == "testNet.bin" else a for a in args]
+        completed = subprocess.run(full_args + ["--out", out_path], cwd=work_dir,
+                                   stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+        if completed.returncode != 0:
+            raise RuntimeError(f"scenario {name} failed ({completed.returncode}): {completed.stderr.strip()}")
+        with open(out_path) as f:
+            return json.load(f)
+
+
+def compare(results, baseline, tolerance_overrides):
+    """Returns a list of (scenario, metric, baseline, current, change, limit, ok) rows."""
+    rows = []
+    tolerances = dict(baseline.get("tolerances", {}))
+    tolerances.update(tolerance_overrides)
+    for name, current in results.items():
+        expected = baseline.get("scenarios", {}).get(name)
+        if expected is None:
+            rows.append((name, "(no baseline)", None, None, None, None, True))
+            continue
+        for key in EXACT:
+            if key in expected and expected[key] != current.get(key):
+                rows.append((name, key, expected[key], current.get(key), None, "exact", False))
+        for metric, (direction, default_tolerance) in METRICS.items():
+            if metric not in expected or metric not in current:
+                continue
+            base, value = float(expected[metric]), float(current[metric])
+            tolerance = float(tolerances.get(metric, default_tolerance))
+            change = (value - base) / base if base else 0.0
+            ok = change >= -tolerance if direction == "higher" else change <= tolerance
+            rows.append((name, metric, base, value, change, tolerance, ok))
+    return rows
+
+
+def print_rows(rows):
+    print(f"{'scenario':<18} {'metric':<22} {'baseline':>14} {'current':>14} {'change':>9}  result")
+    for name, metric, base, value, change, limit, ok in rows:
+        base_text = "-" if base is None else f"{base:.6g}" if isinstance(base, float) else str(base)
+        value_text = "-" if value is None else f"{value:.6g}" if isinstance(value, float) else str(value)
+        change_text = "-" if change is None else f"{change:+.1%}"
+        limit_text = "" if limit is None else f" (limit {limit:.0%})" if isinstance(limit, float) else f" ({limit})"
+        print(f"{name:<18} {metric:<22} {base_text:>14} {value_text:>14} {change_text:>9}  "
+              f"{'ok' if ok else 'REGRESSION'}{limit_text}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--perf-bin", default=os.path.join("build", "AthenaPerf"), help="AthenaPerf executable")
+    parser.add_argument("--baseline", default=os.path.join("tests", "perf", "baseline.json"))
+    parser.add_argument("--out", default="perf_results.json", help="where to write the merged results")
+    parser.add_argument("--scenario", action="append", choices=sorted(SCENARIOS), help="run only these (repeatable)")
+    parser.add_argument("--tolerance", action="append", default=[], metavar="METRIC=FRACTION",
+                        help="override a tolerance, e.g. stepsPerSecond=0.2")
+    parser.add_argument("--update-baseline", action="store_true", help="store the results as the new baseline")
+    args = parser.parse_args()
+
+    overrides = {}
+    for item in args.tolerance:
+        metric, _, fraction = item.partition("=")
+        if metric not in METRICS or not fraction:
+            parser.error(f"invalid tolerance '{item}'")
+        overrides[metric] = float(fraction)
+
+    results = {}
+    for name in args.scenario or SCENARIOS:
+        print(f"running {name} ...", flush=True)
+        results[name] = run_scenario(os.path.abspath(args.perf_bin), name, SCENARIOS[name])
+
+    with open(args.out, "w") as f:
+        json.dump({"scenarios": results}, f, indent=2)
+    print(f"results written to {args.out}")
+
+    if args.update_baseline:
+        baseline = {"machine": f"{platform.platform()}, {os.cpu_count()} CPUs",
+                    "tolerances": {metric: tolerance for metric, (_, tolerance) in METRICS.items()},
+                    "scenarios": results}
+        baseline["tolerances"].update(overrides)
+        with open(args.baseline, "w") as f:
+            json.dump(baseline, f, indent=2)
+            f.write("\n")
+        print(f"baseline updated: {args.baseline}")
+        return 0
+
+    if not os.path.exists(args.baseline):
+        print(f"no baseline at {args.baseline}, record one with --update-baseline")
+        return 1
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+
+    print(f"baseline recorded on: {baseline.get('machine', 'unknown')}")
+    rows = compare(results, baseline, overrides)
+    print_rows(rows)
+    regressions = [row for row in rows if not row[6]]
+    if regressions:
+        print(f"{len(regressions)} regression(s)")
+        return 1
+    print("no regressions")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,20 @@
+#include "headers/cli/BatchRunner.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The entry point of the headless batch runner (AthenaBatch).
+ * @details Parses the jobs from the command line and any `--script` files, then runs them in order
+ * without the interactive CLI. Exits with 0 if every job succeeded, 1 if one failed and 2 on
+ * invalid arguments.
+ */
+int main(int argc, char* argv[]) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+    BatchRunner runner(std::cerr);
+    if (args.empty() || !runner.parseArguments(args)) {
+        BatchRunner::printUsage(std::cerr);
+        return 2;
+    }
+    return runner.runAll();
+}
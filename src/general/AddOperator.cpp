@@ -120,17 +120,18 @@ void AddOperator::randomInit(IdRange* idRange, Randomizer* rng){
         return;
     }
 
-    for (int i = 0; i < connectionsToAttempt; ++i) {
-        uint32_t targetId = rng->getInt(idRange->getMinId(), idRange->getMaxId()); // TODO range is uint32 while method is int
+    // Draw all targets, then all distances, as two batches rather than two virtual calls per connection.
+    std::vector<int> targets(connectionsToAttempt);
+    std::vector<int> distances(connectionsToAttempt);
+    rng->fillInt(targets.data(), targets.size(), idRange->getMinId(), idRange->getMaxId()); // TODO range is uint32 while method is int
+    rng->fillInt(distances.data(), distances.size(), 0, AddOperator::MAX_DISTANCE - 1);
 
+    for (int i = 0; i < connectionsToAttempt; ++i) {
         // self-connection 
-        
 
-        int distance = rng->getInt(0, AddOperator::MAX_DISTANCE - 1);
         // Ensure distance is non-negative (should be by uniform_int_distribution if MAX_DISTANCE >= 0)
-        if (distance < 0) distance = 0;
-
-        addConnectionInternal(targetId, distance);
+        int distance = distances[i] < 0 ? 0 : distances[i];
+        addConnectionInternal(static_cast<uint32_t>(targets[i]), distance);
     }
 
 }
@@ -278,14 +279,13 @@ void AddOperator::processData() {
 
         // Threshold met, create and schedule a new payload if there are connections
         if (!outputConnections.empty()) {
-            // Create the new payload, starting its journey.
-            // The Payload constructor used here implies the new payload starts at distance 0 for its journey.
-            Payload newPayload(outputData, this->operatorId); // Using this->operatorId as the source/manager
-
-            // Schedule the new payload to start traveling in the *next* step
+            // Schedule the new payload to start traveling in the *next* step.
+            // The payload is constructed in place (distance 0, active) inside the next step's
+            // payload list, which TimeController pre-reserves, so no temporary or allocation here.
             try {
-                if (Scheduler::get()) { // Ensure scheduler is available
-                     Scheduler::get()->schedulePayloadForNextStep(newPayload);
+                Scheduler* scheduler = Scheduler::get(); // single lookup, get() locks the instance mutex
+                if (scheduler) { // Ensure scheduler is available
+                     scheduler->emplacePayloadForNextStep(outputData, this->operatorId); // Using this->operatorId as the source/manager
                 } else {
                     std::cerr << "AddOperator " << getId() << ": Scheduler instance is null. Cannot schedule payload." << std::endl;
                 }
@@ -380,7 +380,7 @@ void AddOperator::setThresholdInternal(int newThreshold) {
     this->threshold = newThreshold;
 }
 
-void AddOperator::changeParams(const std::vector<int>& params){
+void AddOperator::changeParams(const UpdateParams& params){
     if (params.size() < 2) {
         // TODO: Log error: Insufficient parameters
         return;
@@ -0,0 +1,258 @@
+#include "../headers/util/AsyncLogger.h"
+#include "../headers/util/Console.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+
+namespace {
+    constexpr auto WRITER_IDLE_WAIT = std::chrono::milliseconds(20);
+
+    size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+}
+
+AsyncLogger::AsyncLogger(size_t capacity) :
+    slots(roundUpToPowerOfTwo(capacity)),
+    mask(slots.size() - 1),
+    startNs(nowNs())
+{
+    for (size_t i = 0; i < slots.size(); ++i) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    ConsoleWriter(); // construct the console mutex first, so it outlives a static logger
+    writer = std::thread(&AsyncLogger::writerLoop, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_one();
+    if (writer.joinable()) {
+        writer.join();
+    }
+}
+
+AsyncLogger& AsyncLogger::get()
+{
+    static AsyncLogger instance;
+    return instance;
+}
+
+uint64_t AsyncLogger::nowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool AsyncLogger::admit(Level level)
+{
+    // Purpose: Level filter and rate limit, the only checks done before a record is queued.
+    // Parameters: @param level - the record's severity.
+    // Return: @return True if the record may be queued.
+    // Key Logic: Fixed one-second windows counted with relaxed atomics. The window reset may race
+    // between producers, which only makes the limit approximate.
+    if (!isEnabled(level) || level == Level::OFF) {
+        return false;
+    }
+    size_t limit = rateLimit.load(std::memory_order_relaxed);
+    if (limit == 0 || level == Level::ERROR) {
+        return true;
+    }
+    uint64_t second = nowNs() / 1000000000ULL;
+    uint64_t windowSecond = rateWindowSecond.load(std::memory_order_relaxed);
+    if (second != windowSecond && rateWindowSecond.compare_exchange_strong(windowSecond, second, std::memory_order_relaxed)) {
+        rateWindowCount.store(0, std::memory_order_relaxed);
+    }
+    if (rateWindowCount.fetch_add(1, std::memory_order_relaxed) >= limit) {
+        suppressedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+bool AsyncLogger::log(Level level, const char* event, std::initializer_list<LogField> fields, std::string_view text)
+{
+    // Purpose: Queue a record without blocking.
+    // Parameters: level, static event name, integer fields, optional text.
+    // Return: @return True if queued.
+    // Key Logic: Claim a slot by CAS on enqueuePos (a slot is free when its sequence equals the
+    // position), copy the record into it, then publish it by storing position + 1.
+    if (!admit(level)) {
+        return false;
+    }
+
+    size_t position = enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;) {
+        slot = &slots[position & mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0) {
+            if (enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed); // ring full, the writer is behind
+            return false;
+        } else {
+            position = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    LogRecord& record = slot->record;
+    record.level = level;
+    record.timestampNs = nowNs();
+    record.event = event;
+    record.fieldCount = 0;
+    for (const LogField& field : fields) {
+        if (record.fieldCount == MAX_FIELDS) break;
+        record.fields[record.fieldCount++] = field;
+    }
+    size_t textLength = std::min(text.size(), TEXT_CAPACITY - 1);
+    std::memcpy(record.text, text.data(), textLength);
+    record.text[textLength] = '\0';
+
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+size_t AsyncLogger::drainOnce(std::string& batch)
+{
+    // Purpose: [Writer thread] Format every published record into `batch`.
+    // Return: @return Number of records consumed.
+    size_t consumed = 0;
+    for (;;) {
+        Slot& slot = slots[dequeuePos & mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != dequeuePos + 1) {
+            break; // not published yet
+        }
+        appendFormatted(batch, slot.record);
+        slot.sequence.store(dequeuePos + slots.size(), std::memory_order_release); // free for the next lap
+        ++dequeuePos;
+        ++consumed;
+    }
+
+    uint64_t dropped = droppedCount.load(std::memory_order_relaxed);
+    uint64_t suppressed = suppressedCount.load(std::memory_order_relaxed);
+    if (dropped != reportedDropped || suppressed != reportedSuppressed) {
+        batch += "[WARN ] log.lost dropped=" + std::to_string(dropped - reportedDropped)
+               + " rate_limited=" + std::to_string(suppressed - reportedSuppressed) + "\n";
+        reportedDropped = dropped;
+        reportedSuppressed = suppressed;
+    }
+    consumedPos.store(dequeuePos, std::memory_order_release);
+    return consumed;
+}
+
+void AsyncLogger::appendFormatted(std::string& batch, const LogRecord& record) const
+{
+    char prefix[48];
+    double seconds = static_cast<double>(record.timestampNs - startNs) / 1e9;
+    std::snprintf(prefix, sizeof(prefix), "[%-5s] %.6fs ", levelName(record.level), seconds);
+    batch += prefix;
+    batch += record.event ? record.event : "log";
+    for (uint8_t i = 0; i < record.fieldCount; ++i) {
+        batch += ' ';
+        batch += record.fields[i].key;
+        batch += '=';
+        batch += std::to_string(record.fields[i].value);
+    }
+    if (record.text[0] != '\0') {
+        batch += " \"";
+        batch += record.text;
+        batch += '"';
+    }
+    batch += '\n';
+}
+
+void AsyncLogger::writeBatch(const std::string& batch)
+{
+    if (batch.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    if (sink) {
+        *sink << batch;
+        sink->flush();
+    } else {
+        ConsoleWriter() << batch << std::flush; // one console lock per batch
+    }
+}
+
+void AsyncLogger::writerLoop()
+{
+    // Purpose: Background thread, formats and writes queued records.
+    // Key Logic: Producers never notify (that would cost them a lock), the writer polls every
+    // WRITER_IDLE_WAIT and is woken early only by flush() and shutdown.
+    std::string batch;
+    for (;;) {
+        batch.clear();
+        drainOnce(batch);
+        writeBatch(batch);
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        if (flushRequested) {
+            flushRequested = false;
+            flushedCondition.notify_all();
+        }
+        if (stopping) {
+            lock.unlock();
+            batch.clear();
+            drainOnce(batch); // records queued during shutdown
+            writeBatch(batch);
+            return;
+        }
+        wakeCondition.wait_for(lock, WRITER_IDLE_WAIT, [this] { return stopping || flushRequested; });
+    }
+}
+
+void AsyncLogger::flush()
+{
+    size_t target = enqueuePos.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    while (consumedPos.load(std::memory_order_acquire) < target && !stopping) {
+        flushRequested = true;
+        wakeCondition.notify_one();
+        flushedCondition.wait_for(lock, WRITER_IDLE_WAIT);
+    }
+}
+
+void AsyncLogger::setSink(std::ostream* output)
+{
+    flush(); // earlier records go to the previous sink
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    sink = output;
+}
+
+bool AsyncLogger::parseLevel(const std::string& name, Level& level)
+{
+    if (name == "debug") { level = Level::DEBUG; return true; }
+    if (name == "info")  { level = Level::INFO;  return true; }
+    if (name == "warn")  { level = Level::WARN;  return true; }
+    if (name == "error") { level = Level::ERROR; return true; }
+    if (name == "off")   { level = Level::OFF;   return true; }
+    return false;
+}
+
+const char* AsyncLogger::levelName(Level level)
+{
+    switch (level) {
+        case Level::DEBUG: return "DEBUG";
+        case Level::INFO:  return "INFO";
+        case Level::WARN:  return "WARN";
+        case Level::ERROR: return "ERROR";
+        case Level::OFF:   return "OFF";
+    }
+    return "?";
+}
@@ -0,0 +1,419 @@
+#include "../headers/cli/BatchRunner.h"
+#include "../headers/Simulator.h"
+#include "../headers/util/PhiloxRandomSource.h"
+#include "../headers/util/AsyncLogger.h"
+#include "../headers/util/SampleCodec.h"
+#include "../headers/util/WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <thread>
+
+namespace {
+    // Values per subscription batch, also the reader's conversion buffer size
+    const size_t OUTPUT_BATCH = 4096;
+
+    /**
+     * @brief Stream buffer that discards everything written to it.
+     */
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+
+    /**
+     * @brief Discards std::cout output and the run log for its lifetime (a quiet job).
+     */
+    class ConsoleSilencer {
+    private:
+        NullBuffer nullBuffer;
+        std::streambuf* original = nullptr;
+        AsyncLogger::Level originalLevel = AsyncLogger::Level::INFO;
+        bool active;
+
+    public:
+        explicit ConsoleSilencer(bool silence) : active(silence) {
+            if (active) {
+                originalLevel = AsyncLogger::get().getLevel();
+                AsyncLogger::get().setLevel(AsyncLogger::Level::OFF);
+                original = std::cout.rdbuf(&nullBuffer);
+            }
+        }
+
+        ~ConsoleSilencer() {
+            if (active) {
+                std::cout.rdbuf(original);
+                AsyncLogger::get().setLevel(originalLevel);
+            }
+        }
+
+        // The real standard output, also while silenced
+        std::streambuf* stdoutBuffer() const { return active ? original : std::cout.rdbuf(); }
+
+        ConsoleSilencer(const ConsoleSilencer&) = delete;
+        ConsoleSilencer& operator=(const ConsoleSilencer&) = delete;
+    };
+
+    std::string trim(const std::string& text) {
+        size_t begin = text.find_first_not_of(" \t\r\n");
+        if (begin == std::string::npos) {
+            return "";
+        }
+        size_t end = text.find_last_not_of(" \t\r\n");
+        return text.substr(begin, end - begin + 1);
+    }
+
+    // Parses a whole non-negative integer no larger than maxValue
+    bool parseCount(const std::string& value, long long maxValue, long long& result) {
+        try {
+            size_t used = 0;
+            long long parsed = std::stoll(value, &used);
+            if (used != value.size() || parsed < 0 || parsed > maxValue) {
+                return false;
+            }
+            result = parsed;
+            return true;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    // An empty value (a bare flag) means true
+    bool parseFlag(const std::string& value, bool& result) {
+        if (value.empty() || value == "on" || value == "true" || value == "1") {
+            result = true;
+            return true;
+        }
+        if (value == "off" || value == "false" || value == "0") {
+            result = false;
+            return true;
+        }
+        return false;
+    }
+
+    bool isFlagOption(const std::string& name) {
+        return name == "pipeline" || name == "verbose" || name == "run";
+    }
+}
+
+BatchRunner::BatchRunner(std::ostream& errorStream) : errors(errorStream) {}
+
+bool BatchRunner::parseArguments(const std::vector<std::string>& args) {
+    // Purpose: Turn the command line into jobs.
+    // Parameters: @param args - the arguments after the program name.
+    // Return: @return False on the first invalid argument.
+    // Key Logic: Flags (pipeline, verbose, run) take no value on the command line, every other option takes one.
+    for (size_t i = 0; i < args.size(); ++i) {
+        const std::string& arg = args[i];
+        if (arg.size() < 3 || arg.compare(0, 2, "--") != 0) {
+            errors << "Error: Unexpected argument '" << arg << "'." << std::endl;
+            return false;
+        }
+        std::string name = arg.substr(2);
+        if (isFlagOption(name)) {
+            if (!setOption(name, "")) {
+                return false;
+            }
+            continue;
+        }
+        if (i + 1 >= args.size()) {
+            errors << "Error: Option --" << name << " needs a value." << std::endl;
+            return false;
+        }
+        const std::string& value = args[++i];
+        if (name == "script") {
+            std::ifstream in(value);
+            if (!in) {
+                errors << "Error: Could not open script " << value << std::endl;
+                return false;
+            }
+            if (!loadScript(in, value)) {
+                return false;
+            }
+        } else if (!setOption(name, value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BatchRunner::parseScript(std::istream& in) {
+    return loadScript(in, "script");
+}
+
+bool BatchRunner::loadScript(std::istream& in, const std::string& name) {
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        size_t split = line.find_first_of(" \t");
+        std::string option = line.substr(0, split);
+        std::string value = split == std::string::npos ? "" : trim(line.substr(split));
+        if (!setOption(option, value)) {
+            errors << "  at " << name << ":" << lineNumber << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BatchRunner::setOption(const std::string& name, const std::string& value) {
+    long long number = 0;
+    bool valid = true;
+    if (name == "run") {
+        jobs.push_back(current);
+    } else if (name == "config") {
+        current.configPath = value;
+        current.generateOperators = 0;
+    } else if (name == "generate") {
+        if ((valid = parseCount(value, INT_MAX, number) && number > 0)) {
+            current.generateOperators = static_cast<int>(number);
+            current.configPath.clear();
+        }
+    } else if (name == "seed") {
+        if ((valid = parseCount(value, LLONG_MAX, number))) {
+            current.seed = static_cast<uint64_t>(number);
+        }
+    } else if (name == "state") {
+        current.statePath = value;
+    } else if (name == "input") {
+        current.inputPath = value;
+    } else if (name == "text") {
+        current.inputText = value;
+    } else if (name == "chars-per-step") {
+        if ((valid = parseCount(value, LLONG_MAX, number) && number > 0)) {
+            current.streamOptions.charsPerStep = static_cast<size_t>(number);
+        }
+    } else if (name == "max-in-flight") {
+        if ((valid = parseCount(value, LLONG_MAX, number))) {
+            current.streamOptions.maxInFlightPayloads = static_cast<size_t>(number);
+        }
+    } else if (name == "steps") {
+        if ((valid = parseCount(value, INT_MAX, number) && number > 0)) {
+            current.steps = static_cast<int>(number);
+        }
+    } else if (name == "output") {
+        current.outputPath = value;
+    } else if (name == "save-config") {
+        current.saveConfigPath = value;
+    } else if (name == "save-state") {
+        current.saveStatePath = value;
+    } else if (name == "update-threads") {
+        if ((valid = parseCount(value, 1024, number))) {
+            current.updateThreads = static_cast<size_t>(number);
+        }
+    } else if (name == "pin-cpu") {
+        if ((valid = value == "off" || parseCount(value, 4096, number))) {
+            current.pinCpu = value == "off" ? -1 : static_cast<int>(number);
+        }
+    } else if (name == "pipeline") {
+        valid = parseFlag(value, current.pipelinedUpdates);
+    } else if (name == "verbose") {
+        valid = parseFlag(value, current.verbose);
+    } else {
+        errors << "Error: Unknown option '" << name << "'." << std::endl;
+        return false;
+    }
+
+    if (!valid) {
+        errors << "Error: Invalid value '" << value << "' for " << name << "." << std::endl;
+    }
+    return valid;
+}
+
+std::vector<BatchJob> BatchRunner::getJobs() const {
+    return jobs.empty() ? std::vector<BatchJob>{current} : jobs;
+}
+
+int BatchRunner::runAll() {
+    int exitCode = 0;
+    std::vector<BatchJob> toRun = getJobs();
+    for (size_t i = 0; i < toRun.size(); ++i) {
+        if (!runJob(toRun[i], errors)) {
+            errors << "Job " << (i + 1) << " of " << toRun.size() << " failed." << std::endl;
+            exitCode = 1;
+        }
+    }
+    return exitCode;
+}
+
+bool BatchRunner::runJob(const BatchJob& job, std::ostream& errorStream) {
+    // Purpose: Run one job from network load to the last save.
+    // Parameters: @param job - what to run, @param errorStream - receives the failure reason.
+    // Return: @return True if every step of the job succeeded.
+    // Key Logic: The text output is drained by a reader thread through an OutputSubscription while the run
+    //            holds the simulation thread, so a slow sink never stalls a step and the output ring never fills.
+    if (job.configPath.empty() && job.generateOperators <= 0) {
+        errorStream << "Error: No network, set config or generate." << std::endl;
+        return false;
+    }
+    if (job.steps <= 0) {
+        errorStream << "Error: No step count, set steps." << std::endl;
+        return false;
+    }
+
+    // Worker pools start during the run and pin themselves to the CPUs after the simulation thread's
+    WorkerPool::setCpuPinning(job.pinCpu >= 0, static_cast<size_t>(job.pinCpu) + 1);
+
+    ConsoleSilencer silencer(!job.verbose);
+    Randomizer randomizer(std::make_unique<PhiloxRandomSource>(job.seed));
+    Simulator simulator("", &randomizer);
+    if (!job.verbose) {
+        simulator.setLogFrequency(0);
+    }
+    simulator.setUpdateThreads(job.updateThreads);
+    simulator.setPipelinedUpdates(job.pipelinedUpdates);
+
+    // 1. Network and state
+    try {
+        if (!job.configPath.empty()) {
+            simulator.loadConfiguration(job.configPath);
+        } else {
+            simulator.createNewNetwork(job.generateOperators);
+        }
+        if (!job.statePath.empty()) {
+            if (!std::ifstream(job.statePath, std::ios::binary)) {
+                errorStream << "Error: Could not open state file " << job.statePath << std::endl;
+                return false;
+            }
+            if (!simulator.loadState(job.statePath)) {
+                errorStream << "Error: Could not load the state from " << job.statePath << std::endl;
+                return false;
+            }
+        }
+    } catch (const std::exception& e) {
+        errorStream << "Error: " << e.what() << std::endl;
+        return false;
+    }
+    if (simulator.getStatus().totalOperators == 0) {
+        errorStream << "Error: Could not load a network from " << (job.configPath.empty() ? "the generator" : job.configPath) << std::endl;
+        return false;
+    }
+
+    // 2. Input
+    if (!job.inputText.empty()) {
+        simulator.submitText(job.inputText);
+    }
+    if (!job.inputPath.empty() && !simulator.openTextStream(job.inputPath, job.streamOptions)) {
+        errorStream << "Error: Could not open input " << job.inputPath << std::endl;
+        return false;
+    }
+
+    // 3. Output sink
+    std::ofstream outputFile;
+    std::unique_ptr<std::ostream> stdoutSink;
+    std::ostream* sink = nullptr;
+    if (job.outputPath == "-") {
+        stdoutSink = std::make_unique<std::ostream>(silencer.stdoutBuffer());
+        sink = stdoutSink.get();
+    } else if (!job.outputPath.empty()) {
+        outputFile.open(job.outputPath, std::ios::binary | std::ios::trunc);
+        if (!outputFile) {
+            errorStream << "Error: Could not open output " << job.outputPath << std::endl;
+            return false;
+        }
+        sink = &outputFile;
+    }
+
+    // 4. Run, with the output drained alongside
+    std::shared_ptr<OutputSubscription> subscription;
+    std::thread reader;
+    std::atomic<bool> runFinished{false};
+    std::unique_ptr<uint8_t[]> chars(new uint8_t[OUTPUT_BATCH]);
+    OutputSubscription::BatchCallback writeChars = [&](const int* values, size_t count) {
+        while (count > 0) {
+            size_t part = std::min(count, OUTPUT_BATCH);
+            SampleCodec::messagesToBytes(values, part, chars.get());
+            sink->write(reinterpret_cast<const char*>(chars.get()), static_cast<std::streamsize>(part));
+            values += part;
+            count -= part;
+        }
+    };
+    if (sink != nullptr) {
+        subscription = simulator.subscribeOutput(ChannelType::TEXT, OUTPUT_BATCH);
+        reader = std::thread([&] {
+            while (!runFinished.load(std::memory_order_acquire)) {
+                subscription->waitAndPoll(std::chrono::milliseconds(50), writeChars);
+            }
+        });
+    }
+
+    {
+        // The simulation thread is pinned for the run only, after the reader started: threads inherit the
+        // affinity of their creator. The logger's writer thread is started here for the same reason.
+        std::unique_ptr<ScopedThreadPin> pin;
+        if (job.pinCpu >= 0) {
+            AsyncLogger::get();
+            pin = std::make_unique<ScopedThreadPin>(static_cast<size_t>(job.pinCpu));
+            if (!pin->isPinned()) {
+                errorStream << "Warning: Could not pin the simulation thread to CPU " << job.pinCpu << std::endl;
+            }
+        }
+        simulator.run(job.steps);
+    }
+
+    if (sink != nullptr) {
+        runFinished.store(true, std::memory_order_release);
+        reader.join();
+        subscription->poll(writeChars); // what arrived after the reader's last poll
+        simulator.unsubscribeOutput(subscription);
+        sink->flush();
+        if (!*sink) {
+            errorStream << "Error: Could not write output " << job.outputPath << std::endl;
+            return false;
+        }
+    }
+
+    // 5. Results
+    if (!job.saveConfigPath.empty() && !simulator.saveConfiguration(job.saveConfigPath)) {
+        errorStream << "Error: Could not save the network to " << job.saveConfigPath << std::endl;
+        return false;
+    }
+    if (!job.saveStatePath.empty()) {
+        std::remove(job.saveStatePath.c_str()); // a file left by an earlier job must not pass for this one
+        if (!simulator.saveState(job.saveStatePath)) {
+            errorStream << "Error: Could not save the state to " << job.saveStatePath << std::endl;
+            return false;
+        }
+    }
+    if (job.verbose) {
+        std::cout << "Job finished at step " << simulator.getStatus().currentStep << std::endl;
+    }
+    return true;
+}
+
+void BatchRunner::printUsage(std::ostream& out) {
+    out << "Usage: AthenaBatch [--name value ...] [--script <path>]\n"
+        << "Options (scripts use one 'name value' line each, 'run' queues the job described so far):\n"
+        << "  config <path>          Network configuration to load.\n"
+        << "  generate <count>       Random network of <count> internal operators instead of a config.\n"
+        << "  seed <n>               Seed of the generated network (default 1).\n"
+        << "  state <path>           Payload state to load after the network.\n"
+        << "  input <path>           File or named pipe streamed to the text channel.\n"
+        << "  text <text>            Text submitted before the run.\n"
+        << "  chars-per-step <n>     Input stream rate (default 64).\n"
+        << "  max-in-flight <n>      Input backpressure limit in payloads (default 100000, 0 = none).\n"
+        << "  steps <n>              Steps to run (required).\n"
+        << "  output <path|->        Text output sink, '-' for stdout.\n"
+        << "  save-config <path>     Save the network after the run.\n"
+        << "  save-state <path>      Save the payload state after the run.\n"
+        << "  update-threads <n>     Update workers besides the simulation thread (default 0).\n"
+        << "  pin-cpu <cpu|off>      Pin the simulation thread to <cpu> and workers to the following CPUs.\n"
+        << "  pipeline [on|off]      Pipelined update processing.\n"
+        << "  verbose [on|off]       Keep the simulator's console output and run log.\n"
+        << "  run                    Queue a job (scripts, or --run on the command line).\n"
+        << "Exit code: 0 if every job succeeded, 1 if a job failed, 2 on invalid arguments." << std::endl;
+}
@@ -3,12 +3,57 @@
 #include <iostream>
 #include <sstream>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <limits>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <vector>
 
 /**
  * @brief Constructor for the CLI class.
  * @param simulator A shared pointer to the Simulator object that this CLI will control.
  */
-CLI::CLI(std::shared_ptr<Simulator> simulator) : sim(std::move(simulator)) {
+CLI::CLI(std::shared_ptr<Simulator> simulator) :
+    sim(std::move(simulator)),
+    backgroundRuns(std::make_shared<BackgroundRuns>())
+{
+}
+
+/**
+ * @struct CLI::BackgroundRuns
+ * @brief Number of detached `run` threads still inside Simulator::run.
+ */
+struct CLI::BackgroundRuns {
+    std::mutex mutex;
+    std::condition_variable finished;
+    int active = 0;
+
+    // Runs `body(*simulator)` on a detached thread, counted until it returns
+    template<typename Body>
+    static void start(const std::shared_ptr<BackgroundRuns>& runs, std::shared_ptr<Simulator> simulator, Body body) {
+        {
+            std::lock_guard<std::mutex> lock(runs->mutex);
+            runs->active++;
+        }
+        std::thread([runs, simulator = std::move(simulator), body]() mutable {
+            body(*simulator);
+            simulator.reset(); // a waiter may let the last other owner go as soon as the count drops
+            std::lock_guard<std::mutex> lock(runs->mutex); // notified under the lock, the waiter cannot return before
+            runs->active--;
+            runs->finished.notify_all();
+        }).detach();
+    }
+};
+
+void CLI::stopBackgroundRuns() {
+    std::unique_lock<std::mutex> lock(backgroundRuns->mutex);
+    while (backgroundRuns->active > 0) {
+        sim->requestStop();
+        backgroundRuns->finished.wait_for(lock, std::chrono::milliseconds(10));
+    }
 }
 
 /**
@@ -59,10 +104,19 @@ void CLI::stop() {
 /**
  * @brief Parses a single line of input from the user and executes the corresponding command.
  * @param line The raw string of input from the user.
+ */
+void CLI::processCommand(const std::string& line) {
+    execute(line, std::cout);
+}
+
+/**
+ * @brief Executes one command line, writing the response to the given stream.
+ * @param line The raw command line.
+ * @param out Receives the command's response.
  * @details This function contains the primary command-dispatching logic. It uses a stringstream to separate
  * the command from its arguments and then calls the appropriate method on the Simulator instance.
  */
-void CLI::processCommand(const std::string& line) {
+void CLI::execute(const std::string& line, std::ostream& out) {
     std::stringstream ss(line);
     std::string command;
     ss >> command;
@@ -74,79 +128,119 @@ void CLI::processCommand(const std::string& line) {
         std::string path;
         ss >> path;
         if (path.empty()) {
-            std::cout << "Error: Please provide a file path." << std::endl;
+            out << "Error: Please provide a file path." << std::endl;
         } else {
             try {
                 sim->loadConfiguration(path);
-                std::cout << "Configuration loaded from " << path << std::endl;
+                out << "Configuration loaded from " << path << std::endl;
             } catch (const std::exception& e) {
-                std::cout << "Error loading configuration: " << e.what() << std::endl;
+                out << "Error loading configuration: " << e.what() << std::endl;
             }
         }
     } else if (command == "save-config") {
         std::string path;
         ss >> path;
         if (path.empty()) {
-            std::cout << "Error: Please provide a file path." << std::endl;
+            out << "Error: Please provide a file path." << std::endl;
         } else {
             bool result = sim->saveConfiguration(path);
             if(result){
-                std::cout << "Configuration saved to " << path << std::endl;
+                out << "Configuration saved to " << path << std::endl;
             }
             else{
-                std::cout << "Failed to save file to " << path << std::endl;
+                out << "Failed to save file to " << path << std::endl;
             }
         }
     } else if (command == "load-state") {
         std::string path;
         ss >> path;
         if (path.empty()) {
-            std::cout << "Error: Please provide a file path." << std::endl;
+            out << "Error: Please provide a file path." << std::endl;
         } else {
             try {
-                sim->loadState(path);
-                std::cout << "Network state loaded from " << path << std::endl;
+                if (sim->loadState(path)) {
+                    out << "Network state loaded from " << path << std::endl;
+                } else {
+                    out << "Failed to load state from " << path << std::endl;
+                }
             } catch (const std::exception& e) {
-                std::cout << "Error loading state: " << e.what() << std::endl;
+                out << "Error loading state: " << e.what() << std::endl;
             }
         }
     } else if (command == "save-state") {
         std::string path;
         ss >> path;
         if (path.empty()) {
-            std::cout << "Error: Please provide a file path." << std::endl;
+            out << "Error: Please provide a file path." << std::endl;
         } else {
-            sim->saveState(path);
-            std::cout << "Network State saved to " << path << std::endl;
+            if (sim->saveState(path)) {
+                out << "Network State saved to " << path << std::endl;
+            } else {
+                out << "Failed to save state to " << path << std::endl;
+            }
         }
     } else if (command == "new-network") {
         int num_ops;
         if (!(ss >> num_ops)) {
-            std::cout << "Error: Please provide a valid number of operators." << std::endl;
+            out << "Error: Please provide a valid number of operators." << std::endl;
         } else {
             sim->createNewNetwork(num_ops);
-            std::cout << "New network created with " << num_ops << " internal operators." << std::endl;
+            out << "New network created with " << num_ops << " internal operators." << std::endl;
+        }
+    } else if (command == "generate-network") {
+        // generate-network <path> <count> [uniform|power-law|small-world] [mean-degree] [seed]
+        std::string path;
+        long long count = -1;
+        std::string modelName;
+        NetworkSpec spec;
+        if (!(ss >> path >> count) || count < 0 || count > std::numeric_limits<uint32_t>::max()) {
+            out << "Error: Usage: generate-network <path> <count> [uniform|power-law|small-world] [mean-degree] [seed]" << std::endl;
+            return;
+        }
+        spec.internalOperators = static_cast<uint32_t>(count);
+        if (ss >> modelName && !NetworkGenerator::parseDegreeModel(modelName, spec.degreeModel)) {
+            out << "Error: Unknown degree model '" << modelName << "'. Use uniform, power-law or small-world." << std::endl;
+            return;
+        }
+        double meanDegree;
+        if (ss >> meanDegree) {
+            spec.meanDegree = meanDegree;
+            uint64_t seed;
+            if (ss >> seed) {
+                spec.seed = seed;
+            }
+        }
+        try {
+            GeneratedNetworkInfo info;
+            auto start = std::chrono::steady_clock::now();
+            if (sim->generateNetworkFile(spec, path, &info)) {
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                out << "Generated " << info.operators << " operators and " << info.connections
+                          << " connections (" << info.bytes << " bytes) in " << seconds << "s, written to " << path << std::endl;
+            } else {
+                out << "Error: Could not write generated network to " << path << std::endl;
+            }
+        } catch (const std::exception& e) {
+            out << "Error generating network: " << e.what() << std::endl;
         }
     } else if (command == "run") {
         std::string steps_str;
         ss >> steps_str;
         if (steps_str.empty()) {
-            std::thread simThread([this] { sim->run(); });
-            simThread.detach();
-            std::cout << "Simulation running in background until inactive..." << std::endl;
+            BackgroundRuns::start(backgroundRuns, sim, [](Simulator& simulator) { simulator.run(); });
+            out << "Simulation running in background until inactive..." << std::endl;
         } else {
             try {
                 int steps = std::stoi(steps_str);
-                std::thread simThread([this, steps] { sim->run(steps); });
-                simThread.detach();
-                std::cout << "Simulation running in background for " << steps << " steps..." << std::endl;
+                BackgroundRuns::start(backgroundRuns, sim, [steps](Simulator& simulator) { simulator.run(steps); });
+                out << "Simulation running in background for " << steps << " steps..." << std::endl;
             } catch (const std::exception& e) {
-                std::cout << "Error: Invalid number of steps." << std::endl;
+                out << "Error: Invalid number of steps." << std::endl;
             }
         }
     } else if (command == "pause" || command == "stop") {
         sim->requestStop();
-        std::cout << "Stop request sent to simulation." << std::endl;
+        out << "Stop request sent to simulation." << std::endl;
     } else if (command == "submit-text") {
         std::string text;
         std::getline(ss, text);
@@ -154,69 +248,273 @@ void CLI::processCommand(const std::string& line) {
             text = text.substr(1);
         }
         if (text.empty()) {
-            std::cout << "Error: Please provide text to submit." << std::endl;
+            out << "Error: Please provide text to submit." << std::endl;
         } else {
              sim->submitText(text);
-             std::cout << "Text submitted." << std::endl;
+             out << "Text submitted." << std::endl;
+        }
+    } else if (command == "stream-text") {
+        // stream-text <path> [chars-per-step] [max-in-flight] | stream-text close | stream-text status
+        std::string target;
+        ss >> target;
+        if (target.empty()) {
+            out << "Error: Usage: stream-text <path> [chars-per-step] [max-in-flight] | stream-text close | stream-text status" << std::endl;
+        } else if (target == "close") {
+            sim->closeTextStream();
+            out << "Text stream closed." << std::endl;
+        } else if (target == "status") {
+            TextStreamStats stats;
+            if (!sim->getTextStreamStats(stats)) {
+                out << "No text stream open." << std::endl;
+            } else {
+                out << "Text stream: " << stats.charsFed << " chars fed, " << stats.buffered << " buffered, "
+                          << stats.charsRead << " read, " << stats.throttledSteps << " throttled steps"
+                          << (stats.sourceExhausted ? ", source finished" : "") << std::endl;
+            }
+        } else {
+            TextStreamOptions options;
+            long long charsPerStep = 0;
+            long long maxInFlight = 0;
+            if (ss >> charsPerStep) {
+                if (charsPerStep <= 0) {
+                    out << "Error: chars-per-step must be a positive number." << std::endl;
+                    return;
+                }
+                options.charsPerStep = static_cast<size_t>(charsPerStep);
+                options.bufferCapacity = std::max(options.bufferCapacity, options.charsPerStep);
+                if (ss >> maxInFlight) {
+                    if (maxInFlight < 0) {
+                        out << "Error: max-in-flight cannot be negative (0 disables backpressure)." << std::endl;
+                        return;
+                    }
+                    options.maxInFlightPayloads = static_cast<size_t>(maxInFlight);
+                }
+            }
+            if (sim->openTextStream(target, options)) {
+                out << "Streaming " << target << " at " << options.charsPerStep << " chars per step." << std::endl;
+            } else {
+                out << "Error: Could not open text stream " << target << std::endl;
+            }
+        }
+    } else if (command == "submit-media") {
+        // submit-media image|audio <path> [samples-per-step]: raw 8-bit pixels or native-endian 16-bit PCM
+        std::string channelName, path;
+        ss >> channelName >> path;
+        if ((channelName != "image" && channelName != "audio") || path.empty()) {
+            out << "Error: Usage: submit-media image|audio <path> [samples-per-step]" << std::endl;
+            return;
+        }
+        ChannelType channel = channelName == "image" ? ChannelType::IMAGE : ChannelType::AUDIO;
+        long long samplesPerStep = 0;
+        if (ss >> samplesPerStep) {
+            if (samplesPerStep <= 0) {
+                out << "Error: samples-per-step must be a positive number." << std::endl;
+                return;
+            }
+            sim->setChannelInputRate(channel, static_cast<size_t>(samplesPerStep));
+        }
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            out << "Error: Could not open media file " << path << std::endl;
+            return;
+        }
+        std::vector<char> raw((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        size_t total = 0;
+        size_t accepted = 0;
+        if (channel == ChannelType::IMAGE) {
+            total = raw.size();
+            accepted = sim->submitImageFrame(reinterpret_cast<const uint8_t*>(raw.data()), total);
+        } else {
+            std::vector<int16_t> samples(raw.size() / sizeof(int16_t));
+            std::copy_n(raw.data(), samples.size() * sizeof(int16_t), reinterpret_cast<char*>(samples.data()));
+            total = samples.size();
+            accepted = sim->submitAudioSamples(samples.data(), total);
+        }
+        out << "Queued " << accepted << " of " << total << " " << channelName << " samples";
+        if (accepted < total) {
+            out << " (input queue full, resubmit the rest later)";
+        }
+        out << "." << std::endl;
+    } else if (command == "read-media") {
+        // read-media image|audio <path> [max-samples]: drains the channel's output into a raw file
+        std::string channelName, path;
+        ss >> channelName >> path;
+        if ((channelName != "image" && channelName != "audio") || path.empty()) {
+            out << "Error: Usage: read-media image|audio <path> [max-samples]" << std::endl;
+            return;
+        }
+        long long maxSamples = 1 << 20;
+        if (ss >> maxSamples && maxSamples <= 0) {
+            out << "Error: max-samples must be a positive number." << std::endl;
+            return;
+        }
+        std::ofstream file(path, std::ios::binary);
+        if (!file) {
+            out << "Error: Could not open " << path << " for writing." << std::endl;
+            return;
+        }
+        size_t read = 0;
+        if (channelName == "image") {
+            std::vector<uint8_t> pixels(static_cast<size_t>(maxSamples));
+            read = sim->readImageOutput(pixels.data(), pixels.size());
+            file.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(read));
+        } else {
+            std::vector<int16_t> samples(static_cast<size_t>(maxSamples));
+            read = sim->readAudioOutput(samples.data(), samples.size());
+            file.write(reinterpret_cast<const char*>(samples.data()), static_cast<std::streamsize>(read * sizeof(int16_t)));
         }
+        out << "Wrote " << read << " " << channelName << " samples to " << path << "." << std::endl;
     } else if (command == "get-output") {
         std::string output = sim->getOutput();
-        std::cout << "Output: " << output << std::endl;
+        out << "Output: " << output << std::endl;
     } else if (command == "get-text-count"){
         int count = sim->getTextCount();
-        std::cout << "Text Count: " << count << std::endl;
+        out << "Text Count: " << count << std::endl;
     } else if (command == "status") {
         SimulationStatus status = sim->getStatus();
-        status.print(); // Use the print method from the struct
+        status.print(out); // Use the print method from the struct
+    } else if (command == "stats") {
+        std::string option;
+        ss >> option;
+        if (option == "reset") {
+            sim->resetStepStats();
+            out << "Step statistics cleared." << std::endl;
+        } else {
+            SimulationStatus status = sim->getStatus();
+            status.stepStats.print(out);
+        }
+    } else if (command == "trace") {
+        std::string action, path;
+        ss >> action >> path;
+        if (action == "start") {
+            sim->startTrace();
+            out << "Tracing started." << std::endl;
+        } else if (action == "stop" && !path.empty()) {
+            if (sim->stopTrace(path)) {
+                out << "Trace written to " << path << std::endl;
+            } else {
+                out << "Error: Could not write trace to " << path << std::endl;
+            }
+        } else {
+            out << "Error: Usage: trace start | trace stop <path>" << std::endl;
+        }
+    } else if (command == "profile") {
+        std::string action;
+        ss >> action;
+        if (action == "on" || action == "off") {
+            sim->setProfiling(action == "on");
+            out << "Operator profiling " << (action == "on" ? "enabled." : "disabled.") << std::endl;
+        } else if (action == "reset") {
+            sim->resetProfile();
+            out << "Operator profile cleared." << std::endl;
+        } else if (action == "report") {
+            size_t topK = 10;
+            std::string metricName;
+            OperatorProfiler::Metric metric = OperatorProfiler::Metric::DELIVERIES;
+            if (!(ss >> topK)) {
+                topK = 10;
+            } else if (ss >> metricName && !OperatorProfiler::parseMetric(metricName, metric)) {
+                out << "Error: Unknown metric '" << metricName << "'. Use deliveries, fires, emitted or traversals." << std::endl;
+                return;
+            }
+            out << sim->getProfileReport(topK, metric);
+        } else {
+            out << "Error: Usage: profile on | off | reset | report [k] [metric]" << std::endl;
+        }
+    } else if (command == "pipeline") {
+        // pipeline on|off [min-concurrent-updates]
+        std::string action;
+        ss >> action;
+        long long minConcurrent = static_cast<long long>(Simulator::DEFAULT_PIPELINE_THRESHOLD);
+        if (action != "on" && action != "off") {
+            out << "Error: Usage: pipeline on|off [min-concurrent-updates]" << std::endl;
+            return;
+        }
+        if (!(ss >> minConcurrent)) {
+            if (!ss.eof()) {
+                out << "Error: min-concurrent-updates must be a number." << std::endl;
+                return;
+            }
+            minConcurrent = static_cast<long long>(Simulator::DEFAULT_PIPELINE_THRESHOLD);
+        } else if (minConcurrent < 0) {
+            out << "Error: min-concurrent-updates must not be negative." << std::endl;
+            return;
+        }
+        sim->setPipelinedUpdates(action == "on", static_cast<size_t>(minConcurrent));
+        out << "Pipelined updates " << (action == "on" ? "enabled." : "disabled.") << std::endl;
     } else if (command == "print-network") {
-        std::cout << sim->getNetworkJson(true) << std::endl;
+        out << sim->getNetworkJson(true) << std::endl;
     } else if (command == "print-current-payloads") {
-        std::cout << sim->getCurrentPayloadsJson(true) << std::endl;
+        out << sim->getCurrentPayloadsJson(true) << std::endl;
     } else if (command == "print-next-payloads") {
-        std::cout << sim->getNextPayloadsJson(true) << std::endl;
+        out << sim->getNextPayloadsJson(true) << std::endl;
     } else if (command == "set-batch-size"){
         int size;
         if (!(ss >> size)) {
-            std::cout << "Error: Please provide a valid batch size." << std::endl;
+            out << "Error: Please provide a valid batch size." << std::endl;
         } else {
             sim->setTextBatchSize(size);
-            std::cout << "Batch size set to " << size << " ." << std::endl;
+            out << "Batch size set to " << size << " ." << std::endl;
         }
     } else if (command == "log-frequency") {
         int frequency;
         if (!(ss >> frequency) || frequency <= 0) {
-            std::cout << "Error: Please provide a positive integer for the frequency." << std::endl;
+            out << "Error: Please provide a positive integer for the frequency." << std::endl;
         } else {
             sim->setLogFrequency(frequency);
-            std::cout << "Log frequency set to every " << frequency << " steps." << std::endl;
+            out << "Log frequency set to every " << frequency << " steps." << std::endl;
+        }
+    } else if (command == "log-level") {
+        std::string levelName;
+        AsyncLogger::Level level;
+        if (!(ss >> levelName) || !AsyncLogger::parseLevel(levelName, level)) {
+            out << "Error: Usage: log-level debug | info | warn | error | off" << std::endl;
+        } else {
+            sim->setLogLevel(level);
+            out << "Log level set to " << levelName << "." << std::endl;
         }
     } else if (command == "clear-text-output"){
         sim->clearTextOutput();
-        std::cout << "Output has been cleared" << std::endl; 
+        out << "Output has been cleared" << std::endl; 
     } else if (command == "help") {
-         std::cout << "Available Commands:\n"
+         out << "Available Commands:\n"
               << "  load-config <path>      - Load network structure from a file.\n"
               << "  save-config <path>      - Save network structure to a file.\n"
               << "  load-state <path>       - Load network state from a file.\n"
               << "  save-state <path>       - Save network state to a file.\n"
               << "  new-network <count>     - Create a new random network.\n"
+              << "  generate-network <path> <count> [uniform|power-law|small-world] [mean-degree] [seed]\n"
+              << "                          - Write a seeded synthetic network file (load it with load-config).\n"
               << "  run [steps]             - Run simulation for N steps or until inactive.\n"
               << "  pause / stop            - Request the running simulation to stop.\n"
               << "  submit-text <text>      - Submit text to the input layer.\n"
+              << "  stream-text <path> [chars-per-step] [max-in-flight]\n"
+              << "                          - Feed a file or pipe to the input layer a few chars per step.\n"
+              << "  stream-text close|status - Stop the text stream or show its counters.\n"
+              << "  submit-media image|audio <path> [samples-per-step]\n"
+              << "                          - Queue raw 8-bit pixels or 16-bit PCM for the image/audio channel.\n"
+              << "  read-media image|audio <path> [max-samples]\n"
+              << "                          - Drain the image/audio output channel into a raw file.\n"
               << "  get-output              - Retrieve and print text from the output layer.\n"
               << "  get-text-count          - Display the current amount of text output.\n"
               << "  status                  - Display the current status of the simulation.\n"
+              << "  stats [reset]           - Display per-phase step timings and counters (or clear them).\n"
+              << "  trace start|stop <path> - Record simulation phases, write Chrome trace JSON on stop.\n"
+              << "  profile on|off|reset    - Count deliveries, fires, emitted payloads and traversals per operator.\n"
+              << "  profile report [k] [metric] - Top-K operators (deliveries|fires|emitted|traversals) and degree histograms.\n"
+              << "  pipeline on|off [min]   - Apply each step's updates during the next step, off-thread above [min] (1024).\n"
               << "  print-network           - Display the entire network structure as JSON.\n"
               << "  print-current-payloads  - Display payloads for current time step.\n"
               << "  print-next-payloads     - Display payloads for next time step.\n"
               << "  set-batch-size          - Set how many characters to return each call to get-ouput\n"
               << "  log-frequency <steps>   - Set how often status is logged during a run.\n"
+              << "  log-level <level>       - Set run logging level (debug|info|warn|error|off).\n"
               << "  clear-text-output            - Removes all output data currently stored\n"
               << "  quit / exit             - Exit the application.\n"
               << std::endl;
     } else {
         if(!command.empty()) {
-            std::cout << "Unknown command: '" << command << "'. Type 'help' for a list of commands." << std::endl;
+            out << "Unknown command: '" << command << "'. Type 'help' for a list of commands." << std::endl;
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include "../headers/util/ChannelInputQueue.h"
+#include "../headers/util/SampleCodec.h"
+#include <algorithm>
+
+ChannelInputQueue::ChannelInputQueue(size_t capacity, size_t perStep) :
+    pending(capacity),
+    samplesPerStep(std::max<size_t>(perStep, 1))
+{
+}
+
+size_t ChannelInputQueue::submitBytes(const uint8_t* bytes, size_t count) {
+    // Purpose: Convert and queue a buffer of 8-bit samples.
+    // Parameters: @param bytes - the samples, @param count - number of samples.
+    // Return: @return Number of samples accepted.
+    // Key Logic: Converted directly into the ring's free slots, one or two spans, no intermediate buffer.
+    std::lock_guard<std::mutex> lock(producerMutex);
+    return pending.produce(count, [&bytes](int* slots, size_t n) {
+        SampleCodec::bytesToMessages(bytes, n, slots);
+        bytes += n;
+    });
+}
+
+size_t ChannelInputQueue::submitSamples16(const int16_t* samples, size_t count) {
+    std::lock_guard<std::mutex> lock(producerMutex);
+    return pending.produce(count, [&samples](int* slots, size_t n) {
+        SampleCodec::samples16ToMessages(samples, n, slots);
+        samples += n;
+    });
+}
+
+void ChannelInputQueue::setSamplesPerStep(size_t perStep) {
+    samplesPerStep.store(std::max<size_t>(perStep, 1), std::memory_order_relaxed);
+}
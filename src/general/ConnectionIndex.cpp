@@ -0,0 +1,68 @@
+#include "../headers/util/ConnectionIndex.h"
+#include <algorithm>
+
+void ConnectionIndex::addEdge(uint32_t sourceId, uint32_t targetId, int distance) {
+    Stripe& stripe = stripeFor(targetId);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    stripe.incoming[targetId].push_back(IncomingEdge{sourceId, distance});
+}
+
+void ConnectionIndex::removeEdge(uint32_t sourceId, uint32_t targetId, int distance) {
+    Stripe& stripe = stripeFor(targetId);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    auto it = stripe.incoming.find(targetId);
+    if (it == stripe.incoming.end()) {
+        return;
+    }
+    std::vector<IncomingEdge>& edges = it->second;
+    auto edgeIt = std::find(edges.begin(), edges.end(), IncomingEdge{sourceId, distance});
+    if (edgeIt != edges.end()) {
+        // order of incoming edges does not matter, swap with the last to avoid shifting
+        *edgeIt = edges.back();
+        edges.pop_back();
+    }
+    if (edges.empty()) {
+        stripe.incoming.erase(it);
+    }
+}
+
+std::vector<IncomingEdge> ConnectionIndex::getIncoming(uint32_t targetId) const {
+    const Stripe& stripe = stripeFor(targetId);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    auto it = stripe.incoming.find(targetId);
+    if (it == stripe.incoming.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+size_t ConnectionIndex::getInDegree(uint32_t targetId) const {
+    const Stripe& stripe = stripeFor(targetId);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    auto it = stripe.incoming.find(targetId);
+    return it == stripe.incoming.end() ? 0 : it->second.size();
+}
+
+void ConnectionIndex::forgetTarget(uint32_t targetId) {
+    Stripe& stripe = stripeFor(targetId);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    stripe.incoming.erase(targetId);
+}
+
+size_t ConnectionIndex::getEdgeCount() const {
+    size_t total = 0;
+    for (const Stripe& stripe : stripes) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        for (const auto& entry : stripe.incoming) {
+            total += entry.second.size();
+        }
+    }
+    return total;
+}
+
+void ConnectionIndex::clear() {
+    for (Stripe& stripe : stripes) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        stripe.incoming.clear();
+    }
+}
@@ -0,0 +1,458 @@
+#include "../headers/cli/ControlServer.h"
+#include "../headers/Simulator.h"
+#include "../headers/OutputSubscription.h"
+#include "../headers/util/SampleCodec.h"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+    // Without events, streams are drained at this interval so output below their batch size still arrives
+    const int IDLE_POLL_MS = 100;
+    const int MAX_EVENTS = 64;
+    const size_t READ_CHUNK = 4096;
+
+    void setInterest(int epollFd, int fd, uint32_t events) {
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = fd;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &event);
+    }
+
+    bool addInterest(int epollFd, int fd, uint32_t events) {
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = fd;
+        return epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) == 0;
+    }
+}
+
+ControlServer::ControlServer(std::shared_ptr<Simulator> simulator, std::string path) :
+    sim(simulator),
+    cli(simulator),
+    socketPath(std::move(path))
+{
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+}
+
+ControlServer::~ControlServer() {
+    stop();
+    if (loopThread.joinable()) {
+        loopThread.join();
+    }
+    if (wakeFd >= 0) {
+        ::close(wakeFd);
+    }
+}
+
+bool ControlServer::start() {
+    if (running.load(std::memory_order_acquire) || loopThread.joinable()) {
+        std::cerr << "Error: Control server is already running." << std::endl;
+        return false;
+    }
+    stopRequested.store(false, std::memory_order_release);
+    if (!openSocket()) {
+        return false;
+    }
+    running.store(true, std::memory_order_release);
+    loopThread = std::thread([this] { eventLoop(); });
+    return true;
+}
+
+bool ControlServer::run() {
+    if (running.load(std::memory_order_acquire)) {
+        std::cerr << "Error: Control server is already running." << std::endl;
+        return false;
+    }
+    stopRequested.store(false, std::memory_order_release);
+    if (!openSocket()) {
+        return false;
+    }
+    running.store(true, std::memory_order_release);
+    eventLoop();
+    return true;
+}
+
+void ControlServer::stop() {
+    stopRequested.store(true, std::memory_order_release);
+    if (wakeFd >= 0) {
+        uint64_t one = 1;
+        ssize_t ignored = ::write(wakeFd, &one, sizeof(one));
+        (void)ignored;
+    }
+}
+
+bool ControlServer::openSocket() {
+    // Purpose: Create the listening socket and the epoll set.
+    // Parameters: None.
+    // Return: @return False (reported on std::cerr) if the path is unusable or taken by a live server.
+    // Key Logic: A socket file left by a dead process is replaced, anything else at the path is left alone.
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Error: Invalid control socket path '" << socketPath << "'." << std::endl;
+        return false;
+    }
+    std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+    struct stat existing{};
+    if (::lstat(socketPath.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            std::cerr << "Error: " << socketPath << " exists and is not a socket." << std::endl;
+            return false;
+        }
+        int probe = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        bool live = probe >= 0 && ::connect(probe, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+        if (probe >= 0) {
+            ::close(probe);
+        }
+        if (live) {
+            std::cerr << "Error: Control socket " << socketPath << " is in use by another process." << std::endl;
+            return false;
+        }
+        ::unlink(socketPath.c_str());
+    }
+
+    listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd < 0 || ::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        std::cerr << "Error: Could not bind control socket " << socketPath << ": " << std::strerror(errno) << std::endl;
+        if (listenFd >= 0) {
+            ::close(listenFd);
+            listenFd = -1;
+        }
+        return false;
+    }
+    ::chmod(socketPath.c_str(), S_IRUSR | S_IWUSR); // commands can read and write files as this user
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (::listen(listenFd, SOMAXCONN) != 0 || epollFd < 0
+        || !addInterest(epollFd, listenFd, EPOLLIN)
+        || (wakeFd >= 0 && !addInterest(epollFd, wakeFd, EPOLLIN))) {
+        std::cerr << "Error: Could not listen on control socket " << socketPath << ": " << std::strerror(errno) << std::endl;
+        closeSocket();
+        return false;
+    }
+    return true;
+}
+
+void ControlServer::closeSocket() {
+    std::vector<int> open;
+    for (const auto& entry : connections) {
+        open.push_back(entry.first);
+    }
+    for (int fd : open) {
+        closeConnection(fd);
+    }
+    if (listenFd >= 0) {
+        ::close(listenFd);
+        listenFd = -1;
+        ::unlink(socketPath.c_str());
+    }
+    if (epollFd >= 0) {
+        ::close(epollFd);
+        epollFd = -1;
+    }
+    if (wakeFd >= 0) {
+        uint64_t count = 0;
+        ssize_t ignored = ::read(wakeFd, &count, sizeof(count)); // consume the stop signal
+        (void)ignored;
+    }
+}
+
+void ControlServer::eventLoop() {
+    // Purpose: Serve every connection from one thread until stopped.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: Level-triggered epoll over the listening socket, the wake eventfd, the client sockets and the
+    //            streams' notification descriptors; an idle timeout drains streams that never fill a batch.
+    epoll_event events[MAX_EVENTS];
+    while (!stopRequested.load(std::memory_order_acquire)) {
+        int ready = epoll_wait(epollFd, events, MAX_EVENTS, IDLE_POLL_MS);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "Error: Control server wait failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        if (ready == 0) {
+            std::vector<Connection*> streams;
+            for (const auto& entry : streamsByFd) {
+                streams.push_back(entry.second);
+            }
+            for (Connection* connection : streams) {
+                drainStream(*connection); // may close it, each entry is visited once
+            }
+            continue;
+        }
+        for (int i = 0; i < ready; ++i) {
+            int fd = events[i].data.fd;
+            uint32_t flags = events[i].events;
+            if (fd == wakeFd) {
+                uint64_t count = 0;
+                ssize_t ignored = ::read(wakeFd, &count, sizeof(count)); // stopRequested is checked by the loop
+                (void)ignored;
+                continue;
+            }
+            if (fd == listenFd) {
+                acceptClients();
+                continue;
+            }
+            auto stream = streamsByFd.find(fd);
+            if (stream != streamsByFd.end()) {
+                drainStream(*stream->second);
+                continue;
+            }
+            auto client = connections.find(fd);
+            if (client == connections.end()) {
+                continue; // closed earlier in this batch
+            }
+            if (flags & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                readClient(*client->second);
+                client = connections.find(fd);
+            }
+            if (client != connections.end() && (flags & EPOLLOUT)) {
+                flush(*client->second);
+            }
+        }
+    }
+    for (const auto& entry : connections) {
+        Connection& connection = *entry.second;
+        if (connection.output.size() > connection.outputSent) { // best effort for the shutdown response
+            ssize_t ignored = ::send(connection.fd, connection.output.data() + connection.outputSent,
+                                     connection.output.size() - connection.outputSent, MSG_NOSIGNAL);
+            (void)ignored;
+        }
+    }
+    closeSocket();
+    running.store(false, std::memory_order_release);
+}
+
+void ControlServer::acceptClients() {
+    while (true) {
+        int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return; // EAGAIN, or out of descriptors until a client leaves
+        }
+        if (!addInterest(epollFd, fd, EPOLLIN)) {
+            ::close(fd);
+            continue;
+        }
+        auto connection = std::make_unique<Connection>();
+        connection->fd = fd;
+        connections[fd] = std::move(connection);
+        clientCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void ControlServer::readClient(Connection& connection) {
+    // Purpose: Read what the client sent and execute every complete line.
+    // Parameters: @param connection - the client.
+    // Return: Void.
+    // Key Logic: Reads until the socket is empty (level-triggered, but fewer wakeups), closes on EOF or error.
+    // Reading pauses once MAX_LINE_LENGTH bytes are buffered, so a client can never grow the buffer
+    // beyond one chunk past the limit: the complete lines run, the rest waits in the socket for the
+    // next wakeup, and an unterminated line over the limit ends the connection.
+    char buffer[READ_CHUNK];
+    bool closed = false;
+    while (true) {
+        ssize_t received = ::recv(connection.fd, buffer, sizeof(buffer), 0);
+        if (received > 0) {
+            if (connection.stream || connection.closeWhenFlushed) { // ignores its input
+                continue;
+            }
+            connection.input.append(buffer, static_cast<size_t>(received));
+            if (connection.input.size() > MAX_LINE_LENGTH) {
+                break;
+            }
+            continue;
+        }
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        closed = received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+        break;
+    }
+    if (closed) {
+        closeConnection(connection.fd);
+        return;
+    }
+
+    size_t start = 0;
+    size_t newline;
+    while (!connection.closeWhenFlushed && !connection.stream
+           && (newline = connection.input.find('\n', start)) != std::string::npos) {
+        std::string line = connection.input.substr(start, newline - start);
+        start = newline + 1;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        handleLine(connection, line);
+    }
+    connection.input.erase(0, start);
+    if (connection.stream) {
+        connection.input.clear();
+        drainStream(connection); // output that was already waiting
+        return;
+    }
+    if (connection.input.size() > MAX_LINE_LENGTH) {
+        connection.input.clear();
+        connection.output += "Error: Command line too long.\n";
+        connection.output += END_OF_RESPONSE;
+        connection.output += '\n';
+        connection.closeWhenFlushed = true;
+    }
+    flush(connection);
+}
+
+void ControlServer::handleLine(Connection& connection, const std::string& line) {
+    // Purpose: Execute one command and queue its response.
+    // Parameters: @param connection - the client, @param line - the command without its newline.
+    // Return: Void.
+    // Key Logic: Connection level commands are handled here, everything else goes through CLI::execute.
+    std::stringstream ss(line);
+    std::string command;
+    ss >> command;
+    std::ostringstream response;
+
+    if (command == "quit" || command == "exit") {
+        response << "Closing connection." << std::endl;
+        connection.closeWhenFlushed = true;
+    } else if (command == "shutdown") {
+        sim->requestStop();
+        stopRequested.store(true, std::memory_order_release);
+        response << "Control server shutting down." << std::endl;
+    } else if (command == "stream-output") {
+        long long batchSize = 1;
+        if (!(ss >> batchSize)) {
+            if (!ss.eof()) {
+                response << "Error: Usage: stream-output [batch-size]" << std::endl;
+                batchSize = 0;
+            } else {
+                batchSize = 1;
+            }
+        } else if (batchSize <= 0) {
+            response << "Error: batch-size must be a positive number." << std::endl;
+        }
+        if (batchSize > 0) {
+            std::shared_ptr<OutputSubscription> subscription = sim->subscribeOutput(ChannelType::TEXT, static_cast<size_t>(batchSize));
+            int notifyFd = subscription->getNotificationFd();
+            if (notifyFd < 0 || !addInterest(epollFd, notifyFd, EPOLLIN)) {
+                sim->unsubscribeOutput(subscription);
+                response << "Error: Could not watch the output channel." << std::endl;
+            } else {
+                connection.stream = subscription;
+                streamsByFd[notifyFd] = &connection;
+                response << "Streaming text output, disconnect to stop." << std::endl;
+            }
+        }
+    } else {
+        cli.execute(line, response);
+        if (command == "help") {
+            response << "Control socket commands:\n"
+                     << "  quit / exit             - Close this connection (the simulation keeps running).\n"
+                     << "  shutdown                - Stop the simulation and the control server.\n"
+                     << "  stream-output [batch]   - Turn this connection into a raw stream of the text output.\n"
+                     << "Every response ends with a line holding only '" << END_OF_RESPONSE << "'." << std::endl;
+        }
+    }
+
+    std::string text = response.str();
+    if (!text.empty() && text.back() != '\n') {
+        text += '\n';
+    }
+    connection.output += text;
+    connection.output += END_OF_RESPONSE;
+    connection.output += '\n';
+}
+
+void ControlServer::drainStream(Connection& connection) {
+    // Purpose: Move waiting output values of a stream into its send buffer.
+    // Parameters: @param connection - a streaming client.
+    // Return: Void.
+    // Key Logic: Takes no more than the buffer has room for; a full buffer pauses the stream until flush catches up.
+    if (!connection.stream) {
+        return;
+    }
+    size_t pending = connection.output.size() - connection.outputSent;
+    if (!connection.streamPaused && pending < MAX_PENDING_OUTPUT) {
+        connection.stream->poll([&connection](const int* values, size_t count) {
+            size_t offset = connection.output.size();
+            connection.output.resize(offset + count);
+            SampleCodec::messagesToBytes(values, count, reinterpret_cast<uint8_t*>(&connection.output[offset]));
+        }, MAX_PENDING_OUTPUT - pending);
+    }
+    if (!connection.streamPaused && connection.output.size() - connection.outputSent >= MAX_PENDING_OUTPUT) {
+        connection.streamPaused = true;
+        setInterest(epollFd, connection.stream->getNotificationFd(), 0);
+    }
+    flush(connection);
+}
+
+bool ControlServer::flush(Connection& connection) {
+    while (connection.outputSent < connection.output.size()) {
+        ssize_t sent = ::send(connection.fd, connection.output.data() + connection.outputSent,
+                              connection.output.size() - connection.outputSent, MSG_NOSIGNAL);
+        if (sent > 0) {
+            connection.outputSent += static_cast<size_t>(sent);
+        } else if (sent < 0 && errno == EINTR) {
+            continue;
+        } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            closeConnection(connection.fd);
+            return false;
+        }
+    }
+
+    bool drained = connection.outputSent == connection.output.size();
+    if (drained) {
+        connection.output.clear();
+        connection.outputSent = 0;
+        if (connection.closeWhenFlushed) {
+            closeConnection(connection.fd);
+            return false;
+        }
+    } else if (connection.outputSent >= connection.output.size() / 2) {
+        connection.output.erase(0, connection.outputSent); // keep the buffer from growing with sent bytes
+        connection.outputSent = 0;
+    }
+    setInterest(epollFd, connection.fd, drained ? EPOLLIN : (EPOLLIN | EPOLLOUT));
+
+    if (connection.streamPaused && drained) {
+        int fd = connection.fd;
+        connection.streamPaused = false;
+        setInterest(epollFd, connection.stream->getNotificationFd(), EPOLLIN);
+        drainStream(connection);
+        return connections.count(fd) > 0;
+    }
+    return true;
+}
+
+void ControlServer::closeConnection(int fd) {
+    auto it = connections.find(fd);
+    if (it == connections.end()) {
+        return;
+    }
+    std::unique_ptr<Connection> connection = std::move(it->second);
+    connections.erase(it);
+    if (connection->stream) {
+        int notifyFd = connection->stream->getNotificationFd();
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, notifyFd, nullptr);
+        streamsByFd.erase(notifyFd);
+        sim->unsubscribeOutput(connection->stream);
+    }
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    clientCount.fetch_sub(1, std::memory_order_relaxed);
+}
@@ -2,9 +2,11 @@
 #include "../headers/Scheduler.h"   // For Scheduler::get()->schedulePayloadForNextStep
 #include "../headers/Payload.h"    // For creating Payload objects
 #include "../headers/util/Serializer.h" // Will be needed for deserializeParameters
+#include "../headers/util/AsyncLogger.h"
 #include <stdexcept>                // For std::runtime_error
 #include <iostream>                 // For potential debug/error logging
 #include <cmath>
+#include <algorithm>
 
 // TODO better comments
 InOperator::InOperator(uint32_t id): Operator(id){
@@ -33,18 +35,16 @@ void InOperator::randomInit(IdRange* idRange, Randomizer* rng){
         return;
     }
 
-    for (int i = 0; i < connectionsToAttempt; ++i) {
-        uint32_t targetId = rng->getInt(idRange->getMinId(), idRange->getMaxId()); // TODO range is uint32 while method is int
-
-        // self-connection 
-        
+    // batched draws, all targets then all distances (see AddOperator::randomInit)
+    std::vector<int> targets(connectionsToAttempt);
+    std::vector<int> distances(connectionsToAttempt);
+    rng->fillInt(targets.data(), targets.size(), idRange->getMinId(), idRange->getMaxId()); // TODO range is uint32 while method is int
+    rng->fillInt(distances.data(), distances.size(), 0, MAX_DISTANCE - 1);
 
-        int distance = rng->getInt(0, MAX_DISTANCE - 1);
+    for (int i = 0; i < connectionsToAttempt; ++i) {
         // Ensure distance is non-negative (should be by uniform_int_distribution if MAX_DISTANCE >= 0)
-        if (distance < 0) distance = 0;
-
-        addConnectionInternal(targetId, distance); // add the connection, no update call
-        
+        int distance = distances[i] < 0 ? 0 : distances[i];
+        addConnectionInternal(static_cast<uint32_t>(targets[i]), distance); // add the connection, no update call
     }
 
 }
@@ -52,30 +52,35 @@ void InOperator::randomInit(IdRange* idRange, Randomizer* rng){
 
 void InOperator::processData() {
 
+    if (droppedThisStep > 0) { // input past the per-step bound was lost, say how much
+        AsyncLogger::get().warn("in_operator.dropped", {
+            {"operator", static_cast<long long>(this->operatorId)},
+            {"dropped", static_cast<long long>(droppedThisStep)},
+            {"limit", static_cast<long long>(MAX_ACCUMULATED_DATA)}});
+        droppedThisStep = 0;
+    }
+
     // only send if actually output connections
-    if (!outputConnections.empty()) {
-
-        for(int value: accumulatedData){ // for each message value, create a payload to its output connections
-            // Create the new payload, starting its journey.
-            // The Payload constructor used here implies the new payload starts at distance 0 for its journey.
-            Payload newPayload(value, this->operatorId); // Using this->operatorId as the source/manager
-
-            // Schedule the new payload to start traveling in the *next* step
-            try {
-                if (Scheduler::get()) { // Ensure scheduler is available
-                     Scheduler::get()->schedulePayloadForNextStep(newPayload);
-                } else {
-                    std::cerr << "InOperator " << getId() << ": Scheduler instance is null. Cannot schedule payload." << std::endl;
+    if (!outputConnections.empty() && !accumulatedData.empty()) {
+        // Schedule the new payloads to start traveling in the *next* step
+        try {
+            Scheduler* scheduler = Scheduler::get(); // single lookup for the whole batch, get() locks the instance mutex
+            if (scheduler) { // Ensure scheduler is available
+                // grow the next step's payload list once for the whole batch
+                scheduler->reservePayloadsForNextStep(accumulatedData.size());
+                for(int value: accumulatedData){ // for each message value, create a payload to its output connections
+                    // constructed in place, starting its journey at distance 0
+                    scheduler->emplacePayloadForNextStep(value, this->operatorId); // Using this->operatorId as the source/manager
                 }
-            } catch (const std::runtime_error& e) {
-                std::cerr << "Error scheduling payload from InOperator " << this->getId() << ": " << e.what() << std::endl;
+            } else {
+                std::cerr << "InOperator " << getId() << ": Scheduler instance is null. Cannot schedule payload." << std::endl;
             }
-
-
+        } catch (const std::runtime_error& e) {
+            std::cerr << "Error scheduling payload from InOperator " << this->getId() << ": " << e.what() << std::endl;
         }
     }
 
-    accumulatedData.clear(); // clear the accumulated data for next message
+    accumulatedData.clear(); // clear the accumulated data for next message, capacity is kept for reuse
 }
 
 
@@ -84,17 +89,35 @@ void InOperator::processData() {
  * @brief This operator has no specific parameters (like weight or threshold) to change.
  * This method does nothing.
  */
-void InOperator::changeParams(const std::vector<int>& params) {
+void InOperator::changeParams(const UpdateParams& params) {
     // Purpose: Fulfill the pure virtual function requirement from the base class.
-    // Parameters: params - A vector of parameters (ignored).
+    // Parameters: params - The update parameters (ignored).
     // Return: Void.
     // Key Logic: OutOperator has no configurable parameters. This method is a no-op.
 }
 
 void InOperator::message(const int payloadData){
+    // bounded, values beyond the per-step limit are dropped (see MAX_ACCUMULATED_DATA)
+    if (accumulatedData.size() >= MAX_ACCUMULATED_DATA) {
+        ++droppedThisStep;
+        ++droppedTotal;
+        return;
+    }
     accumulatedData.push_back(payloadData); 
 }
 
+void InOperator::messageBatch(const int* values, size_t count){
+    size_t room = MAX_ACCUMULATED_DATA - std::min(accumulatedData.size(), MAX_ACCUMULATED_DATA);
+    size_t accepted = std::min(count, room);
+    accumulatedData.insert(accumulatedData.end(), values, values + accepted);
+    droppedThisStep += count - accepted;
+    droppedTotal += count - accepted;
+}
+
+uint64_t InOperator::getDroppedCount() const {
+    return droppedTotal;
+}
+
 
 /**
  * @brief Handles incoming float data by rounding, clamping, and adding it to the accumulator.
@@ -128,7 +151,7 @@ void InOperator::message(const float payloadData) {
         intPayloadData = static_cast<int>(rounded_payload_as_double);
     }
 
-    this->accumulatedData.push_back(intPayloadData);
+    this->message(intPayloadData); // shares the accumulation bound with message(int)
 }
 
 
@@ -164,7 +187,7 @@ void InOperator::message(const double payloadData) {
         intPayloadData = static_cast<int>(rounded_payload_double);
     }
 
-    this->accumulatedData.push_back(intPayloadData);
+    this->message(intPayloadData); // shares the accumulation bound with message(int)
 }
 
 // TODO consider adding implementation to super class and simply modifying the op_type in subclass
@@ -139,12 +139,24 @@ void InputLayer::randomInit(IdRange* connectionRange, Randomizer* randomizer) {
 
 // input text into layers text channel (an operator)
 void InputLayer::inputText(std::string text){
+    inputChars(text.data(), text.size());
+}
+
+void InputLayer::inputChars(const char* data, size_t count){
     // left for readability
     uint32_t textChannelId = reservedRange->getMinId() + textChannelIdOffset; 
-    for (char c : text) {
+    for (size_t i = 0; i < count; ++i) {
         // schedule each, which will then flag the operator for processing
         // TODO magnify the char? Yes or no. NO, input Op just needs more connections or get lucky with ADD ops with low thresholds
-        Scheduler::get()->scheduleMessage(textChannelId, static_cast<int>(c));
+        Scheduler::get()->scheduleMessage(textChannelId, static_cast<int>(data[i]));
         //NOT correct:  operators.at(textChannelId)->message(static_cast<int>(c)); // no need to cast
     }
-}
\ No newline at end of file
+}
+
+void InputLayer::inputSamples(ChannelType channel, const int* values, size_t count){
+    if (count == 0) {
+        return;
+    }
+    uint32_t channelId = reservedRange->getMinId() + static_cast<uint32_t>(channel);
+    Scheduler::get()->scheduleMessages(channelId, values, count);
+}
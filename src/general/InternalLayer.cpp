@@ -4,6 +4,9 @@
 #include "../headers/util/IdRange.h"
 #include "../headers/operators/AddOperator.h"
 #include "../headers/UpdateEvent.h"
+#include "../headers/util/WorkerPool.h"
+#include <algorithm>
+#include <memory>
 
 InternalLayer::InternalLayer(bool isLayerRangeFinal, const std::byte*& currentPayloadData,  const std::byte* endOfPayloadData)
     : Layer(LayerType::INTERNAL_LAYER, isLayerRangeFinal){
@@ -32,6 +35,7 @@ void InternalLayer::randomInit(IdRange* connectionRange, Randomizer* randomizer)
     
     std::vector<Operator*> justCreatedOperators; // Keep track of new ops to connect them
     justCreatedOperators.reserve(numOpsToCreate);
+    operators.reserve(operators.size() + numOpsToCreate);
 
     for (int i = 0; i < numOpsToCreate; ++i) {
         try {
@@ -40,11 +44,11 @@ void InternalLayer::randomInit(IdRange* connectionRange, Randomizer* randomizer)
             // TODO add switch to support randomization of which type of operator to use 
             // For now, we create AddOperator instances. This could be more flexible later.
             Operator* newOp = new AddOperator(newOpId);
-            newOp->randomInit(connectionRange, randomizer); // randomize the operators details
             
             // TODO add more operator types in the future. 
             // Add the new operator to this layer. The addNewOperator method handles validation, and ID update for next operator.
             addNewOperator(newOp);
+            justCreatedOperators.push_back(newOp);
 
         } catch (const std::overflow_error& e) {
             // This happens if a static layer becomes full. Stop creating operators.
@@ -54,4 +58,47 @@ void InternalLayer::randomInit(IdRange* connectionRange, Randomizer* randomizer)
             break; 
         }
     }
-}
\ No newline at end of file
+
+    // 2. Randomize the operators' details, one RNG stream per chunk.
+    size_t chunkCount = (justCreatedOperators.size() + RANDOM_INIT_CHUNK_SIZE - 1) / RANDOM_INIT_CHUNK_SIZE;
+    std::vector<std::unique_ptr<Randomizer>> chunkRandomizers;
+    chunkRandomizers.reserve(chunkCount);
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        std::unique_ptr<Randomizer> child = randomizer->split(); // in chunk order, on this thread
+        if (!child) {
+            chunkRandomizers.clear();
+            break;
+        }
+        chunkRandomizers.push_back(std::move(child));
+    }
+
+    if (chunkRandomizers.empty()) {
+        // Not splittable: draw sequentially from the caller's randomizer, operator by operator
+        for (Operator* op : justCreatedOperators) {
+            op->randomInit(connectionRange, randomizer); // randomize the operators details
+        }
+        return;
+    }
+
+    auto randomizeChunk = [&](size_t chunk) {
+        size_t begin = chunk * RANDOM_INIT_CHUNK_SIZE;
+        size_t end = std::min(begin + RANDOM_INIT_CHUNK_SIZE, justCreatedOperators.size());
+        for (size_t i = begin; i < end; ++i) {
+            justCreatedOperators[i]->randomInit(connectionRange, chunkRandomizers[chunk].get());
+        }
+    };
+
+    // An attached connection index records every new connection. Its stripes are locked, but chunks
+    // running in parallel would fill each target's incoming-edge list in thread timing order, so
+    // getIncoming (and the order connections are removed on delete) would differ between runs of the
+    // same seed. Keep it deterministic by running the chunks on this thread (same streams, same result).
+    if (chunkCount == 1 || connectionIndex != nullptr) {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            randomizeChunk(chunk);
+        }
+        return;
+    }
+    size_t workers = randomInitThreads == 0 ? WorkerPool::defaultWorkerCount() : randomInitThreads - 1;
+    WorkerPool pool(std::min(workers, chunkCount - 1));
+    pool.parallelFor(chunkCount, randomizeChunk);
+}
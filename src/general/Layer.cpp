@@ -3,6 +3,7 @@
 #include "../headers/Payload.h"
 #include "../headers/util/Serializer.h"       // For reading primitive types
 #include "../headers/util/IdRange.h"
+#include "../headers/util/ConnectionIndex.h"
 #include <stdexcept>               // For std::runtime_error
 #include <iostream>
 #include <array>                   // For std::array (if needed for temporary buffers)
@@ -29,9 +30,11 @@ Layer::Layer(Layer&& other) noexcept
       reservedRange(other.reservedRange), // Transfer ownership of the pointer
       currentMinId(other.currentMinId),
       currentMaxId(other.currentMaxId),
-      operators(std::move(other.operators)) {
+      operators(std::move(other.operators)),
+      connectionIndex(other.connectionIndex) {
     // Leave the moved-from object in a safe, destructible state.
     other.reservedRange = nullptr;
+    other.connectionIndex = nullptr;
     other.currentMinId = 0;
     other.currentMaxId = 0;
 }
@@ -55,9 +58,11 @@ Layer& Layer::operator=(Layer&& other) noexcept {
         currentMinId = other.currentMinId;
         currentMaxId = other.currentMaxId;
         operators = std::move(other.operators);
+        connectionIndex = other.connectionIndex;
 
         // 3. Leave 'other' in a safe state
         other.reservedRange = nullptr;
+        other.connectionIndex = nullptr;
         other.currentMinId = 0;
         other.currentMaxId = 0;
     }
@@ -162,6 +167,9 @@ void Layer::addNewOperator(Operator* op) {
 
     updateMinMaxIds(op->getId()); 
     operators[op->getId()] = op;
+    if (connectionIndex != nullptr) {
+        op->setConnectionIndex(connectionIndex); // registers the operator's existing connections
+    }
     
 }
 
@@ -322,6 +330,16 @@ bool Layer::messageOperator(uint32_t operatorId, int message){
 }
 
 
+bool Layer::messageOperatorBatch(uint32_t operatorId, const int* values, size_t count){
+    Operator* op = getOperator(operatorId);
+    if(op == nullptr){
+        return false;
+    }
+    op->messageBatch(values, count);
+    return true;
+}
+
+
 void Layer::processOperatorData(uint32_t operatorId){
     Operator* op = getOperator(operatorId);
     if(op != nullptr){
@@ -351,7 +369,7 @@ void Layer::traverseOperatorPayload(Payload* payload){
  * @param targetOperatorId The ID of the operator to modify.
  * @param params Parameters from the UpdateEvent for the change.
  */
-void Layer::changeOperatorParam(uint32_t targetOperatorId, const std::vector<int>& params) {// TODO temporary, method implementation
+void Layer::changeOperatorParam(uint32_t targetOperatorId, const UpdateParams& params) {// TODO temporary, method implementation
     Operator* op = getOperator(targetOperatorId);
     if (op) {
         op->changeParams(params);
@@ -365,7 +383,7 @@ void Layer::changeOperatorParam(uint32_t targetOperatorId, const std::vector<int
  * @param sourceOperatorId The ID of the operator to add the connection to.
  * @param params Parameters from the UpdateEvent specifying target and distance.
  */
-void Layer::addOperatorConnection(uint32_t sourceOperatorId, const std::vector<int>& params) {// TODO temporary, method implementation
+void Layer::addOperatorConnection(uint32_t sourceOperatorId, const UpdateParams& params) {// TODO temporary, method implementation
     if (params.size() < 2) return;
 
     Operator* op = getOperator(sourceOperatorId);
@@ -381,7 +399,7 @@ void Layer::addOperatorConnection(uint32_t sourceOperatorId, const std::vector<i
  * @param sourceOperatorId The ID of the operator to remove the connection from.
  * @param params Parameters from the UpdateEvent specifying target and distance.
  */
-void Layer::removeOperatorConnection(uint32_t sourceOperatorId, const std::vector<int>& params) {// TODO temporary, method implementation
+void Layer::removeOperatorConnection(uint32_t sourceOperatorId, const UpdateParams& params) {// TODO temporary, method implementation
     if (params.size() < 2) return;
 
     Operator* op = getOperator(sourceOperatorId);
@@ -397,7 +415,7 @@ void Layer::removeOperatorConnection(uint32_t sourceOperatorId, const std::vecto
  * @param sourceOperatorId The ID of the operator whose connection is to be moved.
  * @param params Parameters specifying target, old, and new distances.
  */
-void Layer::moveOperatorConnection(uint32_t sourceOperatorId, const std::vector<int>& params) { // TODO temporary, method implementation
+void Layer::moveOperatorConnection(uint32_t sourceOperatorId, const UpdateParams& params) { // TODO temporary, method implementation
     if (params.size() < 3) return;
 
     Operator* op = getOperator(sourceOperatorId);
@@ -409,6 +427,55 @@ void Layer::moveOperatorConnection(uint32_t sourceOperatorId, const std::vector<
     }
 }
 
+/**
+ * @brief Attaches the layer and all of its operators to a reverse connection index.
+ * @param index The index to keep in sync, nullptr detaches.
+ */
+void Layer::setConnectionIndex(ConnectionIndex* index) {
+    connectionIndex = index;
+    for (auto& entry : operators) {
+        entry.second->setConnectionIndex(index);
+    }
+}
+
+/**
+ * @brief Applies a run of coalesced update events to one operator within this layer.
+ * @param operatorId The ID of the operator every event in the run targets.
+ * @param events The events to apply, in application order.
+ */
+void Layer::applyOperatorUpdates(uint32_t operatorId, const std::vector<UpdateEvent>& events) {
+    Operator* op = getOperator(operatorId);
+    if (op == nullptr) {
+        return; // same as the single event handlers, updates for unknown operators are ignored
+    }
+
+    for (const UpdateEvent& event : events) {
+        const UpdateParams& params = event.params;
+        switch (event.type) {
+            case UpdateType::CHANGE_OPERATOR_PARAMETER:
+                op->changeParams(params);
+                break;
+            case UpdateType::ADD_CONNECTION:
+                if (params.size() >= 2) {
+                    op->addConnectionInternal(static_cast<uint32_t>(params[0]), params[1]);
+                }
+                break;
+            case UpdateType::REMOVE_CONNECTION:
+                if (params.size() >= 2) {
+                    op->removeConnectionInternal(static_cast<uint32_t>(params[0]), params[1]);
+                }
+                break;
+            case UpdateType::MOVE_CONNECTION:
+                if (params.size() >= 3) {
+                    op->moveConnectionInternal(static_cast<uint32_t>(params[0]), params[1], params[2]);
+                }
+                break;
+            default:
+                break; // lifecycle events are handled by MetaController
+        }
+    }
+}
+
 
 /**
  * @brief Creates a new operator within this layer.
@@ -417,7 +484,7 @@ void Layer::moveOperatorConnection(uint32_t sourceOperatorId, const std::vector<
  * specified operator type.
  * @param params Parameters from the UpdateEvent. params[0] is expected to be the Operator::Type to create.
  */
-void Layer::createOperator(const std::vector<int>& params) {  // TODO temporary, method implementation
+void Layer::createOperator(const UpdateParams& params) {  // TODO temporary, method implementation
     // This action is only permitted on dynamic layers.
     if (isRangeFinal) {
         // Optional: Log a warning that an attempt was made to add an operator to a static layer at runtime.
@@ -496,6 +563,9 @@ void Layer::deleteOperator(uint32_t targetOperatorId) {  // TODO temporary, meth
         // Erase the entry from the map.
         operators.erase(it);
 
+        // Its outgoing connections disappear with it, inbound ones are purged by MetaController.
+        opToDelete->setConnectionIndex(nullptr);
+
         // Delete the operator object to free its memory.
         delete opToDelete;
 
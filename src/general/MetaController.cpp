@@ -6,7 +6,10 @@
 #include "../headers/layers/OutputLayer.h"
 #include "../headers/layers/InternalLayer.h"
 #include "../headers/util/Randomizer.h"
-#include "../headers/util/PseudoRandomSource.h"
+#include "../headers/util/PhiloxRandomSource.h"
+#include "../headers/util/ConnectionIndex.h"
+#include "../headers/util/OperatorIdSet.h"
+#include "../headers/util/Tracer.h"
 #include <fstream>
 #include <vector>
 #include <algorithm> // For std::sort in validation
@@ -76,12 +79,13 @@ MetaController::MetaController(const std::string& configPath, Randomizer* random
 MetaController::~MetaController() = default;
 
 void MetaController::randomizeNetwork(int numInternalOperators) {
+    ATHENA_TRACE_SCOPE("MetaController::randomizeNetwork");
     if (numInternalOperators < 0 ) {
         throw std::invalid_argument("Number of internal operators cannot be negative.");
     }
     else if(rand == nullptr){
-        // default to pseudo random
-        rand = new Randomizer(std::make_unique<PseudoRandomSource>());
+        // default to pseudo random (counter-based, reproducible with the default seed)
+        rand = new Randomizer(std::make_unique<PhiloxRandomSource>());
     }
 
 
@@ -141,6 +145,8 @@ void MetaController::randomizeNetwork(int numInternalOperators) {
     // 7. Clean up the connection range object as it's no longer needed.
     // The layers themselves now own their respective reservedRange objects.
     delete fullConnectionRange;
+
+    attachConnectionIndex();
 }
 
 /**
@@ -154,6 +160,68 @@ void MetaController::clearAllLayers() {
     // for each contained Layer object, which in turn is responsible for deleting all
     // the Operator objects it owns. This ensures no memory leaks.
     layers.clear();
+    if (connectionIndex) {
+        connectionIndex->clear(); // every recorded edge belonged to the cleared operators
+    }
+}
+
+/**
+ * @brief Rebuilds the connection index from the current layers, if it is enabled.
+ */
+void MetaController::attachConnectionIndex() {
+    if (!connectionIndex) {
+        return;
+    }
+    connectionIndex->clear();
+    for (const auto& layerPtr : layers) {
+        if (layerPtr) {
+            layerPtr->setConnectionIndex(connectionIndex.get()); // each operator registers its connections
+        }
+    }
+}
+
+/**
+ * @brief Removes every connection pointing at the given operator.
+ * @details Sources are looked up through their layers, removal goes through removeConnectionInternal
+ * so the index stays consistent.
+ */
+void MetaController::purgeIncomingConnections(uint32_t operatorId) {
+    if (!connectionIndex) {
+        return;
+    }
+    for (const IncomingEdge& edge : connectionIndex->getIncoming(operatorId)) {
+        Layer* sourceLayer = findLayerForOperator(edge.sourceId);
+        Operator* source = sourceLayer ? sourceLayer->getOperator(edge.sourceId) : nullptr;
+        if (source) {
+            source->removeConnectionInternal(operatorId, edge.distance);
+        }
+    }
+    connectionIndex->forgetTarget(operatorId); // edges of sources that no longer exist
+}
+
+void MetaController::setConnectionIndexEnabled(bool enabled) {
+    if (enabled == isConnectionIndexEnabled()) {
+        return;
+    }
+    if (enabled) {
+        connectionIndex = std::make_unique<ConnectionIndex>();
+        attachConnectionIndex();
+    } else {
+        for (const auto& layerPtr : layers) {
+            if (layerPtr) {
+                layerPtr->setConnectionIndex(nullptr);
+            }
+        }
+        connectionIndex.reset();
+    }
+}
+
+bool MetaController::isConnectionIndexEnabled() const {
+    return connectionIndex != nullptr;
+}
+
+const ConnectionIndex* MetaController::getConnectionIndex() const {
+    return connectionIndex.get();
 }
 
 
@@ -373,6 +441,11 @@ bool MetaController::messageOp(uint32_t operatorId, int message) {
 
 }
 
+bool MetaController::messageOpBatch(uint32_t operatorId, const int* values, size_t count) {
+    Layer* layer = findLayerForOperator(operatorId);
+    return layer != nullptr && layer->messageOperatorBatch(operatorId, values, count);
+}
+
 void MetaController::processOpData(uint32_t operatorId){
     Layer* layer = findLayerForOperator(operatorId);
     if(layer == nullptr){
@@ -397,6 +470,36 @@ void MetaController::traversePayload(Payload* payload){
     layer->traverseOperatorPayload(payload);
 }
 
+void MetaController::collectPayloadTargets(const Payload& payload, OperatorIdSet& targets) const {
+    // Purpose: Find the operators the payload's next traversal delivers to.
+    // Parameters: @param payload - the traveling payload, @param targets - receives the target IDs.
+    // Return: Void.
+    // Key Logic: Mirrors Operator::traverse, which only delivers to the bucket at payload.distanceTraveled.
+    if (!payload.active) {
+        return;
+    }
+    Operator* source = getOperatorPtr(payload.currentOperatorId);
+    if (source == nullptr) {
+        return;
+    }
+    const std::unordered_set<uint32_t>* targetIds = source->getOutputConnections().get(payload.distanceTraveled);
+    if (targetIds != nullptr) {
+        for (uint32_t targetId : *targetIds) {
+            targets.insert(targetId);
+        }
+    }
+}
+
+void MetaController::collectInputChannelIds(OperatorIdSet& ids) const {
+    for (const auto& layerPtr : layers) {
+        if (dynamic_cast<const InputLayer*>(layerPtr.get()) != nullptr) {
+            for (const auto& entry : layerPtr->getAllOperators()) {
+                ids.insert(entry.first);
+            }
+        }
+    }
+}
+
 
 // --- Update Event Handling ---
 
@@ -404,7 +507,7 @@ void MetaController::traversePayload(Payload* payload){
  * @brief Handles a CREATE_OPERATOR UpdateEvent.
  * @details Finds the single dynamic layer and delegates the operator creation request to it.
  */
-void MetaController::handleCreateOperator(const std::vector<int>& params) {
+void MetaController::handleCreateOperator(const UpdateParams& params) {
     // TODO this is good enough for now but likely want it to allow creation in any layer so long as not past its reserved range
     Layer* dynamicLayer = getDynamicLayer(); // Using your renamed getDynamicLayer()
     if (dynamicLayer) {
@@ -421,7 +524,11 @@ void MetaController::handleCreateOperator(const std::vector<int>& params) {
 void MetaController::handleDeleteOperator(uint32_t targetOperatorId) {
     Layer* targetLayer = findLayerForOperator(targetOperatorId);
     if (targetLayer) {
+        bool existed = targetLayer->getOperator(targetOperatorId) != nullptr;
         targetLayer->deleteOperator(targetOperatorId);
+        if (existed && targetLayer->getOperator(targetOperatorId) == nullptr) {
+            purgeIncomingConnections(targetOperatorId); // no-op unless the connection index is enabled
+        }
     } else {
         // Optional: Log warning - could not find layer for operator to be deleted.
     }
@@ -430,7 +537,7 @@ void MetaController::handleDeleteOperator(uint32_t targetOperatorId) {
 /**
  * @brief Delegates a parameter change request to the appropriate layer.
  */
-void MetaController::handleParameterChange(uint32_t targetOperatorId, const std::vector<int>& params) {
+void MetaController::handleParameterChange(uint32_t targetOperatorId, const UpdateParams& params) {
     Layer* targetLayer = findLayerForOperator(targetOperatorId);
     if (targetLayer) {
         targetLayer->changeOperatorParam(targetOperatorId, params);
@@ -440,7 +547,7 @@ void MetaController::handleParameterChange(uint32_t targetOperatorId, const std:
 /**
  * @brief Delegates a request to add a connection to the appropriate layer.
  */
-void MetaController::handleAddConnection(uint32_t targetOperatorId, const std::vector<int>& params) {
+void MetaController::handleAddConnection(uint32_t targetOperatorId, const UpdateParams& params) {
     Layer* targetLayer = findLayerForOperator(targetOperatorId);
     if (targetLayer) {
         targetLayer->addOperatorConnection(targetOperatorId, params);
@@ -450,7 +557,7 @@ void MetaController::handleAddConnection(uint32_t targetOperatorId, const std::v
 /**
  * @brief Delegates a request to remove a connection from an operator in the appropriate layer.
  */
-void MetaController::handleRemoveConnection(uint32_t targetOperatorId, const std::vector<int>& params) {
+void MetaController::handleRemoveConnection(uint32_t targetOperatorId, const UpdateParams& params) {
     Layer* targetLayer = findLayerForOperator(targetOperatorId);
     if (targetLayer) {
         targetLayer->removeOperatorConnection(targetOperatorId, params);
@@ -460,13 +567,26 @@ void MetaController::handleRemoveConnection(uint32_t targetOperatorId, const std
 /**
  * @brief Delegates a request to move a connection for an operator in the appropriate layer.
  */
-void MetaController::handleMoveConnection(uint32_t targetOperatorId, const std::vector<int>& params) {
+void MetaController::handleMoveConnection(uint32_t targetOperatorId, const UpdateParams& params) {
     Layer* targetLayer = findLayerForOperator(targetOperatorId);
     if (targetLayer) {
         targetLayer->moveOperatorConnection(targetOperatorId, params);
     }
 }
 
+/**
+ * @brief Delegates a run of coalesced events for one operator to the appropriate layer.
+ */
+void MetaController::handleOperatorUpdates(uint32_t targetOperatorId, const std::vector<UpdateEvent>& events) {
+    if (events.empty()) {
+        return;
+    }
+    Layer* targetLayer = findLayerForOperator(targetOperatorId);
+    if (targetLayer) {
+        targetLayer->applyOperatorUpdates(targetOperatorId, events);
+    }
+}
+
 int MetaController::getTextCount(){
     OutputLayer* outputLayer = getOutputLayer();
     if(outputLayer == nullptr){
@@ -476,6 +596,11 @@ int MetaController::getTextCount(){
 }
 
 
+OutOperator* MetaController::getOutputChannel(ChannelType channel){
+    OutputLayer* outputLayer = getOutputLayer();
+    return outputLayer == nullptr ? nullptr : outputLayer->getChannelOperator(channel);
+}
+
 void MetaController::clearTextOutput(){
     OutputLayer* outputLayer = getOutputLayer();
     if(outputLayer == nullptr){
@@ -512,6 +637,26 @@ bool MetaController::inputText(std::string text){
     return false;
 }
 
+bool MetaController::inputChars(const char* data, size_t count){
+    for (const auto& layerPtr : layers) {
+        if (auto* inputLayer = dynamic_cast<InputLayer*>(layerPtr.get())) {
+            inputLayer->inputChars(data, count);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MetaController::inputSamples(ChannelType channel, const int* values, size_t count){
+    for (const auto& layerPtr : layers) {
+        if (auto* inputLayer = dynamic_cast<InputLayer*>(layerPtr.get())) {
+            inputLayer->inputSamples(channel, values, count);
+            return true;
+        }
+    }
+    return false;
+}
+
 
 bool MetaController::isEmpty() const {
     return getOpCount() == 0; 
@@ -526,6 +671,7 @@ bool MetaController::isEmpty() const {
  * @return True if saving was successful, false otherwise.
  */
 bool MetaController::saveConfiguration(const std::string& filePath) const {
+    ATHENA_TRACE_SCOPE("MetaController::saveConfiguration");
     // Purpose: Persist the entire network state by serializing each layer sequentially.
     // Parameters: filePath - The destination for the configuration file.
     // Return: True on success, false on file I/O error.
@@ -567,6 +713,7 @@ bool MetaController::saveConfiguration(const std::string& filePath) const {
  * @return True if loading and validation were successful, false otherwise.
  */
 bool MetaController::loadConfiguration(const std::string& filePath) {
+    ATHENA_TRACE_SCOPE("MetaController::loadConfiguration");
     clearAllLayers(); // Always start with a clean slate
 
     std::ifstream inFile(filePath, std::ios::binary | std::ios::ate); // Open at end to get size
@@ -654,6 +801,7 @@ bool MetaController::loadConfiguration(const std::string& filePath) {
         throw; // Re-throw the validation error.
     }
 
+    attachConnectionIndex();
 
     return true;
 }
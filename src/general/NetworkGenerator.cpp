@@ -0,0 +1,332 @@
+#include "../headers/util/NetworkGenerator.h"
+#include "../headers/util/Serializer.h"
+#include "../headers/util/Philox.h"
+#include "../headers/util/WorkerPool.h"
+#include "../headers/util/Tracer.h"
+#include "../headers/layers/LayerType.h"
+#include "../headers/operators/Operator.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    // Stream purposes, so the draws of one kind never shift the draws of another
+    constexpr uint64_t CONNECTION_STREAM = 1;
+    constexpr uint64_t PARAMETER_STREAM = 2;
+
+    /**
+     * @brief The Philox substream of one operator: stream ID = (purpose, operator ID), so any
+     * operator's draws can be rebuilt from the seed alone, in any order and on any thread.
+     */
+    Philox operatorStream(uint64_t seed, uint32_t operatorId, uint64_t purpose) {
+        return Philox(seed, (purpose << 32) | operatorId);
+    }
+
+    void patchUint32(std::vector<std::byte>& buffer, size_t offset, uint32_t value) {
+        // same big-endian layout as Serializer::write(uint32_t)
+        for (int i = 0; i < 4; ++i) {
+            buffer[offset + i] = static_cast<std::byte>((value >> (24 - 8 * i)) & 0xFF);
+        }
+    }
+
+    /**
+     * @brief Encodes an operator block: size prefix, type, ID and the distance buckets (Operator::serializeToBytes).
+     * @return Offset of the size prefix, patched by finishOperator once the derived fields are appended.
+     */
+    size_t beginOperator(std::vector<std::byte>& buffer, Operator::Type type, uint32_t operatorId,
+                         const std::vector<NetworkGenerator::Connection>& connections) {
+        size_t sizeOffset = buffer.size();
+        Serializer::write(buffer, static_cast<uint32_t>(0));
+        Serializer::write(buffer, static_cast<uint16_t>(type));
+        Serializer::write(buffer, operatorId);
+
+        uint16_t bucketCount = 0;
+        for (size_t i = 0; i < connections.size(); ++i) {
+            if (i == 0 || connections[i].distance != connections[i - 1].distance) ++bucketCount;
+        }
+        Serializer::write(buffer, bucketCount);
+
+        for (size_t begin = 0; begin < connections.size();) {
+            size_t end = begin;
+            while (end < connections.size() && connections[end].distance == connections[begin].distance) ++end;
+            Serializer::write(buffer, connections[begin].distance);
+            Serializer::write(buffer, static_cast<uint16_t>(end - begin));
+            for (size_t i = begin; i < end; ++i) {
+                Serializer::write(buffer, connections[i].target);
+            }
+            begin = end;
+        }
+        return sizeOffset;
+    }
+
+    void finishOperator(std::vector<std::byte>& buffer, size_t sizeOffset) {
+        patchUint32(buffer, sizeOffset, static_cast<uint32_t>(buffer.size() - sizeOffset - sizeof(uint32_t)));
+    }
+
+    /**
+     * @brief Encodes a layer block (Layer::serializeToBytes) around already encoded operators.
+     */
+    std::vector<std::byte> layerBlock(LayerType type, bool isRangeFinal, uint32_t minId, uint32_t maxId,
+                                      const std::vector<std::byte>& operatorBytes) {
+        std::vector<std::byte> block;
+        Serializer::write(block, static_cast<uint8_t>(type));
+        Serializer::write(block, static_cast<uint8_t>(isRangeFinal ? 1 : 0));
+        Serializer::write(block, static_cast<uint32_t>(2 * sizeof(uint32_t) + operatorBytes.size()));
+        Serializer::write(block, minId);
+        Serializer::write(block, maxId);
+        block.insert(block.end(), operatorBytes.begin(), operatorBytes.end());
+        return block;
+    }
+
+    void sortUnique(std::vector<NetworkGenerator::Connection>& connections) {
+        std::sort(connections.begin(), connections.end());
+        connections.erase(std::unique(connections.begin(), connections.end()), connections.end());
+    }
+}
+
+NetworkGenerator::NetworkGenerator(const NetworkSpec& networkSpec) : spec(networkSpec)
+{
+    // Purpose: Validate the spec and derive the connection range.
+    // Parameters: @param networkSpec - the network to build.
+    // Key Logic: Limits follow the configuration format (uint16 distances and per-bucket counts)
+    // and AddOperator's MAX_DISTANCE.
+    if (spec.internalOperators > std::numeric_limits<uint32_t>::max() - INTERNAL_MIN_ID) {
+        throw std::invalid_argument("Too many internal operators for 32-bit operator IDs.");
+    }
+    if (!(spec.meanDegree >= 0.0) || !std::isfinite(spec.meanDegree)) {
+        throw std::invalid_argument("Mean degree must be a finite, non-negative number.");
+    }
+    if (spec.maxDegree > std::numeric_limits<uint16_t>::max() || spec.inputDegree > std::numeric_limits<uint16_t>::max()) {
+        throw std::invalid_argument("Degree limits cannot exceed 65535 connections per operator.");
+    }
+    if (spec.maxDistance == 0 || spec.maxDistance > static_cast<uint32_t>(AddOperator::MAX_DISTANCE)) {
+        throw std::invalid_argument("Max distance must be in [1, " + std::to_string(AddOperator::MAX_DISTANCE) + "].");
+    }
+    if (spec.degreeModel == NetworkSpec::DegreeModel::POWER_LAW && !(spec.powerLawExponent > 2.0)) {
+        throw std::invalid_argument("Power-law exponent must be greater than 2.");
+    }
+    if (!(spec.rewireProbability >= 0.0 && spec.rewireProbability <= 1.0)) {
+        throw std::invalid_argument("Rewire probability must be in [0, 1].");
+    }
+    if (!(spec.meanDistance >= 0.0) || !std::isfinite(spec.meanDistance)) {
+        throw std::invalid_argument("Mean distance must be a finite, non-negative number.");
+    }
+
+    connectionMinId = OUTPUT_MIN_ID;
+    connectionMaxId = spec.internalOperators > 0 ? INTERNAL_MIN_ID + spec.internalOperators - 1 : INTERNAL_MIN_ID - 1;
+    // Pareto with scale x_m and exponent a has mean x_m * (a - 1) / (a - 2)
+    double exponent = spec.powerLawExponent;
+    powerLawMinDegree = exponent > 2.0 ? spec.meanDegree * (exponent - 2.0) / (exponent - 1.0) : 0.0;
+}
+
+void NetworkGenerator::generateConnections(uint32_t operatorId, std::vector<Connection>& out) const
+{
+    // Purpose: Draw the outgoing connections of one internal operator.
+    // Parameters: @param operatorId - internal operator, @param out - receives the connections.
+    // Return: Void.
+    // Key Logic: Degree from the degree model, targets uniform over the connection range except
+    // the operator itself (SMALL_WORLD starts from ring neighbours), distance per connection from
+    // the distance model. Duplicates collapse, as they would in the operator's bucket sets.
+    out.clear();
+    Philox stream = operatorStream(spec.seed, operatorId, CONNECTION_STREAM);
+    uint32_t rangeSize = connectionMaxId - connectionMinId + 1;
+    if (rangeSize < 2) {
+        return; // the operator itself is the only target
+    }
+
+    auto drawTarget = [&]() {
+        uint32_t target = connectionMinId + stream.below(rangeSize - 1);
+        return target >= operatorId ? target + 1 : target; // skip self
+    };
+    auto drawDistance = [&]() -> uint16_t {
+        if (spec.distanceModel == NetworkSpec::DistanceModel::UNIFORM) {
+            return static_cast<uint16_t>(stream.below(spec.maxDistance));
+        }
+        if (spec.meanDistance <= 0.0) {
+            return 0;
+        }
+        double failure = spec.meanDistance / (spec.meanDistance + 1.0); // geometric on {0, 1, ...} with this mean
+        double distance = std::floor(std::log1p(-stream.getDouble(0.0, 1.0)) / std::log(failure));
+        return static_cast<uint16_t>(std::min(distance, static_cast<double>(spec.maxDistance - 1)));
+    };
+
+    uint32_t degree = 0;
+    switch (spec.degreeModel) {
+        case NetworkSpec::DegreeModel::UNIFORM:
+            degree = stream.below(static_cast<uint32_t>(std::llround(2.0 * spec.meanDegree)) + 1);
+            break;
+        case NetworkSpec::DegreeModel::POWER_LAW: {
+            double draw = powerLawMinDegree * std::pow(1.0 - stream.getDouble(0.0, 1.0), -1.0 / (spec.powerLawExponent - 1.0));
+            degree = static_cast<uint32_t>(std::min(draw, static_cast<double>(spec.maxDegree)));
+            break;
+        }
+        case NetworkSpec::DegreeModel::SMALL_WORLD:
+            degree = static_cast<uint32_t>(std::llround(spec.meanDegree));
+            break;
+    }
+    degree = std::min(degree, spec.maxDegree);
+    out.reserve(degree);
+
+    uint32_t ringIndex = operatorId - INTERNAL_MIN_ID;
+    for (uint32_t i = 0; i < degree; ++i) {
+        uint32_t target;
+        if (spec.degreeModel == NetworkSpec::DegreeModel::SMALL_WORLD && stream.getDouble(0.0, 1.0) >= spec.rewireProbability) {
+            target = INTERNAL_MIN_ID + static_cast<uint32_t>((static_cast<uint64_t>(ringIndex) + i + 1) % spec.internalOperators);
+            if (target == operatorId) {
+                continue; // ring shorter than the degree
+            }
+        } else {
+            target = drawTarget();
+        }
+        out.push_back({drawDistance(), target});
+    }
+    sortUnique(out);
+}
+
+void NetworkGenerator::generateChannelConnections(uint32_t channelId, std::vector<Connection>& out) const
+{
+    // Input channels are not in the connection range, so every target is valid
+    out.clear();
+    Philox stream = operatorStream(spec.seed, channelId, CONNECTION_STREAM);
+    uint32_t rangeSize = connectionMaxId - connectionMinId + 1;
+    out.reserve(spec.inputDegree);
+    for (uint32_t i = 0; i < spec.inputDegree; ++i) {
+        uint32_t target = connectionMinId + stream.below(rangeSize);
+        out.push_back({static_cast<uint16_t>(stream.below(spec.maxDistance)), target});
+    }
+    sortUnique(out);
+}
+
+std::pair<int, int> NetworkGenerator::generateParameters(uint32_t operatorId) const
+{
+    Philox stream = operatorStream(spec.seed, operatorId, PARAMETER_STREAM);
+    int weight = AddOperator::MIN_WEIGHT + static_cast<int>(stream.below(AddOperator::MAX_WEIGHT - AddOperator::MIN_WEIGHT + 1));
+    int threshold = AddOperator::MIN_THRESHOLD + static_cast<int>(stream.below(AddOperator::MAX_THRESHOLD - AddOperator::MIN_THRESHOLD + 1));
+    return {weight, threshold};
+}
+
+void NetworkGenerator::encodeInternalOperator(uint32_t operatorId, std::vector<Connection>& scratch,
+                                              std::vector<std::byte>& buffer, uint64_t& connections) const
+{
+    // AddOperator::serializeToBytes layout: base fields, then weight, threshold, accumulateData
+    generateConnections(operatorId, scratch);
+    connections += scratch.size();
+    size_t sizeOffset = beginOperator(buffer, Operator::Type::ADD, operatorId, scratch);
+    std::pair<int, int> parameters = generateParameters(operatorId);
+    Serializer::write(buffer, parameters.first);
+    Serializer::write(buffer, parameters.second);
+    Serializer::write(buffer, 0); // accumulateData
+    finishOperator(buffer, sizeOffset);
+}
+
+bool NetworkGenerator::writeConfiguration(const std::string& filePath, GeneratedNetworkInfo* info) const
+{
+    ATHENA_TRACE_SCOPE("NetworkGenerator::writeConfiguration");
+    // Purpose: Generate the network and write it in the configuration file format.
+    // Parameters: @param filePath - destination, @param info - optional totals.
+    // Return: @return True if the whole file was written.
+    // Key Logic:
+    // 1. Input and output layers are tiny and encoded up front.
+    // 2. The internal layer header is written with a placeholder size. Operators are encoded in waves
+    //    of CHUNK_SIZE chunks, one chunk per WorkerPool task, and appended in ID order.
+    // 3. The layer size is patched at the end (the format limits a layer to UINT32_MAX bytes).
+    std::ofstream outFile(filePath, std::ios::binary | std::ios::trunc);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Could not open file for writing generated network: " << filePath << std::endl;
+        return false;
+    }
+
+    GeneratedNetworkInfo totals;
+    std::vector<Connection> scratch;
+
+    // 1. Input channels (InOperator, no derived fields) and output channels (OutOperator, empty data)
+    std::vector<std::byte> channelBytes;
+    for (uint32_t channel = 0; channel < CHANNEL_COUNT; ++channel) {
+        generateChannelConnections(INPUT_MIN_ID + channel, scratch);
+        totals.connections += scratch.size();
+        size_t sizeOffset = beginOperator(channelBytes, Operator::Type::IN, INPUT_MIN_ID + channel, scratch);
+        finishOperator(channelBytes, sizeOffset);
+    }
+    std::vector<std::byte> block = layerBlock(LayerType::INPUT_LAYER, true, INPUT_MIN_ID, OUTPUT_MIN_ID - 1, channelBytes);
+    outFile.write(reinterpret_cast<const char*>(block.data()), block.size());
+
+    channelBytes.clear();
+    scratch.clear();
+    for (uint32_t channel = 0; channel < CHANNEL_COUNT; ++channel) {
+        size_t sizeOffset = beginOperator(channelBytes, Operator::Type::OUT, OUTPUT_MIN_ID + channel, scratch);
+        Serializer::write(channelBytes, static_cast<uint16_t>(0)); // data count
+        finishOperator(channelBytes, sizeOffset);
+    }
+    block = layerBlock(LayerType::OUTPUT_LAYER, true, OUTPUT_MIN_ID, INTERNAL_MIN_ID - 1, channelBytes);
+    outFile.write(reinterpret_cast<const char*>(block.data()), block.size());
+    totals.operators = 2 * CHANNEL_COUNT;
+
+    // 2. Internal layer (dynamic range, as created by randomizeNetwork)
+    uint32_t internalMaxId = spec.internalOperators > 0 ? INTERNAL_MIN_ID + spec.internalOperators - 1 : INTERNAL_MIN_ID;
+    block = layerBlock(LayerType::INTERNAL_LAYER, false, INTERNAL_MIN_ID, internalMaxId, {});
+    std::streamoff sizeFieldOffset = static_cast<std::streamoff>(outFile.tellp()) + 2; // after type and flag
+    outFile.write(reinterpret_cast<const char*>(block.data()), block.size());
+    uint64_t payloadBytes = 2 * sizeof(uint32_t);
+
+    size_t workers = spec.threads == 0 ? WorkerPool::defaultWorkerCount() : spec.threads - 1;
+    WorkerPool pool(workers);
+    size_t chunkCount = (static_cast<size_t>(spec.internalOperators) + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    size_t wave = pool.getThreadCount() * 2;
+    std::vector<std::vector<std::byte>> chunkBytes(wave);
+    std::vector<uint64_t> chunkConnections(wave);
+
+    for (size_t firstChunk = 0; firstChunk < chunkCount && outFile.good(); firstChunk += wave) {
+        size_t waveChunks = std::min(wave, chunkCount - firstChunk);
+        pool.parallelFor(waveChunks, [&](size_t task) {
+            std::vector<Connection> localScratch;
+            std::vector<std::byte>& bytes = chunkBytes[task];
+            bytes.clear();
+            chunkConnections[task] = 0;
+            uint64_t begin = static_cast<uint64_t>(firstChunk + task) * CHUNK_SIZE;
+            uint64_t end = std::min<uint64_t>(begin + CHUNK_SIZE, spec.internalOperators);
+            for (uint64_t index = begin; index < end; ++index) {
+                encodeInternalOperator(INTERNAL_MIN_ID + static_cast<uint32_t>(index), localScratch, bytes, chunkConnections[task]);
+            }
+        });
+        for (size_t task = 0; task < waveChunks; ++task) {
+            payloadBytes += chunkBytes[task].size();
+            totals.connections += chunkConnections[task];
+            outFile.write(reinterpret_cast<const char*>(chunkBytes[task].data()), chunkBytes[task].size());
+        }
+        if (payloadBytes > std::numeric_limits<uint32_t>::max()) {
+            std::cerr << "Error: Generated internal layer exceeds the 4 GiB layer limit of the configuration format, "
+                      << "reduce the operator count or degree." << std::endl;
+            return false;
+        }
+    }
+    totals.operators += spec.internalOperators;
+
+    // 3. Patch the internal layer size
+    std::vector<std::byte> sizeField;
+    Serializer::write(sizeField, static_cast<uint32_t>(payloadBytes));
+    outFile.seekp(sizeFieldOffset);
+    outFile.write(reinterpret_cast<const char*>(sizeField.data()), sizeField.size());
+    outFile.seekp(0, std::ios::end);
+    totals.bytes = static_cast<uint64_t>(outFile.tellp());
+
+    outFile.close();
+    if (!outFile.good()) {
+        std::cerr << "Error: Failed writing generated network to: " << filePath << std::endl;
+        return false;
+    }
+    if (info) {
+        *info = totals;
+    }
+    return true;
+}
+
+bool NetworkGenerator::parseDegreeModel(const std::string& name, NetworkSpec::DegreeModel& model)
+{
+    if (name == "uniform")     { model = NetworkSpec::DegreeModel::UNIFORM;     return true; }
+    if (name == "power-law")   { model = NetworkSpec::DegreeModel::POWER_LAW;   return true; }
+    if (name == "small-world") { model = NetworkSpec::DegreeModel::SMALL_WORLD; return true; }
+    return false;
+}
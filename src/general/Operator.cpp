@@ -2,6 +2,7 @@
 #include "../headers/Scheduler.h"
 #include "../headers/UpdateScheduler.h"
 #include "../headers/util/DynamicArray.h"
+#include "../headers/util/ConnectionIndex.h"
 #include <algorithm> // Required for std::sort
 #include <vector>    // Required for std::vector
 #include <utility>   // Required for std::pair
@@ -86,6 +87,12 @@ void Operator::validate(){
 }
 
 
+void Operator::messageBatch(const int* values, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        message(values[i]);
+    }
+}
+
 /**
  * @brief Manages the traversal progression of an outgoing payload originating from this Operator.
  * @param payload The payload currently traversing (passed by reference to modify its state).
@@ -121,7 +128,8 @@ void Operator::traverse(Payload* payload) {
             try {
                     Scheduler::get()->scheduleMessage(targetId, payload->message);
                     // Note: Dangling ID detection happens implicitly if TimeController::deliverAndFlagOperator
-                    // fails to find the target Operator*. We rely on requestUpdate for cleanup.
+                    // fails to find the target Operator*. With MetaController's connection index enabled,
+                    // deleting an operator already removes the connections pointing at it.
             } catch (const std::runtime_error& e) {
                 // Handle error if Scheduler instance is not available (e.g., log)
                 // std::cerr << "Error scheduling message: " << e.what() << std::endl;
@@ -162,7 +170,7 @@ void Operator::traverse(Payload* payload) {
  * UpdateController via the UpdateScheduler static interface. Used for internal
  * self-modification requests or triggered cleanup actions (like removing dangling connections).
  */
-void Operator::requestUpdate(UpdateType type, const std::vector<int>& params){
+void Operator::requestUpdate(UpdateType type, const UpdateParams& params){
     UpdateEvent event(type, this->operatorId, params);
     
     try {
@@ -198,7 +206,10 @@ void Operator::addConnectionInternal(uint32_t targetOperatorId, int distance) {
     // THE BUG: This 'insert' is called on the OLD value of targetsPtr if it wasn't null.
     // The pointer that was freshly created is not used here.
     // If targetsPtr was NOT null, it inserts into that. If it WAS null, it inserts into a garbage pointer.
-    targetsPtr->insert(targetOperatorId);
+    bool inserted = targetsPtr->insert(targetOperatorId).second;
+    if (inserted && incomingIndex != nullptr) {
+        incomingIndex->addEdge(operatorId, targetOperatorId, distance);
+    }
 }
 
 
@@ -217,7 +228,10 @@ void Operator::removeConnectionInternal(uint32_t targetOperatorId, int distance)
     std::unordered_set<uint32_t>* targetsPtr = outputConnections.get(distance); // mutable
 
     if (targetsPtr != nullptr) {
-        targetsPtr->erase(targetOperatorId); // Remove element using set's erase
+        size_t erased = targetsPtr->erase(targetOperatorId); // Remove element using set's erase
+        if (erased > 0 && incomingIndex != nullptr) {
+            incomingIndex->removeEdge(operatorId, targetOperatorId, distance);
+        }
         // TODO update maxID ?
         // If the set is now empty, remove it from DynamicArray
         if (targetsPtr->empty()) {
@@ -269,6 +283,26 @@ const DynamicArray<std::unordered_set<uint32_t>>& Operator::getOutputConnections
     return this->outputConnections; 
 }
 
+void Operator::setConnectionIndex(ConnectionIndex* index) {
+    // no shortcut for the same index: after ConnectionIndex::clear() the edges must be registered again,
+    // and removing before adding keeps them counted once if they were still present
+    for (int distance = 0; distance <= outputConnections.maxIdx(); ++distance) {
+        const std::unordered_set<uint32_t>* targetsPtr = outputConnections.get(distance);
+        if (targetsPtr == nullptr) {
+            continue;
+        }
+        for (uint32_t targetId : *targetsPtr) {
+            if (incomingIndex != nullptr) {
+                incomingIndex->removeEdge(operatorId, targetId, distance);
+            }
+            if (index != nullptr) {
+                index->addEdge(operatorId, targetId, distance);
+            }
+        }
+    }
+    incomingIndex = index;
+}
+
 
 std::string Operator::typeToString(Operator::Type type) {
     switch (type) {
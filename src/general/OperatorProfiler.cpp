@@ -0,0 +1,199 @@
+#include "../headers/util/OperatorProfiler.h"
+#include "../headers/controllers/MetaController.h"
+#include "../headers/layers/Layer.h"
+#include "../headers/operators/Operator.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <unordered_set>
+
+namespace {
+    uint32_t metricValue(const OperatorCounters& entry, OperatorProfiler::Metric metric) {
+        switch (metric) {
+            case OperatorProfiler::Metric::DELIVERIES: return entry.deliveries;
+            case OperatorProfiler::Metric::FIRES:      return entry.fires;
+            case OperatorProfiler::Metric::EMITTED:    return entry.emitted;
+            case OperatorProfiler::Metric::TRAVERSALS: return entry.traversals;
+        }
+        return 0;
+    }
+
+    const char* metricName(OperatorProfiler::Metric metric) {
+        switch (metric) {
+            case OperatorProfiler::Metric::DELIVERIES: return "deliveries";
+            case OperatorProfiler::Metric::FIRES:      return "fires";
+            case OperatorProfiler::Metric::EMITTED:    return "emitted";
+            case OperatorProfiler::Metric::TRAVERSALS: return "traversals";
+        }
+        return "unknown";
+    }
+
+    void addToBucket(std::vector<uint64_t>& histogram, uint64_t value) {
+        size_t bucket = OperatorProfiler::bucketIndex(value);
+        if (bucket >= histogram.size()) {
+            histogram.resize(bucket + 1, 0);
+        }
+        ++histogram[bucket];
+    }
+
+    void printHistogram(std::ostringstream& out, const char* title, const std::vector<uint64_t>& histogram) {
+        out << "--- " << title << " ---\n";
+        if (histogram.empty()) {
+            out << "  (empty)\n";
+            return;
+        }
+        for (size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+            out << "  " << std::left << std::setw(14) << OperatorProfiler::bucketLabel(bucket)
+                << std::right << std::setw(12) << histogram[bucket] << "\n";
+        }
+    }
+}
+
+void OperatorProfiler::reserve(uint32_t maxOperatorId)
+{
+    if (static_cast<size_t>(maxOperatorId) + 1 > counters.size()) {
+        counters.resize(static_cast<size_t>(maxOperatorId) + 1);
+    }
+}
+
+OperatorCounters OperatorProfiler::getCounters(uint32_t operatorId) const
+{
+    if (operatorId >= counters.size()) {
+        return OperatorCounters{};
+    }
+    return counters[operatorId];
+}
+
+std::vector<std::pair<uint32_t, OperatorCounters>> OperatorProfiler::topK(size_t k, Metric metric) const
+{
+    // Purpose: Rank operators by one counter.
+    // Parameters: @param k - entries wanted, @param metric - ranking counter.
+    // Return: @return The top entries, highest first.
+    // Key Logic: Collect non-zero entries, partial_sort the first k (ties broken by ID so the report is stable).
+    std::vector<std::pair<uint32_t, OperatorCounters>> ranked;
+    for (size_t id = 0; id < counters.size(); ++id) {
+        if (metricValue(counters[id], metric) > 0) {
+            ranked.emplace_back(static_cast<uint32_t>(id), counters[id]);
+        }
+    }
+    size_t count = std::min(k, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(),
+        [metric](const auto& a, const auto& b) {
+            uint32_t valueA = metricValue(a.second, metric);
+            uint32_t valueB = metricValue(b.second, metric);
+            return valueA != valueB ? valueA > valueB : a.first < b.first;
+        });
+    ranked.resize(count);
+    return ranked;
+}
+
+void OperatorProfiler::clear()
+{
+    // keep the allocation, the next run on the same network records into the same IDs
+    std::fill(counters.begin(), counters.end(), OperatorCounters{});
+}
+
+DegreeHistograms OperatorProfiler::buildDegreeHistograms(const MetaController& metaController)
+{
+    // Purpose: Summarize the network structure from every operator's outputConnections.
+    // Parameters: @param metaController - the network to inspect.
+    // Return: @return DegreeHistograms - bucketed out-degree, in-degree and distance histograms.
+    // Key Logic: One pass over all operators counts out-degree and distances and accumulates
+    // in-degree per target ID in a dense array. In-degree is then binned for existing operators only,
+    // edges to missing targets are reported as dangling.
+    DegreeHistograms histograms;
+    std::vector<uint32_t> inDegree;
+    std::unordered_set<uint32_t> existingIds;
+
+    for (const auto& layer : metaController.getAllLayers()) {
+        if (!layer) continue;
+        for (const auto& [operatorId, op] : layer->getAllOperators()) {
+            if (!op) continue;
+            existingIds.insert(operatorId);
+            ++histograms.operatorCount;
+
+            uint64_t outDegree = 0;
+            const auto& connections = op->getOutputConnections();
+            for (int distance = 0; distance <= connections.maxIdx(); ++distance) {
+                const std::unordered_set<uint32_t>* targets = connections.get(distance);
+                if (!targets) continue;
+                for (uint32_t target : *targets) {
+                    if (target >= inDegree.size()) {
+                        inDegree.resize(static_cast<size_t>(target) + 1, 0);
+                    }
+                    ++inDegree[target];
+                    addToBucket(histograms.distance, static_cast<uint64_t>(distance));
+                }
+                outDegree += targets->size();
+            }
+            histograms.connectionCount += outDegree;
+            addToBucket(histograms.outDegree, outDegree);
+        }
+    }
+
+    for (uint32_t operatorId : existingIds) {
+        addToBucket(histograms.inDegree, operatorId < inDegree.size() ? inDegree[operatorId] : 0);
+    }
+    for (size_t target = 0; target < inDegree.size(); ++target) {
+        if (inDegree[target] > 0 && existingIds.count(static_cast<uint32_t>(target)) == 0) {
+            histograms.danglingConnections += inDegree[target];
+        }
+    }
+    return histograms;
+}
+
+std::string OperatorProfiler::buildReport(const MetaController& metaController, size_t k, Metric metric) const
+{
+    std::ostringstream out;
+    out << "--- Top " << k << " Operators by " << metricName(metric) << " ---\n";
+    out << "  " << std::left << std::setw(12) << "id" << std::right
+        << std::setw(12) << "deliveries" << std::setw(12) << "fires"
+        << std::setw(12) << "emitted" << std::setw(12) << "traversals" << "\n";
+    std::vector<std::pair<uint32_t, OperatorCounters>> top = topK(k, metric);
+    if (top.empty()) {
+        out << "  (no activity recorded)\n";
+    }
+    for (const auto& [operatorId, entry] : top) {
+        out << "  " << std::left << std::setw(12) << operatorId << std::right
+            << std::setw(12) << entry.deliveries << std::setw(12) << entry.fires
+            << std::setw(12) << entry.emitted << std::setw(12) << entry.traversals << "\n";
+    }
+
+    DegreeHistograms histograms = buildDegreeHistograms(metaController);
+    out << "Operators: " << histograms.operatorCount
+        << ", Connections: " << histograms.connectionCount
+        << ", Dangling: " << histograms.danglingConnections << "\n";
+    printHistogram(out, "Out-degree (operators)", histograms.outDegree);
+    printHistogram(out, "In-degree (operators)", histograms.inDegree);
+    printHistogram(out, "Distance (connections)", histograms.distance);
+    return out.str();
+}
+
+size_t OperatorProfiler::bucketIndex(uint64_t value)
+{
+    size_t bucket = 0;
+    while (value > 0) {
+        ++bucket;
+        value >>= 1;
+    }
+    return bucket;
+}
+
+std::string OperatorProfiler::bucketLabel(size_t bucket)
+{
+    if (bucket == 0) {
+        return "0";
+    }
+    uint64_t low = uint64_t{1} << (bucket - 1);
+    uint64_t high = (low << 1) - 1;
+    return low == high ? std::to_string(low) : std::to_string(low) + "-" + std::to_string(high);
+}
+
+bool OperatorProfiler::parseMetric(const std::string& name, Metric& metric)
+{
+    if (name == "deliveries") { metric = Metric::DELIVERIES; return true; }
+    if (name == "fires")      { metric = Metric::FIRES;      return true; }
+    if (name == "emitted")    { metric = Metric::EMITTED;    return true; }
+    if (name == "traversals") { metric = Metric::TRAVERSALS; return true; }
+    return false;
+}
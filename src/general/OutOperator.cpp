@@ -1,5 +1,6 @@
 
 #include "../headers/operators/OutOperator.h"
+#include "../headers/util/SampleCodec.h"
 #include <cmath>
 #include <iostream>
 #include <algorithm>
@@ -22,7 +23,7 @@ OutOperator::OutOperator(const std::byte*& current, const std::byte* end): Opera
     // Reserve space and read each element
     // this->data.reserve(dataCount);
     for (uint16_t i = 0; i < dataCount; ++i) {
-        this->data.push_back(Serializer::read_int(current, end));
+        store(Serializer::read_int(current, end));
     }
 
 }
@@ -45,21 +46,27 @@ void OutOperator::processData() {
  * @brief This operator has no specific parameters (like weight or threshold) to change.
  * This method does nothing.
  */
-void OutOperator::changeParams(const std::vector<int>& params) {
+void OutOperator::changeParams(const UpdateParams& params) {
     // Purpose: Fulfill the pure virtual function requirement from the base class.
-    // Parameters: params - A vector of parameters (ignored).
+    // Parameters: params - The update parameters (ignored).
     // Return: Void.
     // Key Logic: OutOperator has no configurable parameters. This method is a no-op.
 }
 
-void OutOperator::message(const int payloadData){
-    // std::cout << " Output recieved. " << std::endl; // TODO temporary for testing
-    if (data.size() >= MAX_DATA_BUFFER_SIZE) {
-        // Remove the oldest element from the front of the vector.
-        data.pop_front();
+void OutOperator::store(int value){
+    // Purpose: Append an output value without ever blocking the simulation thread.
+    // Parameters: @param value - the value to buffer.
+    // Return: Void.
+    // Key Logic: A full buffer (no reader kept up) rejects the newest value and counts it. Dropping the
+    // oldest instead would mean the producer moving the readers' position, which the SPSC ring leaves to readers.
+    if (!data.push(value)) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
     }
+}
 
-    data.push_back(payloadData); 
+void OutOperator::message(const int payloadData){
+    // std::cout << " Output recieved. " << std::endl; // TODO temporary for testing
+    store(payloadData); 
 }
 
 
@@ -92,7 +99,7 @@ void OutOperator::message(const float payloadData) {
         intPayloadData = static_cast<int>(std::round(payloadData));
     }
 
-    data.push_back(intPayloadData);
+    store(intPayloadData);
 }
 
 
@@ -125,11 +132,11 @@ void OutOperator::message(const double payloadData) {
         intPayloadData = static_cast<int>(std::round(payloadData));
     }
 
-    data.push_back(intPayloadData);
+    store(intPayloadData);
 }
 
 bool OutOperator::hasOutput(){
-    return data.size() > 0; 
+    return !data.empty(); 
 }
 
 int OutOperator::getOutputCount(){
@@ -145,59 +152,61 @@ void OutOperator::setBatchSize(int size){
 
 
 void OutOperator::clearData(){
+    std::lock_guard<std::mutex> lock(readerMutex);
     data.clear();
 }
 
+size_t OutOperator::readOutput(int* out, size_t maxItems){
+    return drainOutput(maxItems, [&out](const int* values, size_t count) {
+        out = std::copy(values, values + count, out);
+    });
+}
+
+uint64_t OutOperator::getDroppedCount() const{
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+std::vector<int> OutOperator::snapshotData() const{
+    std::lock_guard<std::mutex> lock(readerMutex);
+    std::vector<int> values;
+    values.reserve(data.size());
+    data.peek(data.getCapacity(), [&values](const int* span, size_t count) {
+        values.insert(values.end(), span, span + count);
+    });
+    return values;
+}
+
+
+size_t OutOperator::readText(char* out, size_t maxChars){
+    // Purpose: Convert buffered integers to characters directly into a caller buffer.
+    // Parameters: @param out - destination, @param maxChars - its size.
+    // Return: @return Number of characters written.
+    // Key Logic: Each span of the ring goes through the vectorized SampleCodec kernel, the same scaling
+    //            as the text output always used: the 8 most significant value bits of |v|.
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(out);
+    return drainOutput(maxChars, [&bytes](const int* values, size_t count) {
+        SampleCodec::messagesToBytes(values, count, bytes);
+        bytes += count;
+    });
+}
 
 /**
- * @brief Converts the stored integer data into an ASCII string and clears the internal buffer.
+ * @brief Converts up to one batch of the stored integer data into an ASCII string, consuming it.
  * @return std::string A string where each character is derived from an integer in the data buffer.
  */
 std::string OutOperator::getDataAsString() {
-    // Purpose: Convert buffered integers to an ASCII string using scaling and clear the buffer.
+    // Purpose: Convert buffered integers to an ASCII string using scaling and consume them.
     // Parameters: None.
     // Return: A string representing the scaled intensity of the buffered data.
-    // Key Logic: Pre-allocate a string. Iterate data vector, scale each int to a char
-    //            using bit-shifting, append to string, then clear the data vector.
-
-    if (data.empty()) {
+    // Key Logic: Size the string once to at most output_batch_size characters (0 = everything buffered)
+    //            and convert in place through readText, values arriving meanwhile are kept for the next call.
+    size_t available = data.size();
+    size_t limit = output_batch_size == 0 ? available : std::min(available, output_batch_size);
+    if (limit == 0) {
         return "";
     }
-
-     size_t items_to_process = std::min(data.size(), output_batch_size);
-
-    // Pre-allocate memory for the output string to avoid reallocations. This is more efficient.
-    std::string out;
-    out.reserve(data.size());
-
-    // The number of value bits in a positive integer (e.g., 31 for a 32-bit int).
-    constexpr int INT_VALUE_BITS = std::numeric_limits<int>::digits;
-    // We are scaling down to the 8 bits of a standard char.
-    constexpr int CHAR_BITS = 8;
-    // The amount to shift right to perform the scaling.
-    constexpr int SHIFT_AMOUNT = INT_VALUE_BITS - CHAR_BITS;
-
-    for (int value : data) {
-        // std::cout << value << std::endl;
-        // Defensively handle negative values, though message() should prevent them.
-        int non_negative_value = (value < 0) ? -1.0 * value : value; // just flip the sign
-        // std::cout << non_negative_value << std::endl; 
-
-        char ch;
-        // Use if constexpr to resolve the shift logic at compile time.
-        if constexpr (SHIFT_AMOUNT > 0) {
-            // Scale the int from [0, INT_MAX] to [0, 255] by taking the most significant 8 value-bits.
-            // Casting to unsigned ensures a logical right shift, which is best practice here.
-            ch = static_cast<char>(static_cast<unsigned int>(non_negative_value) >> SHIFT_AMOUNT);
-        } else {
-            // This case handles systems where int is 8 bits or less. Simply truncate.
-            ch = static_cast<char>(non_negative_value & 0xFF); // truncate bottom 8 bits
-        }
-        // std::cout << "char: " << ch << std::endl;
-        out.push_back(ch);
-    }
-
-    data.clear(); // Important: Reset the buffer after reading its contents.
+    std::string out(limit, '\0');
+    out.resize(readText(&out[0], limit)); // a concurrent clearData may have taken some
     return out;
 }
 
@@ -233,7 +242,7 @@ bool OutOperator::equals(const Operator& other) const {
     // Key Logic Steps:
     // 1. Call the base class `equals` method. If it fails, return false.
     // 2. Cast `other` to a `const OutOperator&`.
-    // 3. Compare the internal `data` vectors, which are persisted during serialization.
+    // 3. Compare the buffered data (oldest first), which is persisted during serialization.
 
     if (!Operator::equals(other)) {
         return false;
@@ -241,7 +250,7 @@ bool OutOperator::equals(const Operator& other) const {
 
     const auto& otherOutOp = static_cast<const OutOperator&>(other);
 
-    return this->data == otherOutOp.data;
+    return this->snapshotData() == otherOutOp.snapshotData();
 }
 
 // In general/OutOperator.cpp
@@ -276,16 +285,17 @@ std::string OutOperator::toJson(bool prettyPrint, bool encloseInBrackets, int in
     // Add OutOperator-specific properties
     oss << inner_indent << "\"data\":" << space << "[";
     
-    if (!data.empty()) {
+    std::vector<int> values = snapshotData(); // buffered values, oldest first
+    if (!values.empty()) {
         if (prettyPrint) {
             oss << newline;
-            for (size_t i = 0; i < data.size(); ++i) {
-                oss << array_element_indent << data[i] << (i == data.size() - 1 ? "" : ",") << newline;
+            for (size_t i = 0; i < values.size(); ++i) {
+                oss << array_element_indent << values[i] << (i == values.size() - 1 ? "" : ",") << newline;
             }
             oss << inner_indent;
         } else { // Compact version
-            for (size_t i = 0; i < data.size(); ++i) {
-                oss << data[i] << (i == data.size() - 1 ? "" : ",");
+            for (size_t i = 0; i < values.size(); ++i) {
+                oss << values[i] << (i == values.size() - 1 ? "" : ",");
             }
         }
     }
@@ -306,11 +316,12 @@ std::vector<std::byte> OutOperator::serializeToBytes() const{
 
     // 2. Append this derived class's specific data to the buffer.
     // First, write the count of elements in the data vector.
-    int size = data.size() > std::numeric_limits<uint16_t>::max()? std::numeric_limits<uint16_t>::max(): data.size(); // prevent overflow
+    std::vector<int> values = snapshotData();
+    int size = values.size() > std::numeric_limits<uint16_t>::max()? std::numeric_limits<uint16_t>::max(): values.size(); // prevent overflow
     Serializer::write(dataBuffer, static_cast<uint16_t>(size));
 
-    auto it = data.rbegin(); 
-    for(int i = 0; i < size && it != data.rend(); ++i, ++it) {
+    auto it = values.rbegin(); 
+    for(int i = 0; i < size && it != values.rend(); ++i, ++it) {
         Serializer::write(dataBuffer, *it);
     }
 
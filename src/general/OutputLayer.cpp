@@ -86,6 +86,12 @@ std::string OutputLayer::getTextOutput(){
 }
 
 
+OutOperator* OutputLayer::getChannelOperator(ChannelType channel){
+    uint32_t channelId = reservedRange->getMinId() + static_cast<uint32_t>(channel);
+    return static_cast<OutOperator*>(operators.at(channelId)); // validated as OutOperator on construction
+}
+
+
 int OutputLayer::getTextCount(){
 
     uint32_t textChannelId = reservedRange->getMinId() + textChannelIdOffset;
@@ -0,0 +1,102 @@
+#include "../headers/OutputSubscription.h"
+#include "../headers/operators/OutOperator.h"
+#include <algorithm>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+OutputSubscription::OutputSubscription(ChannelType outputChannel, size_t valuesPerBatch) :
+    channel(outputChannel),
+    batchSize(std::max<size_t>(valuesPerBatch, 1))
+{
+    eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+}
+
+OutputSubscription::~OutputSubscription() {
+    if (eventFd >= 0) {
+        ::close(eventFd);
+    }
+}
+
+void OutputSubscription::bind(OutOperator* channelOperator) {
+    std::lock_guard<std::mutex> lock(sourceMutex);
+    source = channelOperator;
+}
+
+void OutputSubscription::signal() {
+    // Purpose: Wake the subscriber.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: Only the first signal after a read does any work, later step boundaries cost one exchange.
+    if (signalled.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(waitMutex); // pairs with the predicate check in waitAndPoll
+    }
+    waitCondition.notify_all();
+    if (eventFd >= 0) {
+        uint64_t one = 1;
+        ssize_t ignored = ::write(eventFd, &one, sizeof(one));
+        (void)ignored;
+    }
+}
+
+void OutputSubscription::clearSignal() {
+    // Purpose: Take the signal and reset the notification descriptor.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: The descriptor is drained first and unconditionally (it is nonblocking, an empty one
+    // just fails with EAGAIN). A signal() that set the flag before our exchange but writes after it
+    // would otherwise leave the descriptor readable with the flag cleared, and no later call would reset it.
+    if (eventFd >= 0) {
+        uint64_t count = 0;
+        ssize_t ignored = ::read(eventFd, &count, sizeof(count));
+        (void)ignored;
+    }
+    signalled.store(false, std::memory_order_release);
+}
+
+void OutputSubscription::notifyIfReady(size_t threshold) {
+    // Purpose: Signal the subscriber from the run loop once enough output is waiting.
+    // Parameters: @param threshold - fill level that triggers the signal.
+    // Return: Void.
+    // Key Logic: Called under the simulation lock, which also guards rebinding, so source is read without sourceMutex.
+    if (source != nullptr && !signalled.load(std::memory_order_acquire)
+        && static_cast<size_t>(source->getOutputCount()) >= threshold) {
+        signal();
+    }
+}
+
+size_t OutputSubscription::poll(const BatchCallback& callback, size_t maxValues) {
+    // Purpose: Deliver the waiting values on the caller's thread.
+    // Parameters: @param callback - receives each batch, @param maxValues - limit for this call.
+    // Return: @return Number of values delivered.
+    // Key Logic: The signal is taken first, so values arriving while draining signal again at a later step.
+    std::lock_guard<std::mutex> lock(sourceMutex);
+    clearSignal();
+    if (source == nullptr) {
+        return 0;
+    }
+    size_t delivered = 0;
+    while (delivered < maxValues) {
+        size_t taken = source->drainOutput(std::min(batchSize, maxValues - delivered), callback);
+        if (taken == 0) {
+            break;
+        }
+        delivered += taken;
+    }
+    return delivered;
+}
+
+size_t OutputSubscription::waitAndPoll(std::chrono::milliseconds timeout, const BatchCallback& callback, size_t maxValues) {
+    {
+        std::unique_lock<std::mutex> lock(waitMutex);
+        waitCondition.wait_for(lock, timeout, [this] { return signalled.load(std::memory_order_acquire); });
+    }
+    return poll(callback, maxValues);
+}
+
+size_t OutputSubscription::available() const {
+    std::lock_guard<std::mutex> lock(sourceMutex);
+    return source == nullptr ? 0 : static_cast<size_t>(source->getOutputCount());
+}
@@ -0,0 +1,91 @@
+#include "../headers/util/Philox.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+int Philox::getInt(int min, int max)
+{
+    if (min > max) {
+        std::swap(min, max);
+    }
+    uint32_t span = static_cast<uint32_t>(static_cast<int64_t>(max) - min); // range size - 1
+    if (span == UINT32_MAX) {
+        return static_cast<int>(nextUint32()); // full 32-bit range
+    }
+    return static_cast<int>(static_cast<int64_t>(min) + below(span + 1));
+}
+
+double Philox::getDouble(double min, double max)
+{
+    if (min > max) {
+        std::swap(min, max);
+    }
+    double unit = static_cast<double>(nextUint64() >> 11) * 0x1.0p-53;
+    return min + unit * (max - min);
+}
+
+float Philox::getFloat(float min, float max)
+{
+    if (min > max) {
+        std::swap(min, max);
+    }
+    float unit = static_cast<float>(nextUint32() >> 8) * 0x1.0p-24f;
+    return min + unit * (max - min);
+}
+
+void Philox::fill(uint32_t* out, size_t count)
+{
+    // Purpose: Bulk raw output.
+    // Parameters: @param out - destination, @param count - number of values.
+    // Return: Void.
+    // Key Logic: Drain the buffered block first so the sequence matches nextUint32, then write whole
+    // blocks straight into `out` and buffer the last partial block.
+    size_t written = 0;
+    while (written < count && bufferPos < 4) {
+        out[written++] = buffer[bufferPos++];
+    }
+    while (count - written >= 4) {
+        Block block = nextBlock();
+        std::memcpy(out + written, block.data(), sizeof(block));
+        written += 4;
+    }
+    while (written < count) {
+        out[written++] = nextUint32();
+    }
+}
+
+void Philox::fillInt(int* out, size_t count, int min, int max)
+{
+    // Purpose: Bulk uniform integers, the batched replacement for per-value getInt calls.
+    // Parameters: @param out - destination, @param count - number of values, @param min / max - inclusive range.
+    // Return: Void.
+    // Key Logic: Raw words are generated in place (int and uint32_t may alias), then reduced to the
+    // range. A biased word is replaced by drawing after the batch, which keeps the result unbiased.
+    if (count == 0) {
+        return;
+    }
+    if (min > max) {
+        std::swap(min, max);
+    }
+    uint32_t* raw = reinterpret_cast<uint32_t*>(out);
+    fill(raw, count);
+    uint32_t span = static_cast<uint32_t>(static_cast<int64_t>(max) - min);
+    if (span == UINT32_MAX) {
+        return; // full 32-bit range, raw words are already uniform
+    }
+    uint32_t bound = span + 1;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<int>(static_cast<int64_t>(min) + reduce(raw[i], bound));
+    }
+}
+
+void Philox::fillDouble(double* out, size_t count, double min, double max)
+{
+    if (min > max) {
+        std::swap(min, max);
+    }
+    double scale = (max - min) * 0x1.0p-53;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = min + static_cast<double>(nextUint64() >> 11) * scale;
+    }
+}
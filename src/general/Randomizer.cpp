@@ -31,3 +31,21 @@ double Randomizer::getDouble(double min, double max) {
 float Randomizer::getFloat(float min, float max){
     return source->getFloat(min, max); 
 }
+
+void Randomizer::fillInt(int* out, size_t count, int min, int max) {
+    if (min > max) {
+        std::swap(min, max);
+    }
+    source->fillInt(out, count, min, max);
+}
+
+std::unique_ptr<Randomizer> Randomizer::split() {
+    if (!source) {
+        return nullptr;
+    }
+    std::unique_ptr<RandomSource> child = source->split();
+    if (!child) {
+        return nullptr;
+    }
+    return std::make_unique<Randomizer>(std::move(child));
+}
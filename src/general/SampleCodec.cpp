@@ -0,0 +1,28 @@
+#include "../headers/util/SampleCodec.h"
+
+void SampleCodec::bytesToMessages(const uint8_t* bytes, size_t count, int* messages) {
+    for (size_t i = 0; i < count; ++i) {
+        messages[i] = static_cast<int>(static_cast<uint32_t>(bytes[i]) << BYTE_SHIFT);
+    }
+}
+
+void SampleCodec::samples16ToMessages(const int16_t* samples, size_t count, int* messages) {
+    for (size_t i = 0; i < count; ++i) {
+        // through uint32_t, shifting a negative int is not defined before C++20
+        messages[i] = static_cast<int>(static_cast<uint32_t>(static_cast<int32_t>(samples[i])) << SAMPLE16_SHIFT);
+    }
+}
+
+void SampleCodec::messagesToBytes(const int* messages, size_t count, uint8_t* bytes) {
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t value = static_cast<uint32_t>(messages[i]);
+        uint32_t magnitude = messages[i] < 0 ? 0u - value : value; // negative values read by magnitude, as for text
+        bytes[i] = static_cast<uint8_t>(magnitude >> BYTE_SHIFT);
+    }
+}
+
+void SampleCodec::messagesToSamples16(const int* messages, size_t count, int16_t* samples) {
+    for (size_t i = 0; i < count; ++i) {
+        samples[i] = static_cast<int16_t>(messages[i] >> SAMPLE16_SHIFT); // arithmetic shift keeps the sign
+    }
+}
@@ -6,7 +6,7 @@
 #include <vector>
 #include <mutex>
 #include <stdexcept>
-#include <algorithm> // For std::find in destructor
+#include <algorithm> // For std::find in destructor, std::stable_partition in ResetInstances
 
 // Initialize static members
 std::vector<Scheduler*> Scheduler::instances;
@@ -63,16 +63,37 @@ Scheduler* Scheduler::CreateInstance(TimeController* controller)
     }
     std::lock_guard<std::mutex> lock(instanceMutex); // Lock for safe modification
     Scheduler* newInstance = new Scheduler(controller);
+    newInstance->ownedByRegistry = true; // deleted by ResetInstances
     instances.push_back(newInstance);
     // Mutex is automatically unlocked here
     return newInstance;
 }
 
 /**
- * @brief Gets the default (first) Scheduler instance.
- * @return Scheduler* Pointer to the default Scheduler instance.
+ * @brief [Factory Method] Creates and registers a Scheduler instance owned by the caller.
+ * @param controller Pointer to the TimeController instance this Scheduler interacts with.
+ * @return std::unique_ptr<Scheduler> The instance, its destructor unregisters it.
+ * @details Registered like CreateInstance's instances (it may be the default get() result), but
+ * ResetInstances skips it, so only the owner ever deletes it.
+ * @throws std::invalid_argument if the provided controller pointer is null.
+ */
+std::unique_ptr<Scheduler> Scheduler::CreateOwnedInstance(TimeController* controller)
+{
+    if (!controller) {
+        throw std::invalid_argument("Cannot create Scheduler instance with a null TimeController.");
+    }
+    std::unique_ptr<Scheduler> newInstance(new Scheduler(controller));
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    instances.push_back(newInstance.get());
+    return newInstance;
+}
+
+/**
+ * @brief Gets the calling thread's Scheduler instance, or the default (first) one.
+ * @return Scheduler* Pointer to the thread's or the default Scheduler instance.
  * @throws std::runtime_error if no Scheduler instance exists (i.e., CreateInstance was never called or all instances were destroyed).
- * @details Acquires a lock, checks if the static `instances` vector is empty. If not,
+ * @details Returns the instance a Scope installed on the calling thread without locking. Otherwise
+ * acquires a lock, checks if the static `instances` vector is empty. If not,
  * returns the pointer to the first element (assumed to be the default). Otherwise,
  * throws an exception. This method is used by Operators or other components to
  * access the Scheduler functionality.
@@ -80,6 +101,9 @@ Scheduler* Scheduler::CreateInstance(TimeController* controller)
  */
 Scheduler* Scheduler::get()
 {
+    if (threadInstance) {
+        return threadInstance; // the simulator stepping on this thread, no lock needed
+    }
     std::lock_guard<std::mutex> lock(instanceMutex); // Lock for safe access
     if (instances.empty()) {
         throw std::runtime_error("Scheduler::get() called but no Scheduler instance exists.");
@@ -110,6 +134,34 @@ void Scheduler::schedulePayloadForNextStep(const Payload& payload)
     }
 }
 
+/**
+ * @brief Constructs a Payload in place to start its journey in the *next* time step.
+ * @param messageData The message carried by the new payload.
+ * @param sourceOperatorId The ID of the Operator starting the payload's journey.
+ * @return Void.
+ * @details Forwards to the associated TimeController's `emplaceNextStepPayload`, so the
+ * payload is built directly inside the next step's payload list.
+ */
+void Scheduler::emplacePayloadForNextStep(int messageData, uint32_t sourceOperatorId)
+{
+    if (timeControllerInstance) {
+        timeControllerInstance->emplaceNextStepPayload(messageData, sourceOperatorId);
+    }
+}
+
+/**
+ * @brief Hints that the caller is about to schedule `count` payloads for the next step.
+ * @param count Number of payloads about to be scheduled.
+ * @return Void.
+ * @details Forwards to the associated TimeController's `reserveNextStepPayloads`.
+ */
+void Scheduler::reservePayloadsForNextStep(size_t count)
+{
+    if (timeControllerInstance) {
+        timeControllerInstance->reserveNextStepPayloads(count);
+    }
+}
+
 /**
  * @brief Schedules message delivery and operator flagging for the current step.
  * @param targetOperatorId The ID of the operator receiving the message.
@@ -131,30 +183,40 @@ void Scheduler::scheduleMessage(int targetOperatorId, int messageData)
     }
 }
 
+void Scheduler::scheduleMessages(int targetOperatorId, const int* values, size_t count)
+{
+    if (timeControllerInstance) {
+        timeControllerInstance->deliverBatchAndFlagOperator(targetOperatorId, values, count);
+    }
+}
+
 /**
- * @brief Clears all Scheduler instances. Useful for simulation reset/shutdown.
- * @details Acquires a lock, iterates through the static `instances` vector,
- * deletes each pointed-to Scheduler object (calling their destructors which
- * will attempt to remove them from the list, although we clear it anyway),
- * and finally clears the vector itself.
- * @warning This permanently deletes all Scheduler instances. Use with caution,
- * typically only during application shutdown or a full simulation reset.
+ * @brief Deletes every Scheduler instance created by CreateInstance. Useful for test reset/shutdown.
+ * @details Acquires a lock, moves the registry-owned pointers out of the static `instances`
+ * vector and deletes them once the lock is released (their destructors take it to unregister).
+ * Instances created by CreateOwnedInstance belong to a Simulator and stay registered, their
+ * owner deletes them.
+ * @warning This permanently deletes the registry-owned instances. Use with caution,
+ * typically only during application shutdown or between tests.
  */
 void Scheduler::ResetInstances() {
     // Purpose: Safely delete all managed Scheduler instances without causing a deadlock.
     // Key Logic:
     // 1. Create a temporary local vector to hold the pointers.
-    // 2. Acquire a lock on the static mutex just long enough to move the pointers
-    //    from the static vector to our local one. This leaves the static vector empty.
+    // 2. Acquire a lock on the static mutex just long enough to move the registry-owned pointers
+    //    from the static vector to our local one. Owned instances (CreateOwnedInstance) stay listed.
     // 3. The lock is released automatically.
     // 4. Iterate through the local vector and delete each pointer. The destructors will
     //    be called, but since the mutex is no longer held, they will not deadlock.
 
     std::vector<Scheduler*> instances_to_delete;
     {
-        // Lock only to safely copy and clear the static list.
+        // Lock only to safely split the static list.
         std::lock_guard<std::mutex> lock(instanceMutex);
-        instances.swap(instances_to_delete); // Efficiently move pointers to local vector
+        auto owned = std::stable_partition(instances.begin(), instances.end(),
+                                           [](const Scheduler* instance) { return !instance->ownedByRegistry; });
+        instances_to_delete.assign(owned, instances.end());
+        instances.erase(owned, instances.end());
     } // Mutex is released here.
 
     // Now, delete the pointers from the local copy.
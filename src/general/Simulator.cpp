@@ -2,10 +2,17 @@
 #include "../headers/util/Console.h"
 #include "../headers/layers/InputLayer.h"
 #include "../headers/layers/OutputLayer.h"
-#include "../headers/util/PseudoRandomSource.h"
+#include "../headers/util/PhiloxRandomSource.h"
+#include "../headers/operators/OutOperator.h"
+#include "../headers/operators/InOperator.h"
+#include "../headers/util/SampleCodec.h"
 // #include "UpdateEvent.h" // Likely not needed here anymore
 #include <iostream>      // For basic logging/output
 #include <stdexcept>     // For exception handling during init
+#include <chrono>        // For update/advance phase timing
+#include <algorithm>     // For std::max
+#include "../headers/util/Tracer.h"
+#include "../headers/util/AsyncLogger.h"
 
 
 
@@ -40,17 +47,24 @@ Simulator::Simulator(const std::string& configPath /*= ""*/, Randomizer* randomi
 
 /**
  * @brief Destructor for the Simulator class.
- * @details Controller members handle their own cleanup via RAII.
- * Assumes Scheduler::ResetInstances() and UpdateScheduler::ResetInstances()
- * will be called globally after this destructor runs (e.g., in main).
+ * @details Controller members handle their own cleanup via RAII. The simulator's own
+ * Scheduler and UpdateScheduler are destroyed, other simulators' instances are left alone.
  */
 Simulator::~Simulator()
 {
     requestStop(); // Ensure any background simulation thread is signaled to stop
+    {
+        // subscribers may outlive the simulator, detach them before the network is destroyed
+        std::lock_guard<std::mutex> lock(simMutex);
+        for (const auto& subscription : outputSubscriptions) {
+            subscription->bind(nullptr);
+        }
+    }
+    schedulerInstance.reset();
+    updateSchedulerInstance.reset();
     ConsoleWriter writer; // used to ensure prints uninterrupted
     writer << "Simulator shutting down..." << std::endl;
     // Controllers are automatically destroyed here.
-    // Assumes Schedulers are reset globally.
     // writer << "Final Operator count from MetaController: " << metaController.getOpCount() << std::endl;
     writer << "Simulator finished." << std::endl;
     writer << "Simulator shutting down..." << std::endl;
@@ -59,20 +73,19 @@ Simulator::~Simulator()
 
 void Simulator::init() {
     if (rand == nullptr) {
-        // default to pseudo random
-        rand = new Randomizer(std::make_unique<PseudoRandomSource>());
+        // default to pseudo random (counter-based, reproducible with the default seed)
+        rand = new Randomizer(std::make_unique<PhiloxRandomSource>());
     } 
 
 
-    // Purpose: Initialize the static Scheduler instances.
+    // Purpose: Initialize this simulator's Scheduler instances.
     // Parameters: None.
     // Return: Void.
-    // Key Logic: Calls the static CreateInstance methods for both Scheduler and UpdateScheduler, linking them to the TimeController and UpdateController respectively. This is a critical setup step. 
-    Scheduler::ResetInstances(); // Clear any previous instances from a prior simulation
-    UpdateScheduler::ResetInstances();
+    // Key Logic: Calls the static CreateOwnedInstance methods for both Scheduler and UpdateScheduler, linking them to the TimeController and UpdateController respectively. This is a critical setup step. 
+    //            Instances of other simulators stay registered, each simulator reaches its own through ContextScope.
     try {
-        Scheduler::CreateInstance(&timeController);
-        UpdateScheduler::CreateInstance(&updateController);
+        schedulerInstance = Scheduler::CreateOwnedInstance(&timeController);
+        updateSchedulerInstance = UpdateScheduler::CreateOwnedInstance(&updateController);
     } catch (const std::exception& e) {
         ConsoleWriter() << "FATAL ERROR during Scheduler setup: " << e.what() << std::endl;
         // Handle initialization failure (e.g., rethrow, exit)
@@ -99,7 +112,17 @@ void Simulator::loadConfiguration(const std::string& filePath) {
         return;
     }
     std::lock_guard<std::mutex> lock(simMutex);
-    metaController.loadConfiguration(filePath);
+    unbindSubscriptionsNoLock(); // consumers poll without simMutex, they must not reach the operators being replaced
+    try {
+        metaController.loadConfiguration(filePath);
+    } catch (...) {
+        bindSubscriptionsNoLock(); // to whatever the failed load left behind
+        throw;
+    }
+    stepStats.clear(); // statistics of the previous network no longer apply
+    operatorProfiler.clear();
+    bindSubscriptionsNoLock();
+    publishStatusNoLock(true);
     if (!metaController.isEmpty()) {
         hasNetwork = true;
     }
@@ -121,24 +144,26 @@ bool Simulator::saveConfiguration(const std::string& filePath) const {
     
 }
 
-void Simulator::loadState(const std::string& filePath){
+bool Simulator::loadState(const std::string& filePath){
     if(!hasNetwork){
-        return; // only attempt save if network present
+        return false; // only attempt load if network present
     }
     std::lock_guard<std::mutex> lock(simMutex);
-    timeController.loadState(filePath);
+    bool loaded = timeController.loadState(filePath);
+    publishStatusNoLock(true);
+    return loaded;
 }
 
-void Simulator::saveState(const std::string& filePath)const{
+bool Simulator::saveState(const std::string& filePath)const{
     // Purpose: To save the current network state to a file.
     // Parameters: @param filePath - The path where the file will be saved.
-    // Return: Void.
+    // Return: @return bool - TimeController's result, false without a network.
     // Key Logic: Acquires a lock for thread-safe access to the TimeController, then delegates the call.
     if(!hasNetwork){
-        return; // only attempt save if network present
+        return false; // only attempt save if network present
     }
     std::lock_guard<std::mutex> lock(simMutex);
-    timeController.saveState(filePath);
+    return timeController.saveState(filePath);
 }
 
 
@@ -153,8 +178,17 @@ void Simulator::createNewNetwork(int numOperators) {
         return;
     }
     std::lock_guard<std::mutex> lock(simMutex);
- 
-    metaController.randomizeNetwork(numOperators);
+    unbindSubscriptionsNoLock(); // consumers poll without simMutex, they must not reach the operators being replaced
+    try {
+        metaController.randomizeNetwork(numOperators);
+    } catch (...) {
+        bindSubscriptionsNoLock(); // e.g. a negative count, the previous network is still in place
+        throw;
+    }
+    stepStats.clear(); // statistics of the previous network no longer apply
+    operatorProfiler.clear();
+    bindSubscriptionsNoLock();
+    publishStatusNoLock(true);
     if (!metaController.isEmpty()) {
         hasNetwork = true;
     }
@@ -192,25 +226,25 @@ void Simulator::run(int numSteps)
 
     isRunning = true;
     stopFlag = false;
-    ConsoleWriter() << "Starting simulation run for " << numSteps << " steps." << std::endl;
+    ContextScope context(*this);
+    // Run loop logging goes through the async logger, formatting and console I/O happen off this thread
+    AsyncLogger& logger = AsyncLogger::get();
+    logger.info("sim.run.start", {{"steps", numSteps}});
     for (int i = 0; i < numSteps; ++i) {
         if (stopFlag) {
-            ConsoleWriter() << "Simulation stopped by request." << std::endl;
+            logger.info("sim.run.stopped", {{"step", timeController.getCurrentStep()}});
             break;
         }
         
         {// Create a scope for the lock guard
             std::lock_guard<std::mutex> lock(simMutex);
             // Log current step
-            if ((i % logFrequency == 0) || i == numSteps -1 ) { // Log every 10 steps and the last step
-                getStatusNoLock().print();  // print status at specified frequency
+            int frequency = logFrequency;
+            if ((frequency > 0 && i % frequency == 0) || i == numSteps -1 ) { // Log every logFrequency steps and the last step
+                logStatusNoLock();  // status at specified frequency
             }
-            // 1. Process signal propagation and firing decisions for the current step
-            timeController.processCurrentStep();
-            // 2. Process any state/structural updates requested during the step
-            updateController.ProcessUpdates(); // Handles events queued by Operators or MetaController setup
-            // 3. Advance time state (move next payloads to current, increment step counter)
-            timeController.advanceStep();
+            // Process signal propagation, updates and advance the time state
+            executeStepNoLock();
             // Premature termination conditions
             if (isFinished()) {
                 break;
@@ -218,8 +252,14 @@ void Simulator::run(int numSteps)
         }
 
     }
+    {
+        std::lock_guard<std::mutex> lock(simMutex);
+        updateController.ApplyStaged(); // pipelined mode, the last step's updates
+        notifySubscriptionsNoLock(1); // hand over the remainder that did not fill a batch
+        publishStatusNoLock(false);
+    }
     isRunning = false; // Signal that the run has completed
-    ConsoleWriter() << "Simulation run finished." << std::endl;
+    logger.info("sim.run.finished", {{"step", timeController.getCurrentStep()}});
 }
 
 // TODO check comments
@@ -246,22 +286,20 @@ void Simulator::run() // Overloaded run method
 
     isRunning = true;
     stopFlag = false;
-    ConsoleWriter() << "Starting simulation run until inactive state or max " << DEFAULT_MAX_STEPS << " steps." << std::endl;
+    ContextScope context(*this);
+    AsyncLogger& logger = AsyncLogger::get();
+    logger.info("sim.run.start", {{"max_steps", DEFAULT_MAX_STEPS}});
     while (!stopFlag) {
         {
             std::lock_guard<std::mutex> lock(simMutex);
             long long currentStep = timeController.getCurrentStep();
             // --- Logging ---
-            if (currentStep % logFrequency == 0) { // TODO log every ten steps, add a parameter to make customizable 
-                getStatusNoLock().print();
+            int frequency = logFrequency;
+            if (frequency > 0 && currentStep % frequency == 0) {
+                logStatusNoLock();
             }
             // --- Core Simulation Steps ---
-            // 1. Process time step
-            timeController.processCurrentStep();
-            // 2. Process updates
-            updateController.ProcessUpdates();
-            // 3. Advance time state
-            timeController.advanceStep();
+            executeStepNoLock();
              // --- Check for Inactivity---
             if (isFinished()) {
                 break;
@@ -272,22 +310,402 @@ void Simulator::run() // Overloaded run method
 
     { // lock block
         std::lock_guard<std::mutex> lock(simMutex);
-        ConsoleWriter writer; // used to ensure prints uninterrupted
         // --- Post-Loop Logging ---
         long long finalStep = timeController.getCurrentStep();
         bool hitMaxSteps = (finalStep >= DEFAULT_MAX_STEPS);
 
-        writer << "--- Simulation Run Finished ---" << std::endl;
         if (hitMaxSteps) {
-            writer << "Reason: Reached maximum step limit (" << DEFAULT_MAX_STEPS << ")." << std::endl;
+            logger.info("sim.run.finished", {{"step", finalStep}}, "reached maximum step limit");
         } else {
-            writer << "Reason: Reached inactive state (no payloads or pending updates)." << std::endl; // Changed terminology
+            logger.info("sim.run.finished", {{"step", finalStep}}, "reached inactive state (no payloads or pending updates)");
         }
+        updateController.ApplyStaged(); // pipelined mode, the last step's updates
+        notifySubscriptionsNoLock(1); // hand over the remainder that did not fill a batch
+        publishStatusNoLock(false);
     }
 
     isRunning = false; // Signal that the run has completed
 }
 
+void Simulator::logStatusNoLock() {
+    // Purpose: To log the periodic status line of a run.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: Only copies the counters into a log record, formatting happens on the logger's writer thread.
+    AsyncLogger::get().info("sim.status", {
+        {"step", timeController.getCurrentStep()},
+        {"payloads", static_cast<long long>(timeController.getCurrentStepPayloadCount())},
+        {"next_payloads", static_cast<long long>(timeController.getNextStepPayloadCount())},
+        {"pending_updates", static_cast<long long>(updateController.QueueSize() + updateController.StagedCount())}
+    });
+}
+
+void Simulator::executeStepNoLock() {
+    // Purpose: To execute one full time step and record its per-phase statistics.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: TimeController times its own phases (traversal, operator checks) and counts payloads/messages,
+    // the update and advance phases are timed here. The combined sample goes into the rolling stepStats window.
+    // In pipelined mode the updates are staged at the end of the step and applied during the next one.
+    ATHENA_TRACE_SCOPE("Simulator::step");
+    using Clock = std::chrono::steady_clock;
+
+    // Pipelined mode: apply the previous step's updates, the ones this step does not read may run alongside it
+    bool concurrentUpdates = false;
+    long long stagedUpdatesNs = 0;
+    if (updateController.StagedCount() > 0) {
+        Clock::time_point stagedStart = Clock::now();
+        if (applyStagedUpdatesNoLock()) {
+            if (!pipelineWorker) {
+                pipelineWorker = std::make_unique<WorkerPool>(1);
+                concurrentUpdatesTask = [this](size_t) {
+                    ContextScope context(*this);
+                    updateController.ApplyStaged();
+                    updateController.FlushThreadBatch(); // nothing may stay in the worker's batch between steps
+                };
+            }
+            pipelineWorker->dispatch(1, concurrentUpdatesTask);
+            concurrentUpdates = true;
+        }
+        stagedUpdatesNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - stagedStart).count();
+    }
+    // 0. Streamed input for this step (delivered to the text channel, emitted by it next step)
+    if (textStream) {
+        feedTextStreamNoLock();
+    }
+    if (!imageInput.empty() || !audioInput.empty()) {
+        feedChannelInputsNoLock();
+    }
+    // 1. Process signal propagation and firing decisions for the current step
+    timeController.processCurrentStep();
+    // 2. Process any state/structural updates requested during the step
+    Clock::time_point updatesStart = Clock::now();
+    if (concurrentUpdates) {
+        pipelineWorker->join(); // only waits if the previous step's updates outlast this step
+    }
+    size_t updatesApplied = 0;
+    if (pipelinedUpdates) {
+        updatesApplied = updateController.LastAppliedCount(); // the previous step's updates, applied during this one
+        updateController.StageUpdates(); // applied at the start of the next step
+    } else {
+        updateController.ProcessUpdates(); // Handles events queued by Operators or MetaController setup
+        updatesApplied = updateController.LastAppliedCount();
+    }
+    Clock::time_point advanceStart = Clock::now();
+    // 3. Advance time state (move next payloads to current, increment step counter)
+    timeController.advanceStep();
+    Clock::time_point stepEnd = Clock::now();
+
+    // 4. Wake output subscribers whose batch filled up during the step
+    if (!outputSubscriptions.empty()) {
+        notifySubscriptionsNoLock();
+    }
+
+    StepSample sample = timeController.getLastStepSample();
+    sample.updatesNs = std::chrono::duration_cast<std::chrono::nanoseconds>(advanceStart - updatesStart).count() + stagedUpdatesNs;
+    sample.advanceNs = std::chrono::duration_cast<std::chrono::nanoseconds>(stepEnd - advanceStart).count();
+    sample.updatesApplied = updatesApplied;
+    stepStats.record(sample);
+
+    // 5. Publish the status for lock-free readers, the summary sorts the window so it follows a slower cadence
+    publishStatusNoLock(stepEnd - lastStepStatsPublish >= STEP_STATS_PUBLISH_INTERVAL);
+}
+
+bool Simulator::applyStagedUpdatesNoLock() {
+    // Purpose: To apply the staged updates the coming step reads, before it reads them.
+    // Parameters: None.
+    // Return: @return True if the remaining staged updates should be applied concurrently with the step.
+    // Key Logic: Parameter and connection events only change their target operator. The step first reads the
+    //            payload sources, the flagged operators and the input channels, then the targets at the sources'
+    //            connections, so the sources' updates go first and the targets are collected after them.
+    //            Anything left targets operators the step does not touch.
+    if (updateController.HasStagedLifecycleEvents()) {
+        updateController.ApplyStaged(); // operators may appear or disappear, keep the serial order
+        return false;
+    }
+
+    pipelineFootprint.clear();
+    timeController.collectStepSources(pipelineFootprint);
+    metaController.collectInputChannelIds(pipelineFootprint); // input may arrive from other threads at any time
+    updateController.ApplyStagedFor(pipelineFootprint);
+
+    pipelineFootprint.clear();
+    timeController.collectStepTargets(pipelineFootprint);
+    updateController.ApplyStagedFor(pipelineFootprint);
+
+    if (updateController.StagedCount() < pipelineThreshold) {
+        updateController.ApplyStaged(); // too few to pay for the handoff
+        return false;
+    }
+    return true;
+}
+
+void Simulator::publishStatusNoLock(bool includeStepStats) {
+    // Purpose: To refresh the snapshot getStatus returns while the simulation lock is taken.
+    // Parameters: @param includeStepStats - also summarize the step statistics window.
+    // Return: Void.
+    // Key Logic: The status counters are a few words and are published every time. The summary sorts the
+    //            window (several microseconds), so runs refresh it on a time cadence and not per step or per run.
+    publishedStatus.store(getStatusNoLock());
+    if (includeStepStats) {
+        publishedStepStats.store(stepStats.summarize());
+        lastStepStatsPublish = std::chrono::steady_clock::now();
+    }
+}
+
+void Simulator::feedTextStreamNoLock() {
+    // Purpose: To deliver the text stream's share of input for the coming step.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: The in-flight count (current + next step payloads) drives the stream's backpressure.
+    size_t inFlight = timeController.getCurrentStepPayloadCount() + timeController.getNextStepPayloadCount();
+    if (textStream->nextStep(inFlight, textStreamChars) > 0) {
+        metaController.inputChars(textStreamChars.data(), textStreamChars.size());
+    }
+}
+
+void Simulator::feedChannelInputsNoLock() {
+    // Purpose: To deliver the queued media input's share for the coming step.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: Each span of the queue is one batch call, the channel operator is flagged once per step.
+    imageInput.nextStep([this](const int* values, size_t count) {
+        metaController.inputSamples(ChannelType::IMAGE, values, count);
+    });
+    audioInput.nextStep([this](const int* values, size_t count) {
+        metaController.inputSamples(ChannelType::AUDIO, values, count);
+    });
+}
+
+size_t Simulator::submitImageFrame(const uint8_t* pixels, size_t count) {
+    return imageInput.submitBytes(pixels, count);
+}
+
+size_t Simulator::submitAudioSamples(const int16_t* samples, size_t count) {
+    return audioInput.submitSamples16(samples, count);
+}
+
+bool Simulator::setChannelInputRate(ChannelType channel, size_t samplesPerStep) {
+    // capped at what the channel's InOperator keeps per step, so no dequeued sample is dropped there
+    samplesPerStep = std::min(samplesPerStep, InOperator::MAX_ACCUMULATED_DATA);
+    switch (channel) {
+        case ChannelType::IMAGE: imageInput.setSamplesPerStep(samplesPerStep); return true;
+        case ChannelType::AUDIO: audioInput.setSamplesPerStep(samplesPerStep); return true;
+        default: return false;
+    }
+}
+
+size_t Simulator::getPendingChannelInput(ChannelType channel) const {
+    switch (channel) {
+        case ChannelType::IMAGE: return imageInput.pendingCount();
+        case ChannelType::AUDIO: return audioInput.pendingCount();
+        default: return 0;
+    }
+}
+
+template<typename T, typename Convert>
+size_t Simulator::readChannelOutput(ChannelType channel, T* out, size_t maxValues, Convert convert) {
+    // Purpose: To drain an output channel into a caller buffer of samples.
+    // Parameters: @param channel - output channel, @param out - destination, @param maxValues - its size,
+    // @param convert - SampleCodec conversion from messages.
+    // Return: @return Number of samples written.
+    // Key Logic: The ring's spans are converted in place into the destination, no intermediate copy.
+    std::lock_guard<std::mutex> lock(simMutex); // keeps the channel operator alive against network replacement
+    OutOperator* channelOperator = metaController.getOutputChannel(channel);
+    if (channelOperator == nullptr || out == nullptr) {
+        return 0;
+    }
+    size_t written = 0;
+    channelOperator->drainOutput(maxValues, [&](const int* values, size_t count) {
+        convert(values, count, out + written);
+        written += count;
+    });
+    return written;
+}
+
+size_t Simulator::readImageOutput(uint8_t* pixels, size_t maxPixels) {
+    return readChannelOutput(ChannelType::IMAGE, pixels, maxPixels, SampleCodec::messagesToBytes);
+}
+
+size_t Simulator::readTextOutput(char* out, size_t maxChars) {
+    return readChannelOutput(ChannelType::TEXT, reinterpret_cast<uint8_t*>(out), maxChars, SampleCodec::messagesToBytes);
+}
+
+size_t Simulator::readAudioOutput(int16_t* samples, size_t maxSamples) {
+    return readChannelOutput(ChannelType::AUDIO, samples, maxSamples, SampleCodec::messagesToSamples16);
+}
+
+bool Simulator::openTextStream(const std::string& filePath, const TextStreamOptions& options) {
+    // Purpose: To start streaming text from a file or pipe.
+    // Parameters: @param filePath - source, @param options - rate, buffer and backpressure settings.
+    // Return: @return True if the stream is open.
+    // Key Logic: The source is opened outside the lock, opening a named pipe waits for its writer.
+    std::unique_ptr<TextInputStream> stream;
+    try {
+        stream = TextInputStream::open(filePath, options);
+    } catch (const std::exception& e) {
+        ConsoleWriter() << "Error: " << e.what() << std::endl;
+        return false;
+    }
+    if (!stream) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(simMutex);
+    textStream = std::move(stream);
+    return true;
+}
+
+void Simulator::closeTextStream() {
+    std::lock_guard<std::mutex> lock(simMutex);
+    textStream.reset();
+}
+
+bool Simulator::getTextStreamStats(TextStreamStats& stats) const {
+    std::lock_guard<std::mutex> lock(simMutex);
+    if (!textStream) {
+        return false;
+    }
+    stats = textStream->getStats();
+    return true;
+}
+
+std::shared_ptr<OutputSubscription> Simulator::subscribeOutput(ChannelType channel, size_t batchSize) {
+    // Purpose: To let a consumer read an output channel without the simulation lock.
+    // Parameters: @param channel - output channel, @param batchSize - signalling fill level.
+    // Return: @return The subscription handle.
+    // Key Logic: Bound to the channel operator now and rebound whenever the network is replaced.
+    auto subscription = std::make_shared<OutputSubscription>(channel, batchSize);
+    std::lock_guard<std::mutex> lock(simMutex);
+    subscription->bind(metaController.getOutputChannel(channel));
+    outputSubscriptions.push_back(subscription);
+    subscription->notifyIfReady(1); // output may already be waiting
+    return subscription;
+}
+
+void Simulator::unsubscribeOutput(const std::shared_ptr<OutputSubscription>& subscription) {
+    std::lock_guard<std::mutex> lock(simMutex);
+    auto it = std::find(outputSubscriptions.begin(), outputSubscriptions.end(), subscription);
+    if (it != outputSubscriptions.end()) {
+        (*it)->bind(nullptr);
+        outputSubscriptions.erase(it);
+    }
+}
+
+void Simulator::bindSubscriptionsNoLock() {
+    for (const auto& subscription : outputSubscriptions) {
+        subscription->bind(metaController.getOutputChannel(subscription->getChannel()));
+    }
+}
+
+void Simulator::unbindSubscriptionsNoLock() {
+    for (const auto& subscription : outputSubscriptions) {
+        subscription->bind(nullptr); // waits for a poll in progress, later polls deliver nothing until rebound
+    }
+}
+
+void Simulator::notifySubscriptionsNoLock(size_t threshold) {
+    for (const auto& subscription : outputSubscriptions) {
+        subscription->notifyIfReady(threshold == 0 ? subscription->getBatchSize() : threshold);
+    }
+}
+
+void Simulator::resetStepStats() {
+    std::lock_guard<std::mutex> lock(simMutex);
+    stepStats.clear();
+    publishStatusNoLock(true);
+}
+
+void Simulator::startTrace() {
+    // Purpose: To start recording a trace of the simulation phases.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: Tracing is process-wide (Tracer), recording happens in the ATHENA_TRACE_SCOPE hooks of the controllers.
+    if (!Tracer::isCompiledIn()) {
+        ConsoleWriter() << "Warning: Tracing was compiled out (ATHENA_ENABLE_TRACING=OFF), no events will be recorded." << std::endl;
+        return;
+    }
+    Tracer::start();
+}
+
+bool Simulator::stopTrace(const std::string& filePath) {
+    // Purpose: To stop recording and write the trace.
+    // Parameters: @param filePath - Destination of the Chrome trace-event JSON.
+    // Return: @return True if the file was written.
+    // Key Logic: Stops first so no event is recorded while the rings are read.
+    Tracer::stop();
+    return Tracer::writeChromeTrace(filePath);
+}
+
+bool Simulator::generateNetworkFile(const NetworkSpec& spec, const std::string& filePath, GeneratedNetworkInfo* info) {
+    // Purpose: To write a synthetic network without building it in memory.
+    // Parameters: @param spec - network shape, @param filePath - destination, @param info - optional totals.
+    // Return: @return True if the file was written.
+    // Key Logic: No lock, the generator only reads the spec and never touches the controllers.
+    NetworkGenerator generator(spec);
+    return generator.writeConfiguration(filePath, info);
+}
+
+void Simulator::setLogLevel(AsyncLogger::Level level) {
+    AsyncLogger::get().setLevel(level);
+}
+
+void Simulator::setProfiling(bool enabled) {
+    // Purpose: To start or stop per-operator profiling.
+    // Parameters: @param enabled - True to attach the profiler to the TimeController.
+    // Return: Void.
+    // Key Logic: The counter array is sized to the network up front so recording does not grow it mid-step.
+    std::lock_guard<std::mutex> lock(simMutex);
+    profilingEnabled = enabled;
+    if (enabled) {
+        uint32_t maxId = 0;
+        for (const auto& layer : metaController.getAllLayers()) {
+            if (layer && !layer->isEmpty()) {
+                maxId = std::max(maxId, layer->getMaxOpID());
+            }
+        }
+        operatorProfiler.reserve(maxId);
+    }
+    timeController.setOperatorProfiler(enabled ? &operatorProfiler : nullptr);
+}
+
+void Simulator::setPipelinedUpdates(bool enabled, size_t minConcurrentUpdates) {
+    // Purpose: To switch between serial and pipelined update processing.
+    // Parameters: @param enabled - True for pipelined mode, @param minConcurrentUpdates - second thread threshold.
+    // Return: Void.
+    // Key Logic: Takes effect at the next step. Staged updates are applied on the way out so serial mode starts clean.
+    std::lock_guard<std::mutex> lock(simMutex);
+    pipelinedUpdates = enabled;
+    pipelineThreshold = minConcurrentUpdates;
+    if (!enabled) {
+        ContextScope context(*this);
+        updateController.ApplyStaged();
+    }
+}
+
+bool Simulator::isPipelinedUpdates() const {
+    std::lock_guard<std::mutex> lock(simMutex);
+    return pipelinedUpdates;
+}
+
+void Simulator::setUpdateThreads(size_t count) {
+    std::lock_guard<std::mutex> lock(simMutex);
+    updateController.SetWorkerThreads(count);
+}
+
+void Simulator::resetProfile() {
+    std::lock_guard<std::mutex> lock(simMutex);
+    operatorProfiler.clear();
+}
+
+std::string Simulator::getProfileReport(size_t topK, OperatorProfiler::Metric metric) const {
+    std::lock_guard<std::mutex> lock(simMutex);
+    std::string report = operatorProfiler.buildReport(metaController, topK, metric);
+    if (!profilingEnabled) {
+        report += "(profiling is off, counters are from the last profiled run)\n";
+    }
+    return report;
+}
+
 void Simulator::requestStop() {
     // Purpose: To signal the simulation to stop.
     // Parameters: None.
@@ -308,12 +726,13 @@ bool Simulator::isFinished(){
     if(!isRunning){ // cannot finish if not started
         return true;
     }
-    else if (!timeController.hasPayloads() && updateController.IsQueueEmpty()) {
-        ConsoleWriter() << "Simulation ended due to inactivity." << std::endl;
+    else if (!timeController.hasPayloads() && updateController.IsQueueEmpty()
+             && (!textStream || textStream->isDrained()) && imageInput.empty() && audioInput.empty()) {
+        AsyncLogger::get().info("sim.finished.inactive", {{"step", timeController.getCurrentStep()}});
         return true;
     }
     else if (timeController.getCurrentStep() >= DEFAULT_MAX_STEPS) {
-        ConsoleWriter() << "Simulation stopped after reaching max steps." << std::endl;
+        AsyncLogger::get().info("sim.finished.max_steps", {{"step", timeController.getCurrentStep()}});
         return true;
     }
 
@@ -328,9 +747,20 @@ void Simulator::submitText(const std::string& text) {
     // Return: Void.
     // Key Logic: Acquires a lock, iterates through the layers managed by MetaController to find an InputLayer instance, and calls its `inputText` method.
     std::lock_guard<std::mutex> lock(simMutex);
+    ContextScope context(*this);
     if(!metaController.inputText(text)) {
         ConsoleWriter() << "Warning: No InputLayer found to submit text." << std::endl;
     }
+    else if (text.size() > InOperator::MAX_ACCUMULATED_DATA) { // all characters arrive in the same step
+        ConsoleWriter() << "Warning: " << (text.size() - InOperator::MAX_ACCUMULATED_DATA) << " of " << text.size()
+                        << " characters exceed the per-step input limit of " << InOperator::MAX_ACCUMULATED_DATA
+                        << " and will be dropped, use a text stream for large inputs." << std::endl;
+    }
+}
+
+void Simulator::submitUpdate(const UpdateEvent& event) {
+    updateController.AddToQueue(event);
+    updateController.FlushThreadBatch(); // the caller may never step this simulator, publish right away
 }
 
 std::string Simulator::getOutput() {
@@ -361,30 +791,35 @@ SimulationStatus Simulator::getStatus() const {
     // Purpose: To get a snapshot of the simulation's current status.
     // Parameters: None.
     // Return: @return A SimulationStatus struct with current metrics.
-    // Key Logic: Acquires a lock for thread-safe reading of state from the controllers and returns the data in a struct.
-    std::lock_guard<std::mutex> lock(simMutex);
-    return {
-        timeController.getCurrentStep(),
-        timeController.getCurrentStepPayloadCount(),
-        timeController.getNextStepPayloadCount(),
-        updateController.QueueSize(),
-        metaController.getOpCount(),
-        metaController.getLayerCount()
-    };
+    // Key Logic: Never waits for a step. While a run is in progress (or another call holds the lock) the
+    //            snapshot published at the last step boundary is returned; when idle the lock is free and
+    //            the status is read from the controllers directly.
+    if (!isRunning) {
+        std::unique_lock<std::mutex> lock(simMutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            SimulationStatus status = getStatusNoLock();
+            status.stepStats = stepStats.summarize(); // percentiles sort the window, only computed on request
+            return status;
+        }
+    }
+    SimulationStatus status = publishedStatus.load();
+    status.stepStats = publishedStepStats.load();
+    return status;
 }
 
 // used internally, and carefully, as not thread safe intentionally
 SimulationStatus Simulator::getStatusNoLock() const {
     // Purpose: To get a snapshot of the simulation's current status.
     // Parameters: None.
-    // Return: @return A SimulationStatus struct with current metrics.
+    // Return: @return A SimulationStatus struct with current metrics (step statistics left empty, see getStatus).
     return {
         timeController.getCurrentStep(),
         timeController.getCurrentStepPayloadCount(),
         timeController.getNextStepPayloadCount(),
-        updateController.QueueSize(),
+        updateController.QueueSize() + updateController.StagedCount(), // staged: pipelined mode, applied next step
         metaController.getOpCount(),
-        metaController.getLayerCount()
+        metaController.getLayerCount(),
+        StepStatsSummary{}
     };
 }
 
@@ -0,0 +1,166 @@
+#include "../headers/util/StepStats.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+
+namespace {
+    constexpr double NS_PER_US = 1000.0;
+
+    /**
+     * @brief Nearest-rank percentile of already sorted values.
+     */
+    double percentile(const std::vector<double>& sorted, double fraction) {
+        size_t rank = static_cast<size_t>(fraction * static_cast<double>(sorted.size()) + 0.999999);
+        rank = std::clamp<size_t>(rank, 1, sorted.size());
+        return sorted[rank - 1];
+    }
+
+    void printRow(std::ostream& out, const char* name, const MetricSummary& metric) {
+        out << "  " << std::left << std::setw(22) << name << std::right
+                  << std::setw(12) << metric.last
+                  << std::setw(12) << metric.mean
+                  << std::setw(12) << metric.p50
+                  << std::setw(12) << metric.p95
+                  << std::setw(12) << metric.p99
+                  << std::setw(12) << metric.max << std::endl;
+    }
+}
+
+StepStats::StepStats(size_t windowSize) :
+    capacity(std::max<size_t>(windowSize, 1))
+{
+    window.reserve(capacity);
+}
+
+void StepStats::record(const StepSample& sample)
+{
+    // Purpose: Add a completed step's sample to the rolling window.
+    // Parameters: @param sample - The step's instrumentation.
+    // Return: Void.
+    // Key Logic: Appends until the window is full, then overwrites the oldest slot (ring buffer).
+    if (window.size() < capacity) {
+        window.push_back(sample);
+    } else {
+        window[next] = sample;
+    }
+    next = (next + 1) % capacity;
+    ++totalSteps;
+}
+
+StepSample StepStats::getLastSample() const
+{
+    if (window.empty()) {
+        return StepSample{};
+    }
+    return window[(next + capacity - 1) % capacity];
+}
+
+void StepStats::clear()
+{
+    window.clear();
+    next = 0;
+    totalSteps = 0;
+}
+
+template<typename Extract>
+MetricSummary StepStats::summarizeMetric(Extract field, std::vector<double>& scratch) const
+{
+    MetricSummary summary;
+    scratch.clear();
+    double sum = 0.0;
+    for (const StepSample& sample : window) {
+        double value = field(sample);
+        scratch.push_back(value);
+        sum += value;
+    }
+    summary.last = field(getLastSample());
+    summary.mean = sum / static_cast<double>(scratch.size());
+    std::sort(scratch.begin(), scratch.end());
+    summary.p50 = percentile(scratch, 0.50);
+    summary.p95 = percentile(scratch, 0.95);
+    summary.p99 = percentile(scratch, 0.99);
+    summary.max = scratch.back();
+    return summary;
+}
+
+StepStatsSummary StepStats::summarize() const
+{
+    // Purpose: Compute rolling averages and percentiles for every metric.
+    // Parameters: None.
+    // Return: @return StepStatsSummary - all zero when nothing was recorded.
+    // Key Logic: Each metric is copied into one local scratch vector, shared by all metrics, and sorted,
+    // so the cost is paid here (on request) rather than on every recorded step.
+    StepStatsSummary summary;
+    summary.windowSteps = window.size();
+    summary.totalSteps = totalSteps;
+    if (window.empty()) {
+        return summary;
+    }
+
+    std::vector<double> scratch; // local, so concurrent const calls do not share it
+    scratch.reserve(window.size());
+    auto micros = [](uint64_t ns) { return static_cast<double>(ns) / NS_PER_US; };
+
+    summary.traversalUs      = summarizeMetric([&](const StepSample& s) { return micros(s.traversalNs); }, scratch);
+    summary.operatorChecksUs = summarizeMetric([&](const StepSample& s) { return micros(s.operatorChecksNs); }, scratch);
+    summary.updatesUs        = summarizeMetric([&](const StepSample& s) { return micros(s.updatesNs); }, scratch);
+    summary.advanceUs        = summarizeMetric([&](const StepSample& s) { return micros(s.advanceNs); }, scratch);
+    summary.stepUs           = summarizeMetric([&](const StepSample& s) { return micros(s.totalNs()); }, scratch);
+
+    summary.messagesDelivered   = summarizeMetric([](const StepSample& s) { return static_cast<double>(s.messagesDelivered); }, scratch);
+    summary.payloadsCreated     = summarizeMetric([](const StepSample& s) { return static_cast<double>(s.payloadsCreated); }, scratch);
+    summary.payloadsDeactivated = summarizeMetric([](const StepSample& s) { return static_cast<double>(s.payloadsDeactivated); }, scratch);
+    summary.operatorsFired      = summarizeMetric([](const StepSample& s) { return static_cast<double>(s.operatorsFired); }, scratch);
+    summary.updatesApplied      = summarizeMetric([](const StepSample& s) { return static_cast<double>(s.updatesApplied); }, scratch);
+    return summary;
+}
+
+std::string StepStatsSummary::dominantPhase() const
+{
+    if (windowSteps == 0) {
+        return "none";
+    }
+    std::string phase = "traversal";
+    double highest = traversalUs.mean;
+    if (operatorChecksUs.mean > highest) { phase = "operator-checks"; highest = operatorChecksUs.mean; }
+    if (updatesUs.mean > highest)        { phase = "updates";         highest = updatesUs.mean; }
+    if (advanceUs.mean > highest)        { phase = "advance";         highest = advanceUs.mean; }
+    return phase;
+}
+
+void StepStatsSummary::print() const
+{
+    print(std::cout);
+}
+
+void StepStatsSummary::print(std::ostream& out) const
+{
+    out << "--- Step Stats (last " << windowSteps << " of " << totalSteps << " steps) ---" << std::endl;
+    if (windowSteps == 0) {
+        out << "No steps recorded." << std::endl;
+        return;
+    }
+    std::ios::fmtflags oldFlags = out.flags();
+    std::streamsize oldPrecision = out.precision();
+    out << std::fixed << std::setprecision(1);
+
+    out << "  " << std::left << std::setw(22) << "Phase time (us)" << std::right
+              << std::setw(12) << "last" << std::setw(12) << "mean" << std::setw(12) << "p50"
+              << std::setw(12) << "p95" << std::setw(12) << "p99" << std::setw(12) << "max" << std::endl;
+    printRow(out, "traversal", traversalUs);
+    printRow(out, "operator-checks", operatorChecksUs);
+    printRow(out, "updates", updatesUs);
+    printRow(out, "advance", advanceUs);
+    printRow(out, "step total", stepUs);
+
+    out << "  Counters (per step)" << std::endl;
+    printRow(out, "messages delivered", messagesDelivered);
+    printRow(out, "payloads created", payloadsCreated);
+    printRow(out, "payloads deactivated", payloadsDeactivated);
+    printRow(out, "operators fired", operatorsFired);
+    printRow(out, "updates applied", updatesApplied);
+    out << "Dominant phase: " << dominantPhase() << std::endl;
+
+    out.flags(oldFlags);
+    out.precision(oldPrecision);
+}
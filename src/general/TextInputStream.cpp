@@ -0,0 +1,109 @@
+#include "../headers/util/TextInputStream.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+TextInputStream::TextInputStream(int fileDescriptor, const TextStreamOptions& streamOptions, bool takeOwnership) :
+    fd(fileDescriptor),
+    ownsFd(takeOwnership),
+    options(streamOptions)
+{
+    if (fd < 0) {
+        throw std::invalid_argument("Text stream needs an open file descriptor.");
+    }
+    if (options.charsPerStep == 0) {
+        throw std::invalid_argument("Text stream rate must be at least 1 character per step.");
+    }
+    if (options.bufferCapacity < options.charsPerStep) {
+        throw std::invalid_argument("Text stream buffer must hold at least one step of characters.");
+    }
+    int flags = fcntl(fd, F_GETFL);
+    if (flags >= 0) {
+        fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    }
+    ring.resize(options.bufferCapacity);
+}
+
+std::unique_ptr<TextInputStream> TextInputStream::open(const std::string& path, const TextStreamOptions& streamOptions) {
+    int fileDescriptor = ::open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        std::cerr << "Error: Could not open text stream '" << path << "': " << std::strerror(errno) << std::endl;
+        return nullptr;
+    }
+    try {
+        return std::make_unique<TextInputStream>(fileDescriptor, streamOptions, true);
+    } catch (...) {
+        ::close(fileDescriptor);
+        throw;
+    }
+}
+
+TextInputStream::~TextInputStream() {
+    if (ownsFd && fd >= 0) {
+        ::close(fd);
+    }
+}
+
+void TextInputStream::refill() {
+    // Purpose: Top up the ring from the source.
+    // Parameters: None.
+    // Return: Void.
+    // Key Logic: Reads into the contiguous free region after the tail (twice when the free space wraps).
+    // EAGAIN means a pipe has nothing right now, 0 means end of file or the writer closed the pipe.
+    while (!stats.sourceExhausted && count < ring.size()) {
+        size_t tail = (head + count) % ring.size();
+        size_t contiguous = std::min(ring.size() - count, ring.size() - tail);
+        ssize_t bytesRead = ::read(fd, ring.data() + tail, contiguous);
+        if (bytesRead > 0) {
+            count += static_cast<size_t>(bytesRead);
+            stats.charsRead += static_cast<uint64_t>(bytesRead);
+            if (static_cast<size_t>(bytesRead) < contiguous) {
+                return; // the source had no more for now
+            }
+        } else if (bytesRead == 0) {
+            stats.sourceExhausted = true;
+        } else if (errno == EINTR) {
+            continue;
+        } else {
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                std::cerr << "Error: Text stream read failed: " << std::strerror(errno) << std::endl;
+                stats.sourceExhausted = true;
+            }
+            return;
+        }
+    }
+}
+
+size_t TextInputStream::nextStep(size_t inFlightPayloads, std::string& out) {
+    // Purpose: Hand the next step's characters to the caller.
+    // Parameters: @param inFlightPayloads - network load, @param out - receives the characters.
+    // Return: @return Number of characters taken.
+    // Key Logic: Backpressure first (nothing read, nothing fed), then refill below one step of characters,
+    // then copy out of the ring in at most two segments.
+    out.clear();
+    if (options.maxInFlightPayloads > 0 && inFlightPayloads >= options.maxInFlightPayloads) {
+        stats.throttledSteps++;
+        return 0;
+    }
+    if (count < options.charsPerStep) {
+        refill();
+    }
+    size_t take = std::min(options.charsPerStep, count);
+    size_t first = std::min(take, ring.size() - head);
+    out.append(ring.data() + head, first);
+    out.append(ring.data(), take - first);
+    head = (head + take) % ring.size();
+    count -= take;
+    stats.charsFed += take;
+    return take;
+}
+
+TextStreamStats TextInputStream::getStats() const {
+    TextStreamStats snapshot = stats;
+    snapshot.buffered = count;
+    return snapshot;
+}
@@ -5,12 +5,21 @@
 #include "../headers/operators/Operator.h"       // For calling Operator methods
 #include "../headers/Payload.h"        // For managing payload vectors
 #include <vector>
-#include <unordered_set>
 #include <stdexcept>        // Potentially for error handling
 #include <algorithm>        // For removing inactive payloads
 #include <cstddef>
 #include <iostream>         // For error logging
 #include <fstream>          // For file I/O
+#include <chrono>           // For per-phase step timing
+#include "../headers/util/Tracer.h"
+#include "../headers/util/OperatorProfiler.h"
+#include "../headers/util/AsyncLogger.h"
+
+namespace {
+    // Upper bound of what a state file's declared count may reserve up front
+    const uint64_t MAX_LOAD_RESERVE = 1 << 20;
+}
+
 /**
  * @brief Constructor for TimeController.
  * @param metaController A reference to the simulation's MetaController instance.
@@ -90,18 +99,31 @@ TimeController::~TimeController()
  * @details Orchestrates the execution of the distinct simulation phases for the current step
  * in the correct order: first process flagged operators (`processOperatorChecks`),
  * then process traveling payloads (`processPayloadTraversal`).
+ * Each phase is timed and its counters are recorded in `lastStepSample` (see getLastStepSample).
  */
 void TimeController::processCurrentStep()
 {
+    ATHENA_TRACE_SCOPE("TimeController::processCurrentStep");
     // order important, opposite would traverse but not allow new payloads to be made 
     // if occurred at end
     // meaning they would be stuck in waiting for processing, and
 
+    using Clock = std::chrono::steady_clock;
+    lastStepSample = StepSample{}; // counters are filled by the phases below
+    size_t scheduledBefore = nextStepPayloads.size();
+
     // Phase 1: Process payloads currently traveling in this step
+    Clock::time_point phaseStart = Clock::now();
     processPayloadTraversal();
+    Clock::time_point traversalEnd = Clock::now();
 
     // Phase 2: Check Operators flagged in the previous step and call processData
     processOperatorChecks(); // tricky state, meaning potential payloads could be waiting to be made, order important
+    Clock::time_point checksEnd = Clock::now();
+
+    lastStepSample.traversalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(traversalEnd - phaseStart).count();
+    lastStepSample.operatorChecksNs = std::chrono::duration_cast<std::chrono::nanoseconds>(checksEnd - traversalEnd).count();
+    lastStepSample.payloadsCreated = nextStepPayloads.size() - scheduledBefore;
 
     // Optionally, add logic here for checking simulation termination conditions.
 }
@@ -117,20 +139,27 @@ void TimeController::processCurrentStep()
  */
 void TimeController::advanceStep()
 {
+    ATHENA_TRACE_SCOPE("TimeController::advanceStep");
     // Append the newly scheduled payloads (from nextStepPayloads) to the end of the list
     // of payloads that are still traveling from the current step.
+    // Remember how many payloads were emitted this step, used as the reserve hint for the next one
+    lastStepEmittedCount = nextStepPayloads.size();
+
     // merge
     if (!nextStepPayloads.empty()) {
+        reserveAmortized(currentStepPayloads, currentStepPayloads.size() + nextStepPayloads.size());
         currentStepPayloads.insert(
             currentStepPayloads.end(),
             std::make_move_iterator(nextStepPayloads.begin()),
             std::make_move_iterator(nextStepPayloads.end())
         );
     }
-    // Clear the list that held the next step's payloads
+    // Clear the list that held the next step's payloads, clear() keeps the capacity so the
+    // buffer is reused as next step's emission area instead of being reallocated.
     nextStepPayloads.clear();
-    // Ensure vector capacity is managed if needed (clear might not shrink capacity)
-    // nextStepPayloads.shrink_to_fit(); // Optional memory optimization
+    // Pre-reserve for the upcoming step based on the last step's emission, with 50% headroom
+    // so a modest increase in firing does not reallocate mid-step.
+    reserveAmortized(nextStepPayloads, lastStepEmittedCount + lastStepEmittedCount / 2);
 
     // Increment step counter
     currentStep++;
@@ -149,6 +178,45 @@ void TimeController::addToNextStepPayloads(const Payload& payload)
     nextStepPayloads.push_back(payload);
 }
 
+/**
+ * @brief Constructs a new payload in place for processing starting next step.
+ * @param messageData The message carried by the new payload.
+ * @param sourceOperatorId The ID of the Operator starting the payload's journey.
+ * @return Void.
+ * @details Called by `Scheduler::emplacePayloadForNextStep` from Operator `processData`
+ * methods. The payload starts at distance 0 and active, same as `Payload(msg, opId)`.
+ */
+void TimeController::emplaceNextStepPayload(int messageData, uint32_t sourceOperatorId)
+{
+    nextStepPayloads.emplace_back(messageData, sourceOperatorId);
+}
+
+/**
+ * @brief Grows the next step's payload list ahead of a burst of emissions.
+ * @param additionalCount Number of payloads the caller is about to schedule.
+ * @return Void.
+ */
+void TimeController::reserveNextStepPayloads(size_t additionalCount)
+{
+    reserveAmortized(nextStepPayloads, nextStepPayloads.size() + additionalCount);
+}
+
+/**
+ * @brief [Private Helper] Reserves capacity for `required` payloads, growing geometrically.
+ * @param payloads The vector to grow.
+ * @param required The total number of elements the vector must be able to hold.
+ * @details `std::vector::reserve` allocates exactly what is asked for, so calling it with
+ * slowly increasing sizes would reallocate every time. Growing to at least double the
+ * current capacity keeps the amortized cost of repeated hints constant.
+ */
+void TimeController::reserveAmortized(std::vector<Payload>& payloads, size_t required)
+{
+    if (required <= payloads.capacity()) {
+        return;
+    }
+    payloads.reserve(std::max(required, payloads.capacity() * 2));
+}
+
 /**
  * @brief Delivers message data immediately to a target Operator and flags it for next step processing.
  * @param targetOperatorId The ID of the operator receiving the message.
@@ -167,6 +235,10 @@ void TimeController::deliverAndFlagOperator(uint32_t targetOperatorId, int messa
         // Operator found, and message delivered
         // Flag the operator for processing in the next step's Phase 1
         operatorsToProcess.insert(targetOperatorId);
+        ++lastStepSample.messagesDelivered;
+        if (operatorProfiler) {
+            operatorProfiler->recordDelivery(targetOperatorId);
+        }
     } else {
         // Operator not found (ID was dangling).
         // The cleanup should be triggered by the *source* Operator's traverse (not the destination operator that we just tried to access)
@@ -176,6 +248,20 @@ void TimeController::deliverAndFlagOperator(uint32_t targetOperatorId, int messa
     }
 }
 
+void TimeController::deliverBatchAndFlagOperator(uint32_t targetOperatorId, const int* values, size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+    if (metaControllerInstance.messageOpBatch(targetOperatorId, values, count)) {
+        operatorsToProcess.insert(targetOperatorId);
+        lastStepSample.messagesDelivered += count;
+        if (operatorProfiler) {
+            operatorProfiler->recordDeliveries(targetOperatorId, count);
+        }
+    }
+}
+
 /**
  * @brief Gets the current simulation time step number.
  * @return long long The current step number.
@@ -204,6 +290,33 @@ size_t TimeController::getNextStepPayloadCount() const
     return nextStepPayloads.size();
 }
 
+/**
+ * @brief Gets the number of payloads emitted during the previous step.
+ * @return size_t The count recorded by the last call to `advanceStep`.
+ */
+size_t TimeController::getLastStepEmittedCount() const
+{
+    return lastStepEmittedCount;
+}
+
+/**
+ * @brief Gets the instrumentation of the last processCurrentStep call.
+ * @return StepSample The traversal/operator check phase times and the step's counters.
+ */
+StepSample TimeController::getLastStepSample() const
+{
+    return lastStepSample;
+}
+
+/**
+ * @brief Attaches (or detaches with nullptr) the per-operator profiler.
+ * @param profiler The profiler to record into, not owned.
+ */
+void TimeController::setOperatorProfiler(OperatorProfiler* profiler)
+{
+    operatorProfiler = profiler;
+}
+
 // --- Private Helper Methods ---
 
 /**
@@ -215,12 +328,29 @@ size_t TimeController::getNextStepPayloadCount() const
  */
 void TimeController::processOperatorChecks()
 {
+    ATHENA_TRACE_SCOPE("TimeController::processOperatorChecks");
+    // An operator fired if its processData emitted, i.e. grew the next step's payload list
+    uint64_t fired = 0;
+
     // Process operators flagged in the previous step
-    for (uint32_t operatorId : operatorsToProcess) {
+    if (operatorProfiler) {
+        for (uint32_t operatorId : operatorsToProcess) {
+            size_t scheduledBefore = nextStepPayloads.size();
+            metaControllerInstance.processOpData(operatorId);
+            size_t emitted = nextStepPayloads.size() - scheduledBefore;
+            fired += emitted > 0 ? 1 : 0;
+            operatorProfiler->recordCheck(operatorId, emitted);
+        }
+    } else {
+        for (uint32_t operatorId : operatorsToProcess) {
+            size_t scheduledBefore = nextStepPayloads.size();
 
-        // metaController will call the appropriate operator and process its accumulated data
-        metaControllerInstance.processOpData(operatorId);
+            // metaController will call the appropriate operator and process its accumulated data
+            metaControllerInstance.processOpData(operatorId);
+            fired += nextStepPayloads.size() != scheduledBefore ? 1 : 0;
+        }
     }
+    lastStepSample.operatorsFired = fired;
 
     // Clear the set for the next cycle
     operatorsToProcess.clear();
@@ -235,33 +365,54 @@ void TimeController::processOperatorChecks()
  */
 void TimeController::processPayloadTraversal()
 {
+    ATHENA_TRACE_SCOPE("TimeController::processPayloadTraversal");
     // Iterate through payloads currently in transit for this step
     // TODO use pointer instead?
     for (Payload& payload : currentStepPayloads) { // Use reference to allow modification by traverse
         if (!payload.active) continue; // Skip already inactive payloads
+        if (operatorProfiler) {
+            operatorProfiler->recordTraversal(payload.currentOperatorId);
+        }
         
         // metaController will find the appropriate operator, and perform the necessary steps to traverse payload
         metaControllerInstance.traversePayload(&payload);
     }
 
-    if(currentStepPayloads.empty()){
-        std::cout << "(Before change) Current is empty: Step  " + currentStep << std::endl; 
-    }
     // Cleanup: Remove payloads marked as inactive during this step's traversal
     // Using erase-remove idiom
+    size_t payloadsBefore = currentStepPayloads.size();
     currentStepPayloads.erase(
         std::remove_if(currentStepPayloads.begin(), currentStepPayloads.end(),
                        [](const Payload& p){ return !p.active; }),
         currentStepPayloads.end()
     );
+    lastStepSample.payloadsDeactivated = payloadsBefore - currentStepPayloads.size();
 
-    if(currentStepPayloads.empty()){
-        std::cout << "(After change) Current is empty: Step  " + currentStep << std::endl; 
+    if (currentStepPayloads.empty() && payloadsBefore > 0) {
+        // debug only and once per idle stretch (the step the last payload finished), filtered without formatting
+        AsyncLogger::get().debug("time.traversal.idle", {{"step", currentStep}});
     }
     // will still contain payloads for the next timeStep, if the payload not set to false
 }
 
 
+void TimeController::collectStepSources(OperatorIdSet& operators) const {
+    for (const Payload& payload : currentStepPayloads) {
+        if (payload.active) {
+            operators.insert(payload.currentOperatorId);
+        }
+    }
+    for (uint32_t operatorId : operatorsToProcess) {
+        operators.insert(operatorId);
+    }
+}
+
+void TimeController::collectStepTargets(OperatorIdSet& operators) const {
+    for (const Payload& payload : currentStepPayloads) {
+        metaControllerInstance.collectPayloadTargets(payload, operators);
+    }
+}
+
 bool TimeController::hasPayloads() const {
     return currentStepPayloads.size() > 0 || nextStepPayloads.size() > 0 || operatorsToProcess.size() > 0; 
 }
@@ -274,6 +425,7 @@ bool TimeController::hasPayloads() const {
  * 
  */
 bool TimeController::loadState(const std::string& filePath) {
+    ATHENA_TRACE_SCOPE("TimeController::loadState");
     // TODO loadstate method will likely need to adopt way to load some of memory not all, as in memory size is limited. Offload to some other slower storage?
     std::ifstream inFile(filePath, std::ios::binary);
     if (!inFile.is_open()) {
@@ -286,6 +438,7 @@ bool TimeController::loadState(const std::string& filePath) {
     this->nextStepPayloads.clear();
     this->operatorsToProcess.clear();
     this->currentStep = 0; // Reset time step
+    this->lastStepEmittedCount = 0;
 
     try {
         // 2. Read Header (Counts)
@@ -384,16 +537,18 @@ std::vector<Payload> TimeController::loadPayloads(std::istream& in, uint64_t cou
  * @brief Loads a specific number of operator IDs (as uint32_t) from the input stream.
  * @private
  */
-std::unordered_set<uint32_t> TimeController::loadOperatorsToProcess(std::istream& in, uint64_t count) {
+OperatorIdSet TimeController::loadOperatorsToProcess(std::istream& in, uint64_t count) {
     // Purpose: Read 'count' uint32_t operator IDs from the stream.
     // Parameters: stream, count.
     // Return: Set of loaded uint32_t operator IDs. Throws on error.
     // Key Logic: Loops 'count' times, reads a fixed 4-byte block for each uint32_t,
     //            and deserializes it using the appropriate Serializer method.
+    //            IDs outside the network's layers are rejected before they reach the set.
 
-    std::unordered_set<uint32_t> loadedIds;
+    OperatorIdSet loadedIds;
     if (count > 0) {
-        loadedIds.reserve(static_cast<size_t>(count)); // Reserve space
+        // Reserve space, bounded: the count comes from the file, a corrupt one fails on the reads below instead
+        loadedIds.reserve(static_cast<size_t>(std::min<uint64_t>(count, MAX_LOAD_RESERVE)));
     }
 
     // A buffer to hold the bytes for one uint32_t
@@ -412,10 +567,14 @@ std::unordered_set<uint32_t> TimeController::loadOperatorsToProcess(std::istream
         const std::byte* dataEnd = dataPtr + idDataBuffer.size();
         uint32_t opId = Serializer::read_uint32(dataPtr, dataEnd);
 
-        // 3. Check for consumption and insert into the set.
+        // 3. Check for consumption and the network's ID ranges, then insert into the set.
         if (dataPtr != dataEnd) {
            throw std::runtime_error("Operator ID (uint32_t) deserialization did not consume entire block.");
         }
+        if (metaControllerInstance.findLayerForOperator(opId) == nullptr) {
+            // the set holds a flag per ID up to the highest one, a stray ID must not size it
+            throw std::runtime_error("Operator ID " + std::to_string(opId) + " is outside every layer's ID range.");
+        }
         loadedIds.insert(opId);
     }
     return loadedIds;
@@ -430,6 +589,7 @@ std::unordered_set<uint32_t> TimeController::loadOperatorsToProcess(std::istream
  * public 
  */
 bool TimeController::saveState(const std::string& filePath) const {
+    ATHENA_TRACE_SCOPE("TimeController::saveState");
     std::ofstream outFile(filePath, std::ios::binary | std::ios::trunc);
     if (!outFile.is_open()) {
         std::cerr << "Error: Could not open file for saving TimeController state: " << filePath << std::endl;
@@ -482,18 +642,29 @@ void TimeController::savePayloads(std::ostream& out, const std::vector<Payload>&
     // Purpose: Write active payloads from vector to stream using fixed-size serialization.
     // Parameters: stream, payload vector.
     // Return: void. Throws on error.
+    // Key Logic: Payloads are appended into one reused buffer and written in blocks, instead of a
+    // vector and a stream write per payload.
+    constexpr size_t PAYLOADS_PER_WRITE = 4096;
+    std::vector<std::byte> buffer;
+    buffer.reserve(PAYLOADS_PER_WRITE * Payload::SERIALIZED_SIZE);
+    auto flush = [&]() {
+        out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        if (!out.good()) {
+            throw std::runtime_error("Failed to write payload data during savePayloads.");
+        }
+        buffer.clear();
+    };
     for (const Payload& payload : payloads) {
         if (payload.active) {
-            // This now returns a fixed-size byte vector with no size prefix.
-            std::vector<std::byte> payloadBytes = payload.serializeToBytes(); 
-            if (!payloadBytes.empty()) {
-                 out.write(reinterpret_cast<const char*>(payloadBytes.data()), payloadBytes.size());
-                 if (!out.good()) {
-                     throw std::runtime_error("Failed to write payload data during savePayloads.");
-                 }
+            payload.appendBytes(buffer);
+            if (buffer.size() >= PAYLOADS_PER_WRITE * Payload::SERIALIZED_SIZE) {
+                flush();
             }
         }
     }
+    if (!buffer.empty()) {
+        flush();
+    }
 }
 
 /**
@@ -0,0 +1,251 @@
+#include "../headers/util/Tracer.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+std::atomic<bool> Tracer::enabled{false};
+
+namespace {
+    /**
+     * @brief One event slot. Fields are relaxed atomics so a dump may read a slot the owner is
+     * rewriting without a data race, torn events are then discarded (see collectEvents).
+     */
+    struct Slot {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> startNs{0};
+        std::atomic<uint64_t> durationNs{0};
+    };
+
+    /**
+     * @brief Ring buffer of one recording thread. Only the owning thread writes it.
+     * @details `written` counts every event of the current generation, the ring holds the last
+     * `capacity` of them. `claimed` is bumped before a slot is rewritten and `written` after, so a
+     * reader can tell which of the slots it copied may have been overwritten meanwhile. A ring
+     * belonging to an older generation is stale and is reset by its owner on the next record.
+     * When its thread exits the ring is released (`inUse` false) and the next new recording thread
+     * takes it over, so transient threads do not add rings; its events stay until overwritten.
+     */
+    struct ThreadRing {
+        std::unique_ptr<Slot[]> slots;
+        size_t capacity = 0;
+        std::atomic<uint64_t> claimed{0};
+        std::atomic<uint64_t> written{0};
+        std::atomic<uint64_t> generation{0};
+        std::atomic<bool> inUse{false};
+        uint32_t threadId = 0;
+    };
+
+    // Rings are only freed at exit, so events of threads that have exited can still be written out
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<ThreadRing>> registry;
+
+    std::atomic<uint64_t> traceGeneration{0}; // incremented by every start, 0 = never started
+    std::atomic<size_t> ringCapacity{Tracer::DEFAULT_EVENTS_PER_THREAD};
+    std::atomic<uint64_t> traceEpochNs{0};     // nowNs() at start, event times are relative to it
+
+    /**
+     * @brief The calling thread's claim on a ring, released when the thread exits.
+     */
+    struct RingOwner {
+        ThreadRing* ring = nullptr;
+
+        ~RingOwner() {
+            if (ring) {
+                ring->inUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local RingOwner localOwner;
+
+    /**
+     * @brief Gets the calling thread's ring, claiming a released one or registering a new one (once
+     * per thread), and resetting it when a new trace has started since its last event.
+     */
+    ThreadRing* acquireRing() {
+        ThreadRing* ring = localOwner.ring;
+        if (!ring) {
+            std::lock_guard<std::mutex> lock(registryMutex); // once per thread
+            for (const auto& candidate : registry) {
+                bool released = false;
+                if (candidate->inUse.compare_exchange_strong(released, true, std::memory_order_acq_rel)) {
+                    ring = candidate.get();
+                    break;
+                }
+            }
+            if (!ring) {
+                registry.push_back(std::make_unique<ThreadRing>());
+                ring = registry.back().get();
+                ring->inUse.store(true, std::memory_order_relaxed);
+                ring->threadId = static_cast<uint32_t>(registry.size());
+            }
+            localOwner.ring = ring;
+        }
+        uint64_t generation = traceGeneration.load(std::memory_order_acquire);
+        if (ring->generation.load(std::memory_order_relaxed) != generation) {
+            std::lock_guard<std::mutex> lock(registryMutex); // once per trace, readers never see a half reset
+            size_t capacity = ringCapacity.load(std::memory_order_relaxed);
+            if (ring->capacity != capacity) {
+                ring->slots.reset(new Slot[capacity]);
+                ring->capacity = capacity;
+            }
+            ring->claimed.store(0, std::memory_order_relaxed);
+            ring->written.store(0, std::memory_order_relaxed);
+            ring->generation.store(generation, std::memory_order_release);
+        }
+        return ring;
+    }
+
+    struct ThreadEvent {
+        TraceEvent event;
+        uint32_t threadId;
+    };
+
+    /**
+     * @brief Copies the retained events of the current trace out of every ring.
+     * @details A ring may be written while it is copied. The copy is checked against `claimed`
+     * afterwards (seqlock style) and events whose slot may have been reused are dropped.
+     */
+    std::vector<ThreadEvent> collectEvents() {
+        std::vector<ThreadEvent> collected;
+        uint64_t generation = traceGeneration.load(std::memory_order_acquire);
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (const auto& ring : registry) {
+            if (generation == 0 || ring->generation.load(std::memory_order_acquire) != generation) {
+                continue; // nothing recorded by this thread in the current trace
+            }
+            uint64_t written = ring->written.load(std::memory_order_acquire);
+            uint64_t capacity = ring->capacity;
+            uint64_t first = written - std::min(written, capacity);
+            size_t copiedFrom = collected.size();
+            for (uint64_t i = first; i < written; ++i) {
+                const Slot& slot = ring->slots[i % capacity];
+                TraceEvent event;
+                event.name = slot.name.load(std::memory_order_relaxed);
+                event.startNs = slot.startNs.load(std::memory_order_relaxed);
+                event.durationNs = slot.durationNs.load(std::memory_order_relaxed);
+                collected.push_back({event, ring->threadId});
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t claimed = ring->claimed.load(std::memory_order_relaxed);
+            uint64_t stale = claimed > capacity ? claimed - capacity : 0; // slots of indices below were reused
+            if (stale > first) {
+                size_t drop = static_cast<size_t>(std::min(stale, written) - first);
+                collected.erase(collected.begin() + copiedFrom, collected.begin() + copiedFrom + drop);
+            }
+        }
+        return collected;
+    }
+
+    void appendEscaped(std::ostringstream& out, const char* text) {
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') {
+                out << '\\';
+            }
+            out << *c;
+        }
+    }
+}
+
+void Tracer::start(size_t eventsPerThread)
+{
+    // Purpose: Begin a new trace.
+    // Parameters: @param eventsPerThread - Ring capacity of each recording thread.
+    // Return: Void.
+    // Key Logic: Bumping the generation invalidates every ring at once, each thread resets its own
+    // ring on its next event, so no ring is touched by two threads.
+    enabled.store(false, std::memory_order_relaxed);
+    ringCapacity.store(std::max<size_t>(eventsPerThread, 1), std::memory_order_relaxed);
+    traceEpochNs.store(nowNs(), std::memory_order_relaxed);
+    traceGeneration.fetch_add(1, std::memory_order_release);
+    enabled.store(true, std::memory_order_release);
+}
+
+void Tracer::stop()
+{
+    enabled.store(false, std::memory_order_release);
+}
+
+uint64_t Tracer::nowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Tracer::recordComplete(const char* name, uint64_t startNs, uint64_t endNs)
+{
+    // Purpose: Store one completed scope on the calling thread's ring.
+    // Parameters: @param name - static event name, @param startNs / endNs - nowNs() readings.
+    // Return: Void.
+    // Key Logic: Owner-only write into the slot between bumping `claimed` and `written`, the latter
+    // with release ordering publishes it. Once full the ring wraps and overwrites the oldest event.
+    if (!isEnabled()) {
+        return;
+    }
+    ThreadRing* ring = acquireRing();
+    uint64_t epoch = traceEpochNs.load(std::memory_order_relaxed);
+    uint64_t index = ring->written.load(std::memory_order_relaxed);
+
+    ring->claimed.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release); // a reader that sees the new slot values sees the claim
+    Slot& slot = ring->slots[index % ring->capacity];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.startNs.store(startNs > epoch ? startNs - epoch : 0, std::memory_order_relaxed);
+    slot.durationNs.store(endNs > startNs ? endNs - startNs : 0, std::memory_order_relaxed);
+    ring->written.store(index + 1, std::memory_order_release);
+}
+
+size_t Tracer::getEventCount()
+{
+    return collectEvents().size();
+}
+
+size_t Tracer::getRingCount()
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return registry.size();
+}
+
+std::string Tracer::toChromeTraceJson()
+{
+    // Purpose: Serialize the retained events in the Chrome trace-event format.
+    // Parameters: None.
+    // Return: @return std::string - the JSON document.
+    // Key Logic: Complete ("X") events with microsecond timestamps, one tid per recording thread.
+    std::vector<ThreadEvent> events = collectEvents();
+    std::sort(events.begin(), events.end(), [](const ThreadEvent& a, const ThreadEvent& b) {
+        return a.event.startNs < b.event.startNs;
+    });
+
+    std::ostringstream out;
+    out.setf(std::ios::fixed);
+    out.precision(3);
+    out << "{\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); ++i) {
+        const ThreadEvent& entry = events[i];
+        out << (i == 0 ? "" : ",") << "\n{\"name\":\"";
+        appendEscaped(out, entry.event.name ? entry.event.name : "unknown");
+        out << "\",\"cat\":\"athena\",\"ph\":\"X\""
+            << ",\"ts\":" << static_cast<double>(entry.event.startNs) / 1000.0
+            << ",\"dur\":" << static_cast<double>(entry.event.durationNs) / 1000.0
+            << ",\"pid\":1,\"tid\":" << entry.threadId << "}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return out.str();
+}
+
+bool Tracer::writeChromeTrace(const std::string& filePath)
+{
+    std::ofstream outFile(filePath, std::ios::trunc);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Could not open file for writing trace: " << filePath << std::endl;
+        return false;
+    }
+    outFile << toChromeTraceJson();
+    return static_cast<bool>(outFile);
+}
@@ -4,9 +4,13 @@
 #include "../headers/controllers/MetaController.h" // Required for coordinating updates
 #include "../headers/UpdateEvent.h"    // Required for event type and queue
 #include "../headers/util/Serializer.h"     // For reading size byte during load
-#include <queue>
+#include "../headers/util/Tracer.h"
+#include "../headers/util/OperatorIdSet.h"
+#include "../headers/Scheduler.h"
+#include "../headers/UpdateScheduler.h"
 #include <fstream>
 #include <vector>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
@@ -40,8 +44,7 @@ UpdateController::UpdateController(MetaController& metaController, const std::st
         if (!loadState(stateFilePath)) {
             std::cerr << "Warning: Failed to load initial UpdateController state from: " << stateFilePath << std::endl;
             // Ensure queue is empty if load failed
-            std::queue<UpdateEvent> emptyQueue;
-            std::swap(updateQueue, emptyQueue); // Clear queue efficiently
+            updateQueue.clear();
         } else {
             std::cout << "Successfully loaded initial UpdateController state. Queue size: " << updateQueue.size() << std::endl;
         }
@@ -67,6 +70,16 @@ void UpdateController::AddToQueue(const UpdateEvent& event)
     updateQueue.push(event);
 }
 
+/**
+ * @brief Publishes the calling thread's partially filled batch of events.
+ * @return Void.
+ * @details Only needed on threads other than the one calling ProcessUpdates.
+ */
+void UpdateController::FlushThreadBatch()
+{
+    updateQueue.flushLocal();
+}
+
 /**
  * @brief Processes all events currently in the update queue by dispatching to MetaController.
  * @param None
@@ -78,46 +91,423 @@ void UpdateController::AddToQueue(const UpdateEvent& event)
  */
 void UpdateController::ProcessUpdates()
 {
-    while (!updateQueue.empty()) {
-        UpdateEvent event = updateQueue.front();
-        updateQueue.pop();
-
-        // Dispatch event handling to MetaController
-        try { // Optional: Add try-catch around MetaController calls if handlers can throw
-            switch (event.type) {
-                case UpdateType::CREATE_OPERATOR:
-                    metaControllerInstance.handleCreateOperator(event.params);
-                    break;
-
-                case UpdateType::DELETE_OPERATOR:
-                    metaControllerInstance.handleDeleteOperator(event.targetOperatorId);
-                    break;
-
-                case UpdateType::CHANGE_OPERATOR_PARAMETER:
-                    metaControllerInstance.handleParameterChange(event.targetOperatorId, event.params);
-                    break;
-
-                case UpdateType::ADD_CONNECTION:
-                    metaControllerInstance.handleAddConnection(event.targetOperatorId, event.params);
-                    break;
-
-                case UpdateType::REMOVE_CONNECTION:
-                    metaControllerInstance.handleRemoveConnection(event.targetOperatorId, event.params);
-                    break;
-
-                 case UpdateType::MOVE_CONNECTION:
-                    metaControllerInstance.handleMoveConnection(event.targetOperatorId, event.params);
-                    break;
-
-                default: // Add cases for other UpdateTypes as needed
-                    // TODO: Log error or warning: Unhandled UpdateType
-                    break;
-            } // end switch
+    ATHENA_TRACE_SCOPE("UpdateController::ProcessUpdates");
+    lastReceivedCount = 0;
+    lastAppliedCount = 0;
+    if (!stagedEvents.empty()) {
+        ApplyStaged(); // staged events are older than anything still queued
+    }
+
+    // Drain until nothing is visible, handlers may themselves submit follow-up events
+    // which land in this thread's batch and are picked up by the next round.
+    if (!coalescingEnabled) {
+        size_t drained = 0;
+        while ((drained = updateQueue.drain([this](const UpdateEvent& event) { applyEvent(event); })) > 0) {
+            lastReceivedCount += drained;
+        }
+        lastAppliedCount = lastReceivedCount;
+        return;
+    }
+
+    while (true) {
+        batchEvents.clear();
+        size_t drained = updateQueue.drain([this](const UpdateEvent& event) { batchEvents.push_back(event); });
+        if (drained == 0) {
+            break;
+        }
+        lastReceivedCount += drained;
+        applyBatch();
+    }
+
+    // keys only live for one call, the vectors keep their capacity for the next step
+    batchEvents.clear();
+    for (CoalesceScratch& shard : scratch) {
+        shard.paramSlots.clear();
+        shard.connectionSlots.clear();
+    }
+}
+
+/**
+ * @brief Drains the queue into the staging area without applying anything.
+ * @return size_t Number of events staged by this call.
+ */
+size_t UpdateController::StageUpdates()
+{
+    ATHENA_TRACE_SCOPE("UpdateController::StageUpdates");
+    lastAppliedCount = 0;
+    lastReceivedCount = updateQueue.drain([this](const UpdateEvent& event) {
+        if (event.type == UpdateType::CREATE_OPERATOR || event.type == UpdateType::DELETE_OPERATOR) {
+            stagedLifecycleCount++;
+        }
+        stagedEvents.push_back(event);
+    });
+    return lastReceivedCount;
+}
+
+/**
+ * @brief Applies the staged events targeting one of `operators`, in queue order.
+ * @param operators Target operator IDs.
+ * @return size_t Number of staged events taken.
+ * @details One pass partitions the staging area in place: taken events go to batchEvents, the
+ * others are compacted to the front, both keep their order.
+ */
+size_t UpdateController::ApplyStagedFor(const OperatorIdSet& operators)
+{
+    ATHENA_TRACE_SCOPE("UpdateController::ApplyStagedFor");
+    if (stagedLifecycleCount > 0) {
+        size_t taken = stagedEvents.size();
+        ApplyStaged();
+        return taken;
+    }
+
+    batchEvents.clear();
+    size_t kept = 0;
+    for (size_t i = 0; i < stagedEvents.size(); ++i) {
+        if (operators.contains(stagedEvents[i].targetOperatorId)) {
+            batchEvents.push_back(stagedEvents[i]);
+        } else {
+            stagedEvents[kept++] = stagedEvents[i];
+        }
+    }
+    stagedEvents.resize(kept);
+
+    size_t taken = batchEvents.size();
+    if (taken > 0) {
+        applyBatchEvents();
+    }
+    return taken;
+}
+
+/**
+ * @brief Applies every staged event in queue order and empties the staging area.
+ */
+void UpdateController::ApplyStaged()
+{
+    ATHENA_TRACE_SCOPE("UpdateController::ApplyStaged");
+    if (stagedEvents.empty()) {
+        return;
+    }
+    batchEvents.swap(stagedEvents); // both vectors keep their capacity
+    stagedEvents.clear();
+    stagedLifecycleCount = 0;
+    applyBatchEvents();
+}
+
+size_t UpdateController::StagedCount() const
+{
+    return stagedEvents.size();
+}
+
+bool UpdateController::HasStagedLifecycleEvents() const
+{
+    return stagedLifecycleCount > 0;
+}
+
+/**
+ * @brief [Private Helper] Applies batchEvents in the current mode, then empties it.
+ */
+void UpdateController::applyBatchEvents()
+{
+    if (coalescingEnabled) {
+        applyBatch();
+    } else {
+        for (const UpdateEvent& event : batchEvents) {
+            applyEvent(event);
+        }
+        lastAppliedCount += batchEvents.size();
+    }
+
+    batchEvents.clear();
+    for (CoalesceScratch& shard : scratch) {
+        shard.paramSlots.clear();
+        shard.connectionSlots.clear();
+    }
+}
+
+/**
+ * @brief [Private Helper] Applies the drained batch, coalescing between lifecycle barriers.
+ * @details CREATE/DELETE change which operators exist, so events are never moved across them.
+ */
+void UpdateController::applyBatch()
+{
+    size_t segmentStart = 0;
+    for (size_t i = 0; i < batchEvents.size(); ++i) {
+        UpdateType type = batchEvents[i].type;
+        if (type == UpdateType::CREATE_OPERATOR || type == UpdateType::DELETE_OPERATOR) {
+            applySegment(segmentStart, i);
+            applyEvent(batchEvents[i]);
+            lastAppliedCount++;
+            segmentStart = i + 1;
+        }
+    }
+    applySegment(segmentStart, batchEvents.size());
+}
+
+/**
+ * @brief [Private Helper] Groups a barrier-free segment by target operator and applies each group.
+ * @param begin First index into batchEvents.
+ * @param end One past the last index into batchEvents.
+ * @details Sorting by (target ID, index) keeps every operator's events in submission order and,
+ * since layers own contiguous ID ranges, also visits the operators layer by layer.
+ */
+void UpdateController::applySegment(size_t begin, size_t end)
+{
+    if (begin >= end) {
+        return;
+    }
+
+    batchOrder.clear();
+    for (size_t i = begin; i < end; ++i) {
+        batchOrder.emplace_back(batchEvents[i].targetOperatorId, i);
+    }
+    std::sort(batchOrder.begin(), batchOrder.end());
+
+    size_t segmentSize = batchOrder.size();
+    size_t shardCount = 1;
+    if (workerThreadCount > 0 && segmentSize >= parallelThreshold) {
+        shardCount = workerThreadCount + 1;
+    }
+    if (scratch.size() < shardCount) {
+        scratch.resize(shardCount);
+    }
+
+    if (shardCount == 1) {
+        applyRuns(scratch[0], 0, segmentSize);
+        lastAppliedCount += scratch[0].appliedCount;
+        return;
+    }
+
+    // Split into roughly equal ID ranges, moving each cut forward so no operator spans two shards
+    shardBounds.clear();
+    size_t shardBegin = 0;
+    for (size_t s = 0; s < shardCount && shardBegin < segmentSize; ++s) {
+        size_t shardEnd = (s + 1 == shardCount) ? segmentSize
+                                                : std::max(shardBegin, segmentSize * (s + 1) / shardCount);
+        while (shardEnd > 0 && shardEnd < segmentSize && batchOrder[shardEnd].first == batchOrder[shardEnd - 1].first) {
+            ++shardEnd;
+        }
+        if (shardEnd > shardBegin) {
+            shardBounds.emplace_back(shardBegin, shardEnd);
+        }
+        shardBegin = shardEnd;
+    }
+
+    if (!workerPool) {
+        workerPool = std::make_unique<WorkerPool>(workerThreadCount);
+    }
+    // handlers may submit follow-up events, the workers reach the same simulator's schedulers as this thread
+    Scheduler* scheduler = Scheduler::getThreadInstance();
+    UpdateScheduler* updateScheduler = UpdateScheduler::getThreadInstance();
+    workerPool->parallelFor(shardBounds.size(), [this, scheduler, updateScheduler](size_t shard) {
+        ATHENA_TRACE_SCOPE("UpdateController::applyShard");
+        Scheduler::Scope schedulerScope(scheduler);
+        UpdateScheduler::Scope updateScope(updateScheduler);
+        applyRuns(scratch[shard], shardBounds[shard].first, shardBounds[shard].second);
+    });
+
+    for (size_t shard = 0; shard < shardBounds.size(); ++shard) {
+        lastAppliedCount += scratch[shard].appliedCount;
+    }
+}
+
+/**
+ * @brief [Private Helper] Coalesces and applies the operator runs of batchOrder[begin, end).
+ * @param shard Scratch owned by the calling thread for the duration of the call.
+ * @param begin First batchOrder entry, must start an operator's run.
+ * @param end One past the last batchOrder entry, must end an operator's run.
+ * @details May run concurrently with other shards. Each run only touches its own operator.
+ */
+void UpdateController::applyRuns(CoalesceScratch& shard, size_t begin, size_t end)
+{
+    shard.appliedCount = 0;
+    size_t runBegin = begin;
+    while (runBegin < end) {
+        uint32_t operatorId = batchOrder[runBegin].first;
+        size_t runEnd = runBegin + 1;
+        while (runEnd < end && batchOrder[runEnd].first == operatorId) {
+            ++runEnd;
+        }
+
+        coalesceOperatorEvents(shard, runBegin, runEnd);
+        shard.appliedCount += shard.operatorEvents.size();
+        try {
+            metaControllerInstance.handleOperatorUpdates(operatorId, shard.operatorEvents);
         } catch (const std::exception& e) {
-             // TODO: Log error from MetaController handler: e.what()
-             // Decide if processing should continue or stop on error
+            // Same policy as applyEvent, one failing operator does not stop the update loop
         }
-    } // end while queue not empty
+        runBegin = runEnd;
+    }
+}
+
+/**
+ * @brief [Private Helper] Merges the events of one operator into shard.operatorEvents.
+ * @param shard Scratch owned by the calling thread.
+ * @param runBegin First batchOrder entry of the operator.
+ * @param runEnd One past the last batchOrder entry of the operator.
+ * @details Parameter changes are keyed by parameter ID, add/remove by (target, distance). A later
+ * event with the same key overwrites the earlier one in place. Because a move only acts if the
+ * connection currently exists, the connection keys are retired at a move so nothing after it is
+ * merged with something before it.
+ */
+void UpdateController::coalesceOperatorEvents(CoalesceScratch& shard, size_t runBegin, size_t runEnd)
+{
+    std::vector<UpdateEvent>& operatorEvents = shard.operatorEvents;
+    operatorEvents.clear();
+    shard.paramGeneration++;
+    shard.connectionGeneration++;
+
+    for (size_t k = runBegin; k < runEnd; ++k) {
+        const UpdateEvent& event = batchEvents[batchOrder[k].second];
+
+        switch (event.type) {
+            case UpdateType::CHANGE_OPERATOR_PARAMETER: {
+                if (event.params.empty()) {
+                    break; // no parameter ID, ignored by every operator
+                }
+                CoalesceSlot& slot = shard.paramSlots[event.params[0]];
+                if (slot.generation == shard.paramGeneration) {
+                    operatorEvents[slot.index] = event; // last value wins
+                } else {
+                    slot = CoalesceSlot{operatorEvents.size(), shard.paramGeneration};
+                    operatorEvents.push_back(event);
+                }
+                break;
+            }
+
+            case UpdateType::ADD_CONNECTION:
+            case UpdateType::REMOVE_CONNECTION: {
+                if (event.params.size() < 2) {
+                    break; // missing target/distance, ignored by the layer
+                }
+                uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(event.params[0])) << 32)
+                             | static_cast<uint32_t>(event.params[1]);
+                CoalesceSlot& slot = shard.connectionSlots[key];
+                if (slot.generation == shard.connectionGeneration) {
+                    operatorEvents[slot.index] = event; // add then remove -> remove, remove then add -> add
+                } else {
+                    slot = CoalesceSlot{operatorEvents.size(), shard.connectionGeneration};
+                    operatorEvents.push_back(event);
+                }
+                break;
+            }
+
+            case UpdateType::MOVE_CONNECTION:
+                shard.connectionGeneration++; // the move depends on the connections before it
+                operatorEvents.push_back(event);
+                break;
+
+            default:
+                operatorEvents.push_back(event);
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Enables or disables batch mode for ProcessUpdates.
+ * @param enabled True to coalesce, false to apply events one by one.
+ */
+void UpdateController::SetCoalescing(bool enabled)
+{
+    coalescingEnabled = enabled;
+}
+
+/**
+ * @brief Checks whether batch mode is enabled.
+ * @return bool True if ProcessUpdates coalesces events.
+ */
+bool UpdateController::IsCoalescing() const
+{
+    return coalescingEnabled;
+}
+
+/**
+ * @brief Sets the worker thread count of the parallel update phase.
+ * @param count Threads besides the caller, 0 for a serial update phase.
+ * @details The pool is restarted lazily with the new size on the next parallel segment.
+ */
+void UpdateController::SetWorkerThreads(size_t count)
+{
+    if (count != workerThreadCount) {
+        workerPool.reset();
+        workerThreadCount = count;
+    }
+}
+
+/**
+ * @brief Gets the worker thread count of the parallel update phase.
+ */
+size_t UpdateController::GetWorkerThreads() const
+{
+    return workerThreadCount;
+}
+
+/**
+ * @brief Sets the minimum segment size applied in parallel.
+ */
+void UpdateController::SetParallelThreshold(size_t minEvents)
+{
+    parallelThreshold = minEvents;
+}
+
+/**
+ * @brief Number of events drained by the last ProcessUpdates call.
+ */
+size_t UpdateController::LastReceivedCount() const
+{
+    return lastReceivedCount;
+}
+
+/**
+ * @brief Number of events applied after coalescing by the last ProcessUpdates call.
+ */
+size_t UpdateController::LastAppliedCount() const
+{
+    return lastAppliedCount;
+}
+
+/**
+ * @brief [Private Helper] Dispatches a single event to the matching MetaController handler.
+ * @param event The UpdateEvent to apply.
+ * @details Handler exceptions are contained so one bad event does not stop the update loop.
+ */
+void UpdateController::applyEvent(const UpdateEvent& event)
+{
+    // Dispatch event handling to MetaController
+    try { // Optional: Add try-catch around MetaController calls if handlers can throw
+        switch (event.type) {
+            case UpdateType::CREATE_OPERATOR:
+                metaControllerInstance.handleCreateOperator(event.params);
+                break;
+
+            case UpdateType::DELETE_OPERATOR:
+                metaControllerInstance.handleDeleteOperator(event.targetOperatorId);
+                break;
+
+            case UpdateType::CHANGE_OPERATOR_PARAMETER:
+                metaControllerInstance.handleParameterChange(event.targetOperatorId, event.params);
+                break;
+
+            case UpdateType::ADD_CONNECTION:
+                metaControllerInstance.handleAddConnection(event.targetOperatorId, event.params);
+                break;
+
+            case UpdateType::REMOVE_CONNECTION:
+                metaControllerInstance.handleRemoveConnection(event.targetOperatorId, event.params);
+                break;
+
+             case UpdateType::MOVE_CONNECTION:
+                metaControllerInstance.handleMoveConnection(event.targetOperatorId, event.params);
+                break;
+
+            default: // Add cases for other UpdateTypes as needed
+                // TODO: Log error or warning: Unhandled UpdateType
+                break;
+        } // end switch
+    } catch (const std::exception& e) {
+         // TODO: Log error from MetaController handler: e.what()
+         // Decide if processing should continue or stop on error
+    }
 }
 
 /**
@@ -145,10 +535,11 @@ size_t UpdateController::QueueSize() const
  * @brief Saves the current queue of UpdateEvents to a file.
  */
 bool UpdateController::saveState(const std::string& filePath) const { // const ensures not going to modify data
+    ATHENA_TRACE_SCOPE("UpdateController::saveState");
     // Purpose: Save queued UpdateEvents to file.
     // Parameters: filePath.
     // Return: True on success, False otherwise.
-    // Key Logic: Open file, copy queue, iterate copy, serialize event, write block, close.
+    // Key Logic: Open file, write the staged events (pipelined mode) then the queued ones, in apply order, close.
 
     std::ofstream outFile(filePath, std::ios::binary | std::ios::trunc);
     if (!outFile.is_open()) {
@@ -156,24 +547,25 @@ bool UpdateController::saveState(const std::string& filePath) const { // const e
         return false;
     }
 
-    // Copy the queue to iterate without modifying the original during save
-    std::queue<UpdateEvent> queueCopy = updateQueue; // TODO copying not quite ideal, for memory
-    // necessary to pop etc, would have to reinsert
-    // but we could just, track an index, and re-push once we pop
-    try {
-        while (!queueCopy.empty()) {
-            const UpdateEvent& event = queueCopy.front(); // Get ref to front
+    auto writeEvent = [&outFile](const UpdateEvent& event) {
+        std::vector<std::byte> eventBytes = event.serializeToBytes(); // Includes 1-byte size prefix
 
-            std::vector<std::byte> eventBytes = event.serializeToBytes(); // Includes 1-byte size prefix
+        if (!eventBytes.empty()) { // Should always have size byte
+             outFile.write(reinterpret_cast<const char*>(eventBytes.data()), eventBytes.size());
+             if (!outFile.good()) {
+                 throw std::runtime_error("Failed to write UpdateEvent data.");
+             }
+        }
+    };
 
-            if (!eventBytes.empty()) { // Should always have size byte
-                 outFile.write(reinterpret_cast<const char*>(eventBytes.data()), eventBytes.size());
-                 if (!outFile.good()) {
-                     throw std::runtime_error("Failed to write UpdateEvent data.");
-                 }
-            }
-            queueCopy.pop(); // Remove element from copy
+    try {
+        // Staged events are older than anything queued, a checkpoint between StageUpdates and
+        // ApplyStaged keeps them. Loading puts everything back into the queue in this order.
+        for (const UpdateEvent& event : stagedEvents) {
+            writeEvent(event);
         }
+        // Visit the queued events in order without consuming them (no copy of the queue needed)
+        updateQueue.forEach(writeEvent);
     } catch (const std::exception& e) {
         std::cerr << "Error: Exception during UpdateController::saveState: " << e.what() << std::endl;
         outFile.close();
@@ -188,6 +580,7 @@ bool UpdateController::saveState(const std::string& filePath) const { // const e
  * @brief Loads a queue of UpdateEvents from a file.
  */
 bool UpdateController::loadState(const std::string& filePath) {
+    ATHENA_TRACE_SCOPE("UpdateController::loadState");
     // Purpose: Load UpdateEvents from file into queue.
     // Parameters: filePath.
     // Return: True on success, False otherwise.
@@ -200,10 +593,9 @@ bool UpdateController::loadState(const std::string& filePath) {
     }
 
     // 1. Clear the existing queue
-    // std::queue<UpdateEvent>().swap(updateQueue); // Efficient way to clear
-    // TODO is swap really efficient? 
-     std::queue<UpdateEvent> emptyQueue;
-     std::swap(updateQueue, emptyQueue);
+    updateQueue.clear();
+    stagedEvents.clear();
+    stagedLifecycleCount = 0;
 
 
     try {
@@ -246,15 +638,16 @@ bool UpdateController::loadState(const std::string& filePath) {
             // Use AddToQueue if it does more than just push (e.g., logging)
             // AddToQueue(loadedEvent);
             // Or just push directly if AddToQueue is simple
-            updateQueue.push(std::move(loadedEvent));
+            updateQueue.push(loadedEvent);
 
         } // End while loop
+        updateQueue.flushLocal(); // pushed into this thread's batch, ProcessUpdates may run on another thread
 
     } catch (const std::exception& e) {
         std::cerr << "Error: Exception during UpdateController::loadState: " << e.what() << std::endl;
-        // Clear potentially partially loaded state
-        std::queue<UpdateEvent> emptyQueueOnError;
-        std::swap(updateQueue, emptyQueueOnError);
+        // Clear potentially partially loaded state, this thread's unflushed batch included
+        updateQueue.flushLocal();
+        updateQueue.clear();
         inFile.close();
         return false; // Loading failed
     }
@@ -6,11 +6,12 @@
 #include <vector>
 #include <mutex>
 #include <stdexcept>
-#include <algorithm> // For std::find in destructor
+#include <algorithm> // For std::find in destructor, std::stable_partition in ResetInstances
 
 // Initialize static members
 std::vector<UpdateScheduler*> UpdateScheduler::instances;
 std::mutex UpdateScheduler::instanceMutex;
+std::atomic<UpdateScheduler*> UpdateScheduler::defaultInstance{nullptr};
 
 /**
  * @brief Private constructor. Use CreateInstance factory method.
@@ -43,6 +44,7 @@ UpdateScheduler::~UpdateScheduler()
     if (it != instances.end()) {
         // Remove the pointer from the vector
         instances.erase(it);
+        defaultInstance.store(instances.empty() ? nullptr : instances.front(), std::memory_order_release);
     }
     // Mutex is automatically unlocked when lock_guard goes out of scope
 }
@@ -64,30 +66,55 @@ UpdateScheduler* UpdateScheduler::CreateInstance(UpdateController* controller)
     }
     std::lock_guard<std::mutex> lock(instanceMutex); // Lock for safe modification
     UpdateScheduler* newInstance = new UpdateScheduler(controller);
+    newInstance->ownedByRegistry = true; // deleted by ResetInstances
     instances.push_back(newInstance);
+    defaultInstance.store(instances.front(), std::memory_order_release);
     // Mutex is automatically unlocked here
     return newInstance;
 }
 
 /**
- * @brief Gets the default (first) UpdateScheduler instance.
- * @return UpdateScheduler* Pointer to the default UpdateScheduler instance.
+ * @brief [Factory Method] Creates and registers a UpdateScheduler instance owned by the caller.
+ * @param controller Pointer to the UpdateController instance this UpdateScheduler interacts with.
+ * @return std::unique_ptr<UpdateScheduler> The instance, its destructor unregisters it.
+ * @details Registered like CreateInstance's instances (it may be the default get() result), but
+ * ResetInstances skips it, so only the owner ever deletes it.
+ * @throws std::invalid_argument if the provided controller pointer is null.
+ */
+std::unique_ptr<UpdateScheduler> UpdateScheduler::CreateOwnedInstance(UpdateController* controller)
+{
+    if (!controller) {
+        throw std::invalid_argument("Cannot create UpdateScheduler instance with a null UpdateController.");
+    }
+    std::unique_ptr<UpdateScheduler> newInstance(new UpdateScheduler(controller));
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    instances.push_back(newInstance.get());
+    defaultInstance.store(instances.front(), std::memory_order_release);
+    return newInstance;
+}
+
+/**
+ * @brief Gets the calling thread's UpdateScheduler instance, or the default (first) one.
+ * @return UpdateScheduler* Pointer to the thread's or the default UpdateScheduler instance.
  * @throws std::runtime_error if no UpdateScheduler instance exists (i.e., CreateInstance was never called or all instances were destroyed).
- * @details Acquires a lock, checks if the static `instances` vector is empty. If not,
- * returns the pointer to the first element (assumed to be the default). Otherwise,
- * throws an exception. This method is used by Operators or other components to
- * submit UpdateEvents.
+ * @details Returns the instance a Scope installed on the calling thread. Otherwise
+ * reads the cached pointer to the first element of `instances` (assumed to be the default),
+ * kept in sync by CreateInstance and the destructor. Throws if no instance exists.
+ * Does not take `instanceMutex`, since operators call this for every submitted UpdateEvent.
  * @note Operators/components use this to submit update events.
  */
 UpdateScheduler* UpdateScheduler::get()
 {
-    std::lock_guard<std::mutex> lock(instanceMutex); // Lock for safe access
-    if (instances.empty()) {
+    if (threadInstance) {
+        return threadInstance; // the simulator stepping on this thread
+    }
+    // Lock-free read of the cached default instance, this is on every operator's submit path
+    UpdateScheduler* instance = defaultInstance.load(std::memory_order_acquire);
+    if (!instance) {
         throw std::runtime_error("UpdateScheduler::get() called but no UpdateScheduler instance exists.");
     }
     // Return the first instance as the default
-    return instances.front();
-    // Mutex is automatically unlocked here
+    return instance;
 }
 
 /**
@@ -112,19 +139,36 @@ void UpdateScheduler::Submit(const UpdateEvent& event)
 }
 
 /**
- * @brief Clears all UpdateScheduler instances. Useful for simulation reset/shutdown.
- * @details Acquires a lock, iterates through the static `instances` vector,
- * deletes each pointed-to UpdateScheduler object (calling their destructors which
- * will attempt to remove them from the list, although we clear it anyway),
- * and finally clears the vector itself.
- * @warning This permanently deletes all UpdateScheduler instances. Use with caution,
- * typically only during application shutdown or a full simulation reset.
+ * @brief Publishes the calling thread's buffered update events.
+ * @return Void.
+ * @details Forwards to UpdateController::FlushThreadBatch.
+ */
+void UpdateScheduler::Flush()
+{
+    if (updateControllerInstance) {
+        updateControllerInstance->FlushThreadBatch();
+    }
+}
+
+/**
+ * @brief Deletes every UpdateScheduler instance created by CreateInstance. Useful for test reset/shutdown.
+ * @details Acquires a lock, moves the registry-owned pointers out of the static `instances`
+ * vector and deletes them once the lock is released (their destructors take it to unregister).
+ * Instances created by CreateOwnedInstance belong to a Simulator and stay registered, their
+ * owner deletes them.
+ * @warning This permanently deletes the registry-owned instances. Use with caution,
+ * typically only during application shutdown or between tests.
  */
 void UpdateScheduler::ResetInstances() {
     std::vector<UpdateScheduler*> instances_to_delete;
     {
         std::lock_guard<std::mutex> lock(instanceMutex);
-        instances.swap(instances_to_delete);
+        // Instances of CreateOwnedInstance (each Simulator's) stay listed, their owners delete them
+        auto owned = std::stable_partition(instances.begin(), instances.end(),
+                                           [](const UpdateScheduler* instance) { return !instance->ownedByRegistry; });
+        instances_to_delete.assign(owned, instances.end());
+        instances.erase(owned, instances.end());
+        defaultInstance.store(instances.empty() ? nullptr : instances.front(), std::memory_order_release);
     } 
 
     for (UpdateScheduler* instance : instances_to_delete) {
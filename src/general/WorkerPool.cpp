@@ -0,0 +1,239 @@
+#include "../headers/util/WorkerPool.h"
+#include <algorithm>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+    // Process-wide pinning of new pools (setCpuPinning)
+    std::atomic<bool> pinWorkers{false};
+    std::atomic<size_t> nextWorkerCpu{1}; // CPU of the next pinned worker, every pool takes the following ones
+
+    // Pins `thread` to `cpu` modulo the hardware threads
+    bool pinThread(std::thread::native_handle_type thread, size_t cpu) {
+#ifdef __linux__
+        unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(static_cast<int>(cpu % hardwareThreads), &cpus);
+        return pthread_setaffinity_np(thread, sizeof(cpus), &cpus) == 0;
+#else
+        (void)thread;
+        (void)cpu;
+        return false;
+#endif
+    }
+}
+
+/**
+ * @brief Starts the worker threads.
+ * @param workerCount Number of threads besides the caller.
+ * @details With setCpuPinning enabled, the workers are pinned to the next workerCount CPUs after
+ * the previous pinned pool's, so pools of one simulation (updates, pipelined updates) do not share CPUs.
+ */
+WorkerPool::WorkerPool(size_t workerCount) {
+    workers.reserve(workerCount);
+    bool pin = pinWorkers.load(std::memory_order_relaxed);
+    size_t firstCpu = pin ? nextWorkerCpu.fetch_add(workerCount, std::memory_order_relaxed) : 0;
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back([this] { workerLoop(); });
+        if (pin) {
+            pinThread(workers.back().native_handle(), firstCpu + i);
+        }
+    }
+}
+
+/**
+ * @brief Stops and joins all worker threads.
+ */
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (std::thread& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+size_t WorkerPool::getThreadCount() const {
+    return workers.size() + 1;
+}
+
+size_t WorkerPool::defaultWorkerCount() {
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void WorkerPool::setCpuPinning(bool enabled, size_t firstCpu) {
+    nextWorkerCpu.store(firstCpu, std::memory_order_relaxed);
+    pinWorkers.store(enabled, std::memory_order_relaxed);
+}
+
+bool WorkerPool::pinCurrentThread(size_t cpu) {
+#ifdef __linux__
+    return pinThread(pthread_self(), cpu);
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/**
+ * @brief Pins the calling thread, remembering the CPUs it was allowed to run on.
+ */
+ScopedThreadPin::ScopedThreadPin(size_t cpu) {
+#ifdef __linux__
+    cpu_set_t original;
+    CPU_ZERO(&original);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(original), &original) != 0) {
+        return; // could not be restored, leave the thread alone
+    }
+    for (int i = 0; i < CPU_SETSIZE; ++i) {
+        if (CPU_ISSET(i, &original)) {
+            originalCpus.push_back(i);
+        }
+    }
+    pinned = WorkerPool::pinCurrentThread(cpu);
+#else
+    (void)cpu;
+#endif
+}
+
+/**
+ * @brief Restores the CPUs the thread was allowed to run on before the pin.
+ */
+ScopedThreadPin::~ScopedThreadPin() {
+#ifdef __linux__
+    if (!pinned) {
+        return;
+    }
+    cpu_set_t original;
+    CPU_ZERO(&original);
+    for (int cpu : originalCpus) {
+        CPU_SET(cpu, &original);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+#endif
+}
+
+/**
+ * @brief Runs `task(i)` for every i in [0, count) and waits for completion.
+ */
+void WorkerPool::parallelFor(size_t count, const std::function<void(size_t)>& task) {
+    // Purpose: Fork/join a phase of independent tasks.
+    // Parameters: count - number of tasks, task - callable taking the index.
+    // Return: Void, rethrows the first task exception.
+    // Key Logic: Publish the task under the mutex, wake the workers, help out on this thread,
+    // then wait until every worker has left the phase so `task` can safely go out of scope.
+    if (count == 0) {
+        return;
+    }
+    if (workers.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    dispatch(count, task);
+    runTasks(task);
+    join();
+}
+
+/**
+ * @brief Starts a phase on the workers without taking part in it.
+ */
+void WorkerPool::dispatch(size_t count, const std::function<void(size_t)>& task) {
+    // Purpose: Let the caller overlap its own work with a phase.
+    // Parameters: count - number of tasks, task - callable taking the index, alive until join().
+    // Return: Void.
+    // Key Logic: Same publication as parallelFor, the caller joins later instead of helping out.
+    join(); // an abandoned phase (its joiner threw) must not see its task replaced mid-run
+    if (count == 0) {
+        return;
+    }
+    if (workers.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentTask = &task;
+        taskCount = count;
+        nextTask.store(0, std::memory_order_relaxed);
+        busyWorkers = workers.size();
+        firstError = nullptr;
+        phaseActive = true;
+        phase++;
+    }
+    wakeCondition.notify_all();
+}
+
+/**
+ * @brief Waits until every worker has left the dispatched phase.
+ */
+void WorkerPool::join() {
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!phaseActive) {
+            return;
+        }
+        doneCondition.wait(lock, [this] { return busyWorkers == 0; });
+        currentTask = nullptr;
+        phaseActive = false;
+        error = firstError;
+        firstError = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void WorkerPool::runTasks(const std::function<void(size_t)>& task) {
+    size_t index;
+    while ((index = nextTask.fetch_add(1, std::memory_order_relaxed)) < taskCount) {
+        try {
+            task(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!firstError) {
+                firstError = std::current_exception();
+            }
+        }
+    }
+}
+
+void WorkerPool::workerLoop() {
+    uint64_t seenPhase = 0;
+    while (true) {
+        const std::function<void(size_t)>* task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeCondition.wait(lock, [this, seenPhase] { return stopping || phase != seenPhase; });
+            if (stopping) {
+                return;
+            }
+            seenPhase = phase;
+            task = currentTask;
+        }
+
+        runTasks(*task);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busyWorkers--;
+            if (busyWorkers == 0) {
+                doneCondition.notify_one();
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "layers/ChannelType.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+
+class OutOperator;
+
+/**
+ * @class OutputSubscription
+ * @brief A consumer's handle on one output channel, read without the simulation lock.
+ *
+ * @details Created by Simulator::subscribeOutput. The output values stay in the channel operator's
+ * lock-free ring (OutOperator::drainOutput); the subscriber reads them on its own thread with `poll`
+ * or `waitAndPoll`, so reading never stalls a step. At each step boundary the run loop checks the
+ * channel's fill level (one atomic load) and, once `batchSize` values are waiting, signals the
+ * subscription: waiters wake up and the notification descriptor becomes readable, so the
+ * subscription can sit in a poll/epoll set next to sockets. The end of a run signals any remainder.
+ *
+ * A channel is drained by whoever reads it first: two subscriptions on one channel (or a subscription
+ * plus Simulator::getOutput) split its values between them.
+ *
+ * Thread-safety: `poll`, `waitAndPoll`, `available` and the getters may be called from any thread.
+ * The Simulator rebinds the subscription when the network is replaced, readers then continue on the
+ * new network's channel.
+ */
+class OutputSubscription {
+public:
+    /**
+     * @brief Receives a batch of output values. The values are only valid during the call.
+     */
+    using BatchCallback = std::function<void(const int* values, size_t count)>;
+
+private:
+    const ChannelType channel;
+    const size_t batchSize;
+
+    mutable std::mutex sourceMutex; // guards source against rebinding while a reader drains it
+    OutOperator* source = nullptr;
+
+    std::mutex waitMutex;
+    std::condition_variable waitCondition;
+    std::atomic<bool> signalled{false};
+    int eventFd = -1;
+
+    // Sets the signal and wakes waiters, once until a reader consumes it
+    void signal();
+
+    // Takes the signal, resets the notification descriptor
+    void clearSignal();
+
+public:
+    /**
+     * @brief Creates an unbound subscription (Simulator::subscribeOutput binds it).
+     * @param outputChannel Channel to read.
+     * @param valuesPerBatch Fill level that signals the subscriber, also the most values per callback.
+     */
+    OutputSubscription(ChannelType outputChannel, size_t valuesPerBatch);
+
+    ~OutputSubscription();
+
+    /**
+     * @brief Delivers the values waiting on the channel, oldest first, without blocking.
+     * @param callback Called once per batch of at most batchSize values (a batch can arrive in two
+     * parts when the ring wraps).
+     * @param maxValues Most values delivered by this call.
+     * @return size_t Number of values delivered.
+     */
+    size_t poll(const BatchCallback& callback, size_t maxValues = std::numeric_limits<size_t>::max());
+
+    /**
+     * @brief Waits until the subscription is signalled or `timeout` passes, then polls.
+     * @return size_t Number of values delivered, 0 on timeout with nothing waiting.
+     */
+    size_t waitAndPoll(std::chrono::milliseconds timeout, const BatchCallback& callback,
+                       size_t maxValues = std::numeric_limits<size_t>::max());
+
+    /**
+     * @brief Number of values waiting on the channel (a snapshot).
+     */
+    size_t available() const;
+
+    /**
+     * @brief A descriptor that is readable while the subscription is signalled (Linux eventfd).
+     * @return int The descriptor, or -1 if it could not be created (waitAndPoll still works).
+     * @details Owned by the subscription. poll/waitAndPoll reset it.
+     */
+    int getNotificationFd() const { return eventFd; }
+
+    ChannelType getChannel() const { return channel; }
+
+    size_t getBatchSize() const { return batchSize; }
+
+    /**
+     * @brief Points the subscription at a channel operator, nullptr when the network has none.
+     * @details Called by Simulator when the network changes, under the simulation lock.
+     */
+    void bind(OutOperator* channelOperator);
+
+    /**
+     * @brief Signals the subscriber if at least `threshold` values are waiting.
+     * @details Called by Simulator at step boundaries (threshold batchSize) and at the end of a run (threshold 1).
+     */
+    void notifyIfReady(size_t threshold);
+
+    // Prevent copying/assignment
+    OutputSubscription(const OutputSubscription&) = delete;
+    OutputSubscription& operator=(const OutputSubscription&) = delete;
+};
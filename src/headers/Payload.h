@@ -23,6 +23,10 @@ struct Payload {
 	uint16_t distanceTraveled = 0;   	//DEFAULT current distance payload traveled in current Operator, used to index for operator connections
 	bool active = true;     	// Is the payload still traversing? (Set false when journey ends).
 
+	// Bytes of the serialized form: 1-byte size prefix + type u16 + operator ID u32
+	// + message (size-prefixed int, 1 + 4) + distance u16
+	static constexpr size_t SERIALIZED_SIZE = 1 + 2 + 4 + (1 + 4) + 2;
+
 	/**
  	* @brief Default constructor.
  	*/
@@ -138,55 +142,48 @@ struct Payload {
      * @brief Serializes the Payload state into a length-prefixed byte vector.
      * @param None
      * @return std::vector<std::byte> A vector containing the 1-byte size prefix + serialized data.
-     * @throws std::overflow_error If serialized data > 255 bytes or distanceTraveled > UINT16_MAX.
+     * @throws std::overflow_error If distanceTraveled > UINT16_MAX.
      * @details Serializes Type, OperatorID, Message, DistanceTraveled (as uint16_t).
-     * Calculates size N, writes N (1 byte), appends data. Uses Big Endian.
+     * Writes N (1 byte), then the data. Uses Big Endian. See appendBytes.
      */
     std::vector<std::byte> serializeToBytes() const {
-        // Purpose: Serialize Payload state (Type, OpID, Msg, Dist) with 1-byte size prefix.
-        // Parameters: None.
-        // Return: Length-prefixed byte vector. Throws on error.
-        // Key Logic: Serialize data to temp buffer, check size N<=255, write N, append data.
+        std::vector<std::byte> finalBuffer;
+        finalBuffer.reserve(SERIALIZED_SIZE);
+        appendBytes(finalBuffer);
+        return finalBuffer;
+    }
 
-        std::vector<std::byte> dataBuffer;
+    /**
+     * @brief Appends the length-prefixed serialization (see serializeToBytes) to `out`.
+     * @param out Buffer to append to. Reusing one buffer for many payloads avoids an allocation per payload.
+     * @throws std::overflow_error If distanceTraveled > UINT16_MAX (nothing is appended).
+     */
+    void appendBytes(std::vector<std::byte>& out) const {
+        // Purpose: Serialize Payload state (Type, OpID, Msg, Dist) with 1-byte size prefix.
+        // Parameters: @param out - destination buffer.
+        // Return: Void. Throws on error.
+        // Key Logic: The data size N is fixed (SERIALIZED_SIZE - 1), so the prefix is written first and
+        // the fields straight after it, without a temporary buffer.
 
-        // Serialize fields 2-7 into temporary buffer (Big Endian)
-        // Field 2: Payload Type
-        const uint16_t payloadTypeValue = 0x0000;
-        Serializer::write(dataBuffer, payloadTypeValue);
-        // Fields 3 & 4: Operator ID (Size + Value BE)
-        Serializer::write(dataBuffer, this->currentOperatorId);
-        // Fields 5 & 6: Message (Size + Value BE)
-        Serializer::write(dataBuffer, this->message);
-        // Field 7: DistanceTraveled (uint16_t BE)
         // ** WARNING: Potential data loss if distanceTraveled > UINT16_MAX **
         if (this->distanceTraveled < 0 || this->distanceTraveled > std::numeric_limits<uint16_t>::max()) {
              throw std::overflow_error("Payload distanceTraveled ("
                                       + std::to_string(this->distanceTraveled)
                                       + ") is out of range for uint16_t serialization format.");
         }
-        uint16_t dist16 = static_cast<uint16_t>(this->distanceTraveled);
-        Serializer::write(dataBuffer, dist16);
-
-        // Calculate size N and check bounds (max 255 for uint8_t prefix)
-        size_t dataSize = dataBuffer.size();
-        if (dataSize > std::numeric_limits<uint8_t>::max()) {
-            throw std::overflow_error("Serialized payload data size (" + std::to_string(dataSize)
-                                    + ") exceeds maximum representable by 1-byte length prefix (255).");
-        }
-        uint8_t totalDataSizeN = static_cast<uint8_t>(dataSize);
-
-        // Create final buffer
-        std::vector<std::byte> finalBuffer;
-        finalBuffer.reserve(1 + totalDataSizeN); // 1 byte for size + N bytes for data
 
         // Write 1-byte size prefix N
-        finalBuffer.push_back(static_cast<std::byte>(totalDataSizeN));
-
-        // Append the data bytes
-        finalBuffer.insert(finalBuffer.end(), dataBuffer.begin(), dataBuffer.end());
-
-        return finalBuffer;
+        out.push_back(static_cast<std::byte>(SERIALIZED_SIZE - 1));
+        // Field 2: Payload Type
+        const uint16_t payloadTypeValue = 0x0000;
+        Serializer::write(out, payloadTypeValue);
+        // Fields 3 & 4: Operator ID (Size + Value BE)
+        Serializer::write(out, this->currentOperatorId);
+        // Fields 5 & 6: Message (Size + Value BE)
+        Serializer::write(out, this->message);
+        // Field 7: DistanceTraveled (uint16_t BE)
+        uint16_t dist16 = static_cast<uint16_t>(this->distanceTraveled);
+        Serializer::write(out, dist16);
     }
 
 	/**
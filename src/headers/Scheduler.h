@@ -3,6 +3,9 @@
 #include <vector>
 #include <stdexcept> // For exceptions if get() fails
 #include <mutex> 	// For thread safety for static instance management
+#include <cstdint>
+#include <cstddef>
+#include <memory>
 
 // Forward Declarations
 class TimeController;
@@ -13,15 +16,21 @@ struct Payload; // From Payload.h
  * @brief Helper class providing a restricted interface for scheduling TimeController events.
  * @details Uses a static management pattern (CreateInstance, get) to allow access
  * without passing instances. Decouples Operators from TimeController internals.
+ * Each Simulator owns one instance. While a Simulator steps, a Scope makes its instance
+ * the calling thread's get() result, so several Simulators can run in one process.
  */
 class Scheduler {
 private:
 	// Static storage for instances
 	static std::vector<Scheduler*> instances;
 	static std::mutex instanceMutex; // Mutex to protect static instances vector
+	// Instance installed on this thread by a Scope, takes precedence over the default (first) instance
+	static inline thread_local Scheduler* threadInstance = nullptr;
 
 	// Associated TimeController instance (set in constructor)
 	TimeController* timeControllerInstance;
+	// Created by CreateInstance, so deleted by ResetInstances (owned instances never are)
+	bool ownedByRegistry = false;
 
 	/**
  	* @brief Private constructor. Use CreateInstance factory method.
@@ -48,8 +57,37 @@ public:
 	static Scheduler* CreateInstance(TimeController* controller);
 
 	/**
- 	* @brief Gets the default (first) Scheduler instance.
- 	* @return Scheduler* Pointer to the default Scheduler instance.
+ 	* @brief [Factory Method] Creates and registers a Scheduler instance owned by the caller.
+ 	* @param controller Pointer to the TimeController instance this Scheduler interacts with.
+ 	* @return std::unique_ptr<Scheduler> The instance, unregistered again when it is destroyed.
+ 	* @note Used by Simulator for its own instance. ResetInstances never deletes owned instances.
+ 	*/
+	static std::unique_ptr<Scheduler> CreateOwnedInstance(TimeController* controller);
+
+	/**
+ 	* @class Scheduler::Scope
+ 	* @brief Makes an instance the calling thread's get() result for the lifetime of the scope.
+ 	* @details Scopes nest, the previous instance is restored on destruction. A null instance
+ 	* leaves the thread on the default instance.
+ 	*/
+	class Scope {
+	private:
+		Scheduler* previous;
+	public:
+		explicit Scope(Scheduler* instance) : previous(threadInstance) { threadInstance = instance; }
+		~Scope() { threadInstance = previous; }
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+	};
+
+	/**
+ 	* @brief The instance installed on the calling thread by a Scope, or nullptr.
+ 	*/
+	static Scheduler* getThreadInstance() { return threadInstance; }
+
+	/**
+ 	* @brief Gets the calling thread's Scheduler instance (see Scope), or the default (first) one.
+ 	* @return Scheduler* Pointer to the thread's or the default Scheduler instance.
  	* @throws std::runtime_error if no Scheduler instance exists.
  	* @note Operators use this to access scheduling methods.
  	*/
@@ -65,6 +103,24 @@ public:
  	*/
 	void schedulePayloadForNextStep(const Payload& payload);
 
+	/**
+ 	* @brief Constructs a Payload in place to start its journey in the *next* time step.
+ 	* @param messageData The message carried by the new payload.
+ 	* @param sourceOperatorId The ID of the Operator starting the payload's journey (distance 0).
+ 	* @return Void.
+ 	* @note Preferred over schedulePayloadForNextStep on hot paths, avoids the temporary Payload.
+ 	* Internally calls TimeController::emplaceNextStepPayload.
+ 	*/
+	void emplacePayloadForNextStep(int messageData, uint32_t sourceOperatorId);
+
+	/**
+ 	* @brief Hints that the caller is about to schedule `count` payloads for the next step.
+ 	* @param count Number of payloads about to be scheduled.
+ 	* @return Void.
+ 	* @note Internally calls TimeController::reserveNextStepPayloads.
+ 	*/
+	void reservePayloadsForNextStep(size_t count);
+
 	/**
  	* @brief Schedules message delivery and operator flagging for the current step.
  	* @param targetOperatorId The ID of the operator receiving the message.
@@ -75,10 +131,17 @@ public:
  	*/
 	void scheduleMessage(int targetOperatorId, int messageData);
 
+	/**
+ 	* @brief Schedules delivery of a batch of messages to one operator for the current step.
+ 	* @note Used for bulk channel input. Internally calls TimeController::deliverBatchAndFlagOperator.
+ 	*/
+	void scheduleMessages(int targetOperatorId, const int* values, size_t count);
+
 
 	// --- Static Cleanup (Optional) ---
 	/**
- 	* @brief Clears all Scheduler instances. Useful for simulation reset/shutdown.
+ 	* @brief Deletes every instance created by CreateInstance. Useful for test reset/shutdown.
+ 	* @note Instances created by CreateOwnedInstance (each Simulator's) stay registered and alive.
  	*/
 	static void ResetInstances();
 
@@ -4,13 +4,25 @@
 #include "controllers/TimeController.h"
 #include "controllers/UpdateController.h"
 #include "../headers/util/Randomizer.h"
+#include "util/StepStats.h"
+#include "util/OperatorProfiler.h"
+#include "util/AsyncLogger.h"
+#include "util/NetworkGenerator.h"
+#include "util/TextInputStream.h"
+#include "util/ChannelInputQueue.h"
+#include "util/SeqLock.h"
+#include "util/OperatorIdSet.h"
+#include "util/WorkerPool.h"
 #include "Scheduler.h"
 #include "UpdateScheduler.h"
+#include "OutputSubscription.h"
 #include <string>
 #include <vector>
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <iostream>
 #include <memory> // For smart pointers if desired, though using raw pointers for now
 
@@ -26,14 +38,19 @@ struct SimulationStatus {
     size_t pendingUpdates;
     size_t totalOperators;
     size_t layerCount;
+    StepStatsSummary stepStats; // per-phase timings and counters over the recent steps
 
     void print(){
-        std::cout << "--- Step " << currentStep << " ---" << std::endl;
-        std::cout << "Current Payloads: " << currentPayloads << std::endl;
-        std::cout << "Next Step Payloads: " << nextPayloads << std::endl; // redundant as will only be greater than 0 when between steps 
-        std::cout << "Pending Updates: " << pendingUpdates << std::endl;
-        std::cout << "Operator Count: " << totalOperators << std::endl; // Added operator count log
-        std::cout << "Layer Count: " << layerCount << std::endl; 
+        print(std::cout);
+    }
+
+    void print(std::ostream& out){
+        out << "--- Step " << currentStep << " ---" << std::endl;
+        out << "Current Payloads: " << currentPayloads << std::endl;
+        out << "Next Step Payloads: " << nextPayloads << std::endl; // redundant as will only be greater than 0 when between steps 
+        out << "Pending Updates: " << pendingUpdates << std::endl;
+        out << "Operator Count: " << totalOperators << std::endl; // Added operator count log
+        out << "Layer Count: " << layerCount << std::endl; 
     }
 };
 
@@ -46,10 +63,22 @@ private:
 
     Randomizer* rand = nullptr;
 
-    // Store pointers to manage scheduler lifetime if needed,
-    // especially if ResetInstances isn't called globally at shutdown.
-    Scheduler* schedulerInstance = nullptr;
-    UpdateScheduler* updateSchedulerInstance = nullptr;
+    // This simulator's schedulers, created by init and destroyed with the simulator (ResetInstances skips them)
+    std::unique_ptr<Scheduler> schedulerInstance;
+    std::unique_ptr<UpdateScheduler> updateSchedulerInstance;
+
+    /**
+     * @brief Makes this simulator's schedulers what Scheduler::get() and UpdateScheduler::get() return
+     * on the calling thread while the scope lives.
+     * @details Taken by every method that lets operators run (steps, update application, text input),
+     * so simulators on different threads of one process never reach each other's controllers.
+     */
+    struct ContextScope {
+        Scheduler::Scope scheduler;
+        UpdateScheduler::Scope updates;
+        explicit ContextScope(const Simulator& simulator) :
+            scheduler(simulator.schedulerInstance.get()), updates(simulator.updateSchedulerInstance.get()) {}
+    };
 
     /**
      * @brief Default maximum steps for the run-until-stable method to prevent potential infinite loops.
@@ -77,6 +106,101 @@ private:
      */
     SimulationStatus getStatusNoLock() const;
 
+    /**
+     * @brief Executes one time step (traversal, operator checks, updates, advance) and records its statistics.
+     * @details Not thread-safe, called by the run loops while holding simMutex.
+     */
+    void executeStepNoLock();
+
+    /**
+     * @brief Queues the periodic run status (step, payload counts, pending updates) on the async logger.
+     * @details Not thread-safe, called by the run loops while holding simMutex.
+     */
+    void logStatusNoLock();
+
+    // Rolling per-phase statistics of the executed steps, guarded by simMutex
+    StepStats stepStats;
+
+    /**
+     * @brief Most often the step statistics summary is republished during a run (it sorts the window).
+     */
+    static constexpr std::chrono::milliseconds STEP_STATS_PUBLISH_INTERVAL{100};
+
+    // Lock-free copies of the status for getStatus, written with simMutex held, read without it
+    SeqLock<SimulationStatus> publishedStatus;    // every step boundary, step statistics left empty
+    SeqLock<StepStatsSummary> publishedStepStats; // every STEP_STATS_PUBLISH_INTERVAL of running and on reset
+    std::chrono::steady_clock::time_point lastStepStatsPublish{};
+
+    /**
+     * @brief Publishes the current status, and optionally the step statistics summary, for lock-free readers.
+     * @details Not thread-safe, called with simMutex held at step boundaries and when the state is replaced.
+     */
+    void publishStatusNoLock(bool includeStepStats);
+
+    /**
+     * @brief Hands the text stream's characters for this step to the InputLayer.
+     * @details Not thread-safe, called by executeStepNoLock before the traversal.
+     */
+    void feedTextStreamNoLock();
+
+    /**
+     * @brief Points every output subscription at the current network's channel operators.
+     * @details Not thread-safe, called with simMutex held whenever the network is replaced.
+     */
+    void bindSubscriptionsNoLock();
+
+    /**
+     * @brief Detaches every output subscription from its channel operator.
+     * @details Not thread-safe, called with simMutex held before the network is replaced. Subscribers poll
+     * without simMutex, so the operators must be unreachable before MetaController destroys them.
+     */
+    void unbindSubscriptionsNoLock();
+
+    /**
+     * @brief Signals the output subscriptions that have at least `threshold` values waiting (0 = their batch size).
+     * @details Not thread-safe, called by the run loops at step boundaries while holding simMutex.
+     */
+    void notifySubscriptionsNoLock(size_t threshold = 0);
+
+    /**
+     * @brief Delivers this step's share of the queued image and audio input to the InputLayer.
+     * @details Not thread-safe, called by executeStepNoLock before the traversal.
+     */
+    void feedChannelInputsNoLock();
+
+    // Drains up to `maxValues` of an output channel through `convert(const int*, size_t, T*)` into `out`
+    template<typename T, typename Convert>
+    size_t readChannelOutput(ChannelType channel, T* out, size_t maxValues, Convert convert);
+
+    // Pending image and audio input (see submitImageFrame), lock-free, producers never take simMutex
+    ChannelInputQueue imageInput;
+    ChannelInputQueue audioInput;
+
+    // Output subscriptions (see subscribeOutput), guarded by simMutex
+    std::vector<std::shared_ptr<OutputSubscription>> outputSubscriptions;
+
+    // Streaming text input (see openTextStream) and its per-step scratch buffer, guarded by simMutex
+    std::unique_ptr<TextInputStream> textStream;
+    std::string textStreamChars;
+
+    // Per-operator activity counters, attached to the TimeController while profiling, guarded by simMutex
+    OperatorProfiler operatorProfiler;
+    bool profilingEnabled = false;
+
+    // Pipelined update mode (see setPipelinedUpdates), guarded by simMutex
+    bool pipelinedUpdates = false;
+    size_t pipelineThreshold = DEFAULT_PIPELINE_THRESHOLD;
+    OperatorIdSet pipelineFootprint; // operators the coming step reads, reused between steps
+    std::unique_ptr<WorkerPool> pipelineWorker;       // one thread for the concurrent updates, started on first use
+    std::function<void(size_t)> concurrentUpdatesTask; // what pipelineWorker runs, outlives each dispatch
+
+    /**
+     * @brief Applies the staged updates of the previous step that the coming step reads.
+     * @return bool True if the remaining staged updates are worth applying concurrently with the step.
+     * @details Not thread-safe, called by executeStepNoLock before the input feeds.
+     */
+    bool applyStagedUpdatesNoLock();
+
     // --- Threading & Synchronization ---
     mutable std::mutex simMutex;
     std::atomic<bool> stopFlag{false};
@@ -134,17 +258,19 @@ public:
     /**
      * @brief Saves the current network state (payloads) to a file.
      * @param filePath The path where the state file will be saved. 
+     * @return bool False if there is no network or the file could not be written.
      * @details This method is thread-safe and can be called while the simulation is paused.
      */
-    virtual void saveState(const std::string& filePath) const;
+    virtual bool saveState(const std::string& filePath) const;
 
 
     /**
      * @brief Loads a network state from a file, replacing the current one.
      * @param filePath The path to the state file. 
+     * @return bool False if there is no network or the file could not be read.
      * @details This method is thread-safe.
      */
-    virtual void loadState(const std::string& filePath);
+    virtual bool loadState(const std::string& filePath);
 
     /**
      * @brief Creates a new, randomly initialized network, replacing the current one.
@@ -152,6 +278,17 @@ public:
      * @details This method is thread-safe.
      */
     virtual void createNewNetwork(int numOperators);
+
+    /**
+     * @brief Writes a seeded synthetic network (see NetworkGenerator) to a configuration file.
+     * @param spec Size, degree and distance distributions and seed of the network.
+     * @param filePath Destination file, load it with loadConfiguration.
+     * @param info Optional totals (operators, connections, bytes) of the written network.
+     * @return bool True if the file was written.
+     * @throws std::invalid_argument If the spec is invalid.
+     * @details Does not touch the loaded network, so it may run while a simulation is running.
+     */
+    virtual bool generateNetworkFile(const NetworkSpec& spec, const std::string& filePath, GeneratedNetworkInfo* info = nullptr);
     
     /**
      * @brief Runs the simulation until an inactive state is reached or default max steps exceeded.
@@ -185,9 +322,88 @@ public:
      * @brief Submits a line of text to the InputLayer of the network.
      * @param text The string of text to submit as input.
      * @details This method finds the InputLayer and calls its `inputText` method. This action is thread-safe. 
+     * All characters reach the text channel in the same step, so characters past
+     * InOperator::MAX_ACCUMULATED_DATA are dropped; a warning gives the count. Use openTextStream for larger inputs.
      */
     virtual void submitText(const std::string& text);
 
+    /**
+     * @brief Queues an update event for this simulator's network, applied after the next step.
+     * @param event The event, targeting an operator of this network.
+     * @details Thread-safe and lock-free. Unlike UpdateScheduler::get()->Submit, which reaches the
+     * thread's current simulator (or the first one created), this always targets this simulator.
+     */
+    virtual void submitUpdate(const UpdateEvent& event);
+
+    /**
+     * @brief Streams text from a file or named pipe into the InputLayer, a bounded number of characters per step.
+     * @param filePath Source of the text.
+     * @param options Characters per step, ring buffer size and the in-flight payload limit (see TextInputStream).
+     * @return bool True if the stream was opened, it replaces any previous stream.
+     * @details Thread-safe. The stream is fed at the start of every step of run(); a run does not end
+     * as inactive while the stream still has text.
+     */
+    virtual bool openTextStream(const std::string& filePath, const TextStreamOptions& options = TextStreamOptions());
+
+    /**
+     * @brief Stops streaming text, discarding what was read but not fed.
+     * @details This method is thread-safe.
+     */
+    virtual void closeTextStream();
+
+    /**
+     * @brief Gets the counters of the open text stream.
+     * @param stats Filled if a stream is open.
+     * @return bool False if no stream is open.
+     * @details This method is thread-safe.
+     */
+    virtual bool getTextStreamStats(TextStreamStats& stats) const;
+
+    /**
+     * @brief Queues an image frame for the image channel, 8-bit samples (pixels, any channel layout).
+     * @param pixels The samples, in order.
+     * @param count Number of samples.
+     * @return size_t Number of samples accepted; less than `count` when the queue is full, submit the rest later.
+     * @details Thread-safe and never waits for a running step. The samples are converted on the caller's
+     * thread and delivered to the channel operator at the start of the following steps, at most the
+     * channel's input rate per step (see setChannelInputRate).
+     */
+    virtual size_t submitImageFrame(const uint8_t* pixels, size_t count);
+
+    /**
+     * @brief Queues signed 16-bit audio samples for the audio channel (see submitImageFrame).
+     * @return size_t Number of samples accepted.
+     */
+    virtual size_t submitAudioSamples(const int16_t* samples, size_t count);
+
+    /**
+     * @brief Sets how many queued samples the image or audio channel receives per step.
+     * @return bool False for the text channel, which is rated by its text stream.
+     * @details Thread-safe. The channel's InOperator keeps at most MAX_ACCUMULATED_DATA values per step,
+     * so a higher rate is capped at that limit and the rest stays queued for later steps.
+     */
+    virtual bool setChannelInputRate(ChannelType channel, size_t samplesPerStep);
+
+    /**
+     * @brief Number of samples queued on the image or audio channel and not yet delivered (0 for text).
+     * @details Thread-safe.
+     */
+    virtual size_t getPendingChannelInput(ChannelType channel) const;
+
+    /**
+     * @brief Drains the image output channel into `pixels`, one 8-bit sample per output value.
+     * @return size_t Number of samples written, at most `maxPixels`.
+     * @details Thread-safe. Inverse of the input conversion (see SampleCodec).
+     */
+    virtual size_t readImageOutput(uint8_t* pixels, size_t maxPixels);
+
+    /**
+     * @brief Drains the audio output channel into `samples`, one 16-bit sample per output value.
+     * @return size_t Number of samples written, at most `maxSamples`.
+     * @details Thread-safe.
+     */
+    virtual size_t readAudioOutput(int16_t* samples, size_t maxSamples);
+
     /**
      * @brief Checks if the simulator has finished running, and prints why
      * @details Used to verify the end of the simulation using timeController and UpdateController details
@@ -205,6 +421,31 @@ public:
 
     virtual int getTextCount();
 
+    /**
+     * @brief Drains up to `maxChars` of the text output channel into `out`, without building a string.
+     * @return size_t Number of characters written (not NUL-terminated).
+     * @details Thread-safe. Same characters as getOutput, converted by a vectorized kernel and not
+     * limited by the text batch size, for draining large outputs.
+     */
+    virtual size_t readTextOutput(char* out, size_t maxChars);
+
+    /**
+     * @brief Subscribes to an output channel, to read its output without the simulation lock.
+     * @param channel Output channel to read.
+     * @param batchSize Values waiting before the subscriber is signalled, also the most per callback.
+     * @return std::shared_ptr<OutputSubscription> The subscriber's handle, read it with poll/waitAndPoll
+     * or watch its notification descriptor.
+     * @details Thread-safe. Reading through the handle never takes simMutex, so a consumer polling
+     * constantly does not stall the run loop. The subscription follows network replacements.
+     */
+    virtual std::shared_ptr<OutputSubscription> subscribeOutput(ChannelType channel = ChannelType::TEXT, size_t batchSize = 512);
+
+    /**
+     * @brief Stops signalling a subscription and detaches it from the network (further polls return nothing).
+     * @details This method is thread-safe.
+     */
+    virtual void unsubscribeOutput(const std::shared_ptr<OutputSubscription>& subscription);
+
     virtual void clearTextOutput();
 
     virtual void setTextBatchSize(int size);
@@ -212,10 +453,96 @@ public:
     /**
      * @brief Gets a snapshot of the current status of the simulation.
      * @return A SimulationStatus struct containing key metrics.
-     * @details This method is thread-safe.
+     * @details Thread-safe and never waits for a running step: during a run it returns the counters
+     * published at the last step boundary, with step statistics up to STEP_STATS_PUBLISH_INTERVAL old.
      */
     virtual SimulationStatus getStatus() const;
 
+    /**
+     * @brief Discards the recorded step statistics (e.g. after changing the network or input).
+     * @details This method is thread-safe.
+     */
+    virtual void resetStepStats();
+
+    /**
+     * @brief Starts recording a trace of the simulation phases (step, traversal, updates, advance, load/save).
+     * @details Process-wide and thread-safe. Requires the library to be built with ATHENA_ENABLE_TRACING.
+     */
+    virtual void startTrace();
+
+    /**
+     * @brief Stops recording and writes the trace as Chrome trace-event JSON.
+     * @param filePath Destination file, opens in chrome://tracing or ui.perfetto.dev.
+     * @return bool True if the file was written.
+     */
+    virtual bool stopTrace(const std::string& filePath);
+
+    /**
+     * @brief Sets the minimum level of the run-loop log records (status lines, run start/finish).
+     * @param level Records below this level are discarded before they are queued, OFF silences the run loop.
+     * @details Process-wide (AsyncLogger::get()) and thread-safe.
+     */
+    virtual void setLogLevel(AsyncLogger::Level level);
+
+    /**
+     * @brief Enables or disables per-operator profiling (deliveries, fires, emitted payloads, traversal steps).
+     * @param enabled True to start counting, false to stop. Counters are kept until resetProfile.
+     * @details This method is thread-safe.
+     */
+    virtual void setProfiling(bool enabled);
+
+    /**
+     * @brief Minimum number of staged updates applied on a second thread in pipelined mode, below it they are applied in line.
+     */
+    static constexpr size_t DEFAULT_PIPELINE_THRESHOLD = 1024;
+
+    /**
+     * @brief Enables or disables pipelined update processing (off by default).
+     * @param enabled True to overlap each step's updates with the next step.
+     * @param minConcurrentUpdates Staged updates needed before they are applied on a second thread.
+     * @details In pipelined mode the updates queued during step N are staged instead of applied and
+     * are applied at the start of step N+1, before anything reads their target operators:
+     * - Updates to the operators step N+1 reads (payload sources, flagged operators, input channels,
+     *   and the targets the payloads deliver to) are applied first, on the simulation thread.
+     * - The remaining updates touch no operator of the step. If there are at least
+     *   `minConcurrentUpdates` of them they are applied on a second thread while the step runs,
+     *   otherwise in line. The step waits for them before it returns.
+     * - A staged CREATE/DELETE event makes the whole batch apply in line first.
+     * Each update only changes its target operator, so a run ends with the same network, payloads
+     * and output as in serial mode. Between two steps of a running simulation the network may not
+     * show the last step's updates yet, the end of a run applies them. Disabling applies anything staged.
+     * This method is thread-safe.
+     */
+    virtual void setPipelinedUpdates(bool enabled, size_t minConcurrentUpdates = DEFAULT_PIPELINE_THRESHOLD);
+
+    /**
+     * @brief Checks whether pipelined update processing is enabled.
+     */
+    virtual bool isPipelinedUpdates() const;
+
+    /**
+     * @brief Sets how many worker threads apply updates besides the simulation thread.
+     * @param count Worker threads, 0 applies every update on the simulation thread. Defaults to hardware threads - 1.
+     * @details See UpdateController::SetWorkerThreads, the result does not depend on the count.
+     * Processes running many simulations side by side usually want 0. This method is thread-safe.
+     */
+    virtual void setUpdateThreads(size_t count);
+
+    /**
+     * @brief Discards the per-operator profiling counters.
+     * @details This method is thread-safe.
+     */
+    virtual void resetProfile();
+
+    /**
+     * @brief Builds the profiling report: top-K operators and the in/out-degree and distance histograms.
+     * @param topK Number of operators listed.
+     * @param metric Counter the operators are ranked by.
+     * @return std::string The formatted report.
+     * @details This method is thread-safe.
+     */
+    virtual std::string getProfileReport(size_t topK, OperatorProfiler::Metric metric = OperatorProfiler::Metric::DELIVERIES) const;
+
     /**
      * @brief Gets a JSON representation of the entire network structure.
      * @param prettyPrint If true, format the JSON with indentation for readability. 
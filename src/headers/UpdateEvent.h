@@ -5,6 +5,8 @@
 #include <utility> // For std::move
 #include <iosfwd>  // Potentially for exceptions if they use streams
 #include <vector>
+#include <initializer_list>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 #include <string> // Optional: Include if adding string-based parameters or event IDs later
@@ -31,6 +33,86 @@ enum class UpdateType : uint16_t{
 	// CUSTOM_EVENT,   	// Example: params define custom event data
 };
 
+/**
+ * @struct UpdateParams
+ * @brief Fixed-capacity, inline parameter list for an UpdateEvent.
+ * @details Every UpdateType takes at most three integer parameters (MOVE_CONNECTION being the largest),
+ * so the values are stored inline instead of in a heap-allocated std::vector. This keeps UpdateEvent
+ * trivially copyable and lets events be queued and drained without allocation. Mirrors the subset of the
+ * std::vector<int> interface used by the handlers (size, empty, operator[], iteration), and converts
+ * implicitly from brace lists and std::vector<int> so existing call sites keep working.
+ */
+struct UpdateParams {
+	static constexpr size_t MAX_PARAMS = 3; // largest parameter count of any UpdateType
+
+	int values[MAX_PARAMS] = {0, 0, 0};
+	uint8_t count = 0;
+
+	UpdateParams() = default;
+
+	/**
+	 * @brief Construct from a brace list, e.g. `{targetId, distance}`.
+	 * @note Values past MAX_PARAMS are ignored, no UpdateType reads beyond the third parameter.
+	 */
+	UpdateParams(std::initializer_list<int> init) {
+		assign(init.begin(), init.end());
+	}
+
+	/**
+	 * @brief Construct from a vector, copying the values inline.
+	 * @note Values past MAX_PARAMS are ignored, no UpdateType reads beyond the third parameter.
+	 */
+	UpdateParams(const std::vector<int>& init) {
+		assign(init.data(), init.data() + init.size());
+	}
+
+	/**
+	 * @brief Appends a value.
+	 * @throws std::length_error if MAX_PARAMS values are already stored.
+	 */
+
+	void push_back(int value) {
+		if (count >= MAX_PARAMS) {
+			throw std::length_error("UpdateParams supports at most " + std::to_string(MAX_PARAMS) + " parameters.");
+		}
+		values[count++] = value;
+	}
+
+	void clear() { count = 0; }
+
+	/**
+	 * @brief Replaces the contents with up to MAX_PARAMS values from [first, last).
+	 */
+	void assign(const int* first, const int* last) {
+		count = 0;
+		for (; first != last && count < MAX_PARAMS; ++first) {
+			values[count++] = *first;
+		}
+	}
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+
+	int& operator[](size_t index) { return values[index]; }
+	const int& operator[](size_t index) const { return values[index]; }
+
+	const int* begin() const { return values; }
+	const int* end() const { return values + count; }
+
+	/**
+	 * @brief Copies the parameters into a std::vector, for callers that still need one.
+	 */
+	std::vector<int> toVector() const { return std::vector<int>(begin(), end()); }
+
+	bool operator==(const UpdateParams& other) const {
+		if (count != other.count) return false;
+		for (uint8_t i = 0; i < count; ++i) {
+			if (values[i] != other.values[i]) return false;
+		}
+		return true;
+	}
+	bool operator!=(const UpdateParams& other) const { return !(*this == other); }
+};
+
 /**
  * @struct UpdateEvent
  * @brief Represents a request/event for a state or structural change processed during the Update Loop.
@@ -46,7 +128,7 @@ struct UpdateEvent {
 	// TODO currently updateEvent params must all be ints, therefore given IDS current type is uint32_t, must cast to int, potentially losing information and storing wrong ID
 	// TODO params need to support different types, other than just "int"
 	// Parameters for the update. Parsing requires convention based on UpdateType (see enum comments).
-	std::vector<int> params;	// Parameters encoded as integers. Parsing logic in UpdateController is crucial.
+	UpdateParams params;	// Parameters encoded as integers, stored inline (max 3). Parsing logic in UpdateController is crucial.
 
 	/**
  	* @brief Default constructor.
@@ -57,12 +139,12 @@ struct UpdateEvent {
  	* @brief Constructor to initialize main fields.
  	* @param type The type of update.
  	* @param targetId The ID of the target Operator.
- 	* @param parameters A vector of integer parameters specific to the update type.
+ 	* @param parameters Integer parameters specific to the update type (at most UpdateParams::MAX_PARAMS).
  	*/
-	UpdateEvent(UpdateType type, uint32_t targetId, std::vector<int> parameters = {}) :
+	UpdateEvent(UpdateType type, uint32_t targetId, const UpdateParams& parameters = {}) :
     	type(type),
     	targetOperatorId(targetId),
-    	params(std::move(parameters))
+    	params(parameters)
 	{}
 
 	/**
@@ -88,9 +170,13 @@ struct UpdateEvent {
 									+ std::to_string(paramTypeCode));
 		}
 
+		if (paramCount > UpdateParams::MAX_PARAMS) {
+			throw std::runtime_error("UpdateEvent parameter count " + std::to_string(paramCount)
+									+ " exceeds the maximum of " + std::to_string(UpdateParams::MAX_PARAMS) + ".");
+		}
+
 		// Field 7: Read Sequence of Parameter Values (using Serializer::read_int)
 		this->params.clear();
-		this->params.reserve(paramCount);
 		for (uint8_t i = 0; i < paramCount; ++i) {
 			// Call the Serializer method which reads size prefix + value bytes BE
 			int paramValue = Serializer::read_int(current, end);
@@ -107,8 +193,8 @@ struct UpdateEvent {
 		// Field 2: Update Type (uint8_t)
 		Serializer::write(dataBuffer, static_cast<uint8_t>(this->type));
 
-		// Fields 3 & 4: Target Operator ID (Size + Value BE)
-		Serializer::write(dataBuffer, this->targetOperatorId);
+		// Fields 3 & 4: Target Operator ID (Size + Value BE), the int form read back by read_int
+		Serializer::write(dataBuffer, static_cast<int>(this->targetOperatorId));
 
 		// Field 5: Number of Parameters (uint8_t)
 		if (this->params.size() > std::numeric_limits<uint8_t>::max()) {
@@ -150,6 +236,6 @@ struct UpdateEvent {
 		return finalBuffer;
 	}
 
-	// Note: Using vector<int> is flexible but less type-safe. Requires careful handling.
+	// Note: Using plain int parameters is flexible but less type-safe. Requires careful handling.
 	// Future enhancements could involve std::variant or specific structs per type.
 };
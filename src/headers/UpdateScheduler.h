@@ -3,6 +3,8 @@
 #include <vector>
 #include <stdexcept> // For exceptions if get() fails
 #include <mutex> 	// For thread safety for static instance management
+#include <atomic>
+#include <memory>
 
 // Forward Declarations
 class UpdateController;
@@ -13,15 +15,23 @@ struct UpdateEvent; // From UpdateEvent.h
  * @brief Helper class providing the sole public interface for submitting UpdateEvents.
  * @details Uses a static management pattern (CreateInstance, get) to allow access
  * without passing instances. Decouples event requestors from UpdateController internals.
+ * Like Scheduler, each Simulator owns one instance and installs it with a Scope while it steps.
  */
 class UpdateScheduler {
 private:
 	// Static storage for instances
 	static std::vector<UpdateScheduler*> instances;
 	static std::mutex instanceMutex; // Mutex to protect static instances vector
+	// Cached front of `instances`, lets get() run without taking instanceMutex on the submit path.
+	// Written only while instanceMutex is held.
+	static std::atomic<UpdateScheduler*> defaultInstance;
+	// Instance installed on this thread by a Scope, takes precedence over defaultInstance
+	static inline thread_local UpdateScheduler* threadInstance = nullptr;
 
 	// Associated UpdateController instance (set in constructor)
 	UpdateController* updateControllerInstance;
+	// Created by CreateInstance, so deleted by ResetInstances (owned instances never are)
+	bool ownedByRegistry = false;
 
 	/**
  	* @brief Private constructor. Use CreateInstance factory method.
@@ -48,8 +58,36 @@ public:
 	static UpdateScheduler* CreateInstance(UpdateController* controller);
 
 	/**
- 	* @brief Gets the default (first) UpdateScheduler instance.
- 	* @return UpdateScheduler* Pointer to the default UpdateScheduler instance.
+ 	* @brief [Factory Method] Creates and registers an UpdateScheduler instance owned by the caller.
+ 	* @param controller Pointer to the UpdateController instance this UpdateScheduler interacts with.
+ 	* @return std::unique_ptr<UpdateScheduler> The instance, unregistered again when it is destroyed.
+ 	* @note Used by Simulator for its own instance. ResetInstances never deletes owned instances.
+ 	*/
+	static std::unique_ptr<UpdateScheduler> CreateOwnedInstance(UpdateController* controller);
+
+	/**
+ 	* @class UpdateScheduler::Scope
+ 	* @brief Makes an instance the calling thread's get() result for the lifetime of the scope.
+ 	* @details Scopes nest, the previous instance is restored on destruction.
+ 	*/
+	class Scope {
+	private:
+		UpdateScheduler* previous;
+	public:
+		explicit Scope(UpdateScheduler* instance) : previous(threadInstance) { threadInstance = instance; }
+		~Scope() { threadInstance = previous; }
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+	};
+
+	/**
+ 	* @brief The instance installed on the calling thread by a Scope, or nullptr.
+ 	*/
+	static UpdateScheduler* getThreadInstance() { return threadInstance; }
+
+	/**
+ 	* @brief Gets the calling thread's UpdateScheduler instance (see Scope), or the default (first) one.
+ 	* @return UpdateScheduler* Pointer to the thread's or the default UpdateScheduler instance.
  	* @throws std::runtime_error if no UpdateScheduler instance exists.
  	* @note Operators/components use this to submit update events.
  	*/
@@ -66,10 +104,19 @@ public:
  	*/
 	void Submit(const UpdateEvent& event);
 
+	/**
+ 	* @brief Publishes the calling thread's buffered update events.
+ 	* @return Void.
+ 	* @note Worker threads that Submit during a parallel phase call this before the update barrier.
+ 	* Internally calls UpdateController::FlushThreadBatch().
+ 	*/
+	void Flush();
+
 
 	// --- Static Cleanup (Optional) ---
 	/**
- 	* @brief Clears all UpdateScheduler instances. Useful for simulation reset/shutdown.
+ 	* @brief Deletes every instance created by CreateInstance. Useful for test reset/shutdown.
+ 	* @note Instances created by CreateOwnedInstance (each Simulator's) stay registered and alive.
  	*/
 	static void ResetInstances();
 
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "../util/TextInputStream.h" // TextStreamOptions stored by value in BatchJob
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @struct BatchJob
+ * @brief One non-interactive simulation run: what to load, what to feed, how long to run, where output goes.
+ * @details Every field has a matching option (see BatchRunner::setOption), e.g. `config` for configPath.
+ */
+struct BatchJob {
+    std::string configPath;         // network to load, required unless generateOperators is set
+    int generateOperators = 0;      // random network of this many internal operators when no config is given
+    uint64_t seed = 1;              // seed of the generated network
+    std::string statePath;          // payload state loaded after the network (optional)
+    std::string inputPath;          // file or named pipe streamed to the text channel (optional)
+    std::string inputText;          // text submitted before the run (optional)
+    TextStreamOptions streamOptions;
+    int steps = 0;                  // steps to run, required
+    std::string outputPath;         // text output sink, "-" = stdout, empty = discarded
+    std::string saveConfigPath;     // network saved after the run (optional)
+    std::string saveStatePath;      // payload state saved after the run (optional)
+    size_t updateThreads = 0;       // update workers besides the simulation thread, batch jobs usually run side by side
+    bool pipelinedUpdates = false;
+    int pinCpu = -1;                // CPU of the simulation thread, workers take the following ones, -1 = no pinning
+    bool verbose = false;           // keep the simulator's console output and run log
+};
+
+/**
+ * @class BatchRunner
+ * @brief Runs scripted simulation jobs without the interactive CLI (the AthenaBatch executable).
+ * @details Jobs are described by options, on the command line as `--name value` or in a script
+ * file as one `name value` line each (the value is the rest of the line, `#` starts a comment).
+ * Options accumulate into the current job; a `run` line in a script queues a copy of it, so later
+ * lines only need to name what changes. If nothing was queued, the options describe one job.
+ * `--script <path>` reads a script at that point of the command line.
+ *
+ * A job builds a fresh Simulator, loads or generates the network, loads the state, feeds the
+ * input, runs the steps while a background reader drains the text output into the sink (an
+ * OutputSubscription, so the run never waits on the sink), then saves what was asked for.
+ * Unless the job is verbose the simulator's console output is discarded and the run log is off;
+ * failures are reported on the error stream.
+ */
+class BatchRunner {
+private:
+    std::vector<BatchJob> jobs;
+    BatchJob current;
+    std::ostream& errors;
+
+    // Reads a script into `current`/`jobs`, `name` is used in error messages
+    bool loadScript(std::istream& in, const std::string& name);
+
+public:
+    /**
+     * @brief Creates a runner with no jobs.
+     * @param errorStream Receives parse and job errors.
+     */
+    explicit BatchRunner(std::ostream& errorStream);
+
+    /**
+     * @brief Parses the command line (without the program name).
+     * @return bool False on an unknown option, a missing value or an unreadable script.
+     */
+    bool parseArguments(const std::vector<std::string>& args);
+
+    /**
+     * @brief Parses a script from a stream.
+     * @return bool False on the first invalid line, reported with its line number.
+     */
+    bool parseScript(std::istream& in);
+
+    /**
+     * @brief Sets one option of the current job, or queues it (`run`).
+     * @param name Option name without dashes (config, generate, seed, state, input, text, chars-per-step,
+     * max-in-flight, steps, output, save-config, save-state, update-threads, pipeline, pin-cpu, verbose, run).
+     * @param value Option value, empty for `run`.
+     * @return bool False if the name is unknown or the value invalid (reported on the error stream).
+     */
+    bool setOption(const std::string& name, const std::string& value);
+
+    /**
+     * @brief The queued jobs, plus the current one if nothing was queued.
+     */
+    std::vector<BatchJob> getJobs() const;
+
+    /**
+     * @brief Runs every job in order.
+     * @return int Process exit code: 0 if every job succeeded, 1 otherwise (later jobs still run).
+     */
+    int runAll();
+
+    /**
+     * @brief Runs one job.
+     * @param job The job, must have a network source and a positive step count.
+     * @param errorStream Receives the reason of a failure.
+     * @return bool True if every requested load, run and save succeeded.
+     */
+    static bool runJob(const BatchJob& job, std::ostream& errorStream);
+
+    /**
+     * @brief Prints the command line and script syntax.
+     */
+    static void printUsage(std::ostream& out);
+
+    // Prevent copying/assignment
+    BatchRunner(const BatchRunner&) = delete;
+    BatchRunner& operator=(const BatchRunner&) = delete;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iosfwd>
 #include <string>
 #include <memory>
 #include <atomic>
@@ -46,7 +47,25 @@ public:
      */
     void stop();
 
+    /**
+     * @brief Executes one command line and writes its response to `out`.
+     * @param line The command line, as typed at the prompt.
+     * @param out Receives everything the command prints (std::cout for the interactive loop).
+     * @details Used by the interactive loop and by ControlServer, so both expose the same commands.
+     * `quit`/`exit` stop this CLI's loop and request the simulation to stop.
+     */
+    void execute(const std::string& line, std::ostream& out);
+
+    /**
+     * @brief Stops the simulation runs started by the `run` command and blocks until they have returned.
+     * @details The runs execute on detached threads, so call this before the process exits, or static
+     * state such as the logger may be torn down under a running step. The stop request is repeated while
+     * waiting, since a run that had not started yet would clear it.
+     */
+    void stopBackgroundRuns();
+
 private:
+    struct BackgroundRuns; // count of the `run` threads still executing, shared with them
     /**
      * @brief Parses a single line of input from the user and executes the corresponding command.
      * @param line The raw string of input from the user.
@@ -54,5 +73,6 @@ private:
     void processCommand(const std::string& line);
 
     std::shared_ptr<Simulator> sim;
+    std::shared_ptr<BackgroundRuns> backgroundRuns; // outlives the CLI while a run thread holds it
     std::atomic<bool> isRunning{false};
 };
\ No newline at end of file
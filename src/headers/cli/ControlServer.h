@@ -0,0 +1,131 @@
+#pragma once
+
+#include "CLI.h"
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+class Simulator;
+class OutputSubscription;
+
+/**
+ * @class ControlServer
+ * @brief Unix domain socket command server, the CLI for simulator processes without a terminal.
+ * @details Clients connect to the socket and send the CLI's commands, one per line (`status`,
+ * `submit-text hello`, `get-output`, `save-state <path>`, `stop`, `help`, ...). Each command runs
+ * through CLI::execute, so the verbs and messages are the same as at the prompt, and its response
+ * is followed by a line holding only `.` (END_OF_RESPONSE). Server specific commands:
+ * - `quit` / `exit` close the connection, the simulation keeps running.
+ * - `shutdown` requests the simulation to stop and ends the server.
+ * - `stream-output [batch-size]` turns the connection into an output stream: after the response,
+ *   the text channel's output is written to it as raw characters while the simulation runs, until
+ *   the client disconnects. Further input on that connection is ignored.
+ *
+ * The server is a single epoll loop on its own thread (`start`) or the caller's (`run`). Sockets
+ * are non-blocking and every connection buffers its pending response, so a slow client never holds
+ * up another one. Streams read the output through an OutputSubscription whose notification
+ * descriptor sits in the same epoll set, so they never take the simulation lock or wait on a step.
+ * A stream whose client falls behind by MAX_PENDING_OUTPUT bytes stops draining until the client
+ * catches up; the values wait in the output channel meanwhile.
+ *
+ * Commands execute on the loop thread: status queries read the published snapshot, `run` starts the
+ * simulation on a background thread as it does at the prompt. Limitation: commands that take the
+ * simulation lock like their CLI counterparts (`get-output`, `save-state`, `load-config`, ...) wait
+ * for the step in progress, and while they wait the loop serves no other client, so a slow step
+ * stalls every connection. Clients that read output during a run should use `stream-output`, which
+ * never takes the lock. A command line longer than MAX_LINE_LENGTH ends the connection.
+ * The socket file is created with owner-only permissions and removed when the server stops.
+ */
+class ControlServer {
+public:
+    static constexpr const char* END_OF_RESPONSE = ".";
+    static constexpr size_t MAX_LINE_LENGTH = 64 * 1024;         // a longer command closes the connection
+    static constexpr size_t MAX_PENDING_OUTPUT = 4 * 1024 * 1024; // per stream, see class details
+
+    /**
+     * @brief Creates a server for the given simulator, nothing is opened yet.
+     * @param simulator The simulator the commands act on.
+     * @param socketPath Filesystem path of the Unix domain socket.
+     */
+    ControlServer(std::shared_ptr<Simulator> simulator, std::string socketPath);
+
+    /**
+     * @brief Stops the server, closes every connection and removes the socket file.
+     */
+    ~ControlServer();
+
+    /**
+     * @brief Opens the socket and runs the event loop on a background thread.
+     * @return bool False if the socket could not be opened (reported on std::cerr) or the server already runs.
+     */
+    bool start();
+
+    /**
+     * @brief Opens the socket and runs the event loop on the calling thread until `shutdown` or stop().
+     * @return bool False if the socket could not be opened.
+     */
+    bool run();
+
+    /**
+     * @brief Ends the event loop. Thread-safe, returns without waiting for a loop running in run().
+     */
+    void stop();
+
+    /**
+     * @brief Stops the simulation runs started by clients (`run`) and waits for them, see CLI::stopBackgroundRuns.
+     */
+    void stopBackgroundRuns() { cli.stopBackgroundRuns(); }
+
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+
+    const std::string& getSocketPath() const { return socketPath; }
+
+    // Connected clients, streams included (a snapshot)
+    size_t getClientCount() const { return clientCount.load(std::memory_order_relaxed); }
+
+    // Prevent copying/assignment
+    ControlServer(const ControlServer&) = delete;
+    ControlServer& operator=(const ControlServer&) = delete;
+
+private:
+    struct Connection {
+        int fd = -1;
+        std::string input;                          // received bytes not yet forming a whole line
+        std::string output;                         // response bytes not yet accepted by the socket
+        size_t outputSent = 0;                      // prefix of output already written
+        std::shared_ptr<OutputSubscription> stream; // set by stream-output
+        bool streamPaused = false;                  // stream stopped draining until output is flushed
+        bool closeWhenFlushed = false;              // quit: close once the response is out
+    };
+
+    std::shared_ptr<Simulator> sim;
+    CLI cli;
+    std::string socketPath;
+
+    int listenFd = -1;
+    int epollFd = -1;
+    int wakeFd = -1;
+    std::atomic<bool> running{false};
+    std::atomic<bool> stopRequested{false};
+    std::atomic<size_t> clientCount{0};
+    std::thread loopThread;
+
+    std::map<int, std::unique_ptr<Connection>> connections; // by client socket
+    std::unordered_map<int, Connection*> streamsByFd;       // by subscription notification descriptor
+
+    bool openSocket();
+    void closeSocket();
+    void eventLoop();
+
+    void acceptClients();
+    void readClient(Connection& connection);
+    void handleLine(Connection& connection, const std::string& line);
+    void drainStream(Connection& connection);
+    // Writes what the socket takes and updates the epoll interest, false if the connection was closed
+    bool flush(Connection& connection);
+    void closeConnection(int fd);
+};
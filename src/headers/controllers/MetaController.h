@@ -3,14 +3,19 @@
 #include <string>
 #include <vector>
 #include <memory> // For std::unique_ptr
+#include "../layers/ChannelType.h"
 
 // Forward Declarations
 class Operator;
 class Layer;      // The abstract base class for layers
 class OutputLayer; 
+class OutOperator;
 class Payload;
 class Randomizer; 
 struct UpdateEvent;
+struct UpdateParams;
+class ConnectionIndex;
+class OperatorIdSet;
 struct IdRange;
 
 /**
@@ -34,6 +39,13 @@ protected:
      */
     std::vector<std::unique_ptr<Layer>> layers;
 
+    /**
+     * @brief Optional reverse connection index (target -> incoming edges), nullptr when disabled.
+     * @details When present every layer and operator is attached to it, which lets
+     * handleDeleteOperator remove the connections pointing at a deleted operator right away.
+     */
+    std::unique_ptr<ConnectionIndex> connectionIndex;
+
     /**
      * @brief Retrieves a pointer to an Operator object by its unique ID.
      * @details This method now delegates the search to the contained layers. It iterates through
@@ -54,6 +66,18 @@ protected:
      */
     void clearAllLayers();
 
+    /**
+     * @brief Rebuilds the connection index (if enabled) from the current layers.
+     * @details Called whenever the layers are replaced (randomizeNetwork, loadConfiguration).
+     */
+    void attachConnectionIndex();
+
+    /**
+     * @brief Removes every connection that points at the given operator, using the connection index.
+     * @param operatorId The (deleted) target operator.
+     */
+    void purgeIncomingConnections(uint32_t operatorId);
+
     /**
      * @brief Returns last layer (and therefore the dynamic layer) in the sorted list of layers. 
      * @return A raw pointer to the dynamic layer (`isRangeFinal == false`), or nullptr if no dynamic layer is found.
@@ -160,10 +184,30 @@ public:
      */
     virtual bool messageOp(uint32_t operatorId, int message);
 
+    /**
+     * @brief Delivers a batch of messages to one operator (see Operator::messageBatch).
+     * @return bool False if the operator does not exist.
+     */
+    virtual bool messageOpBatch(uint32_t operatorId, const int* values, size_t count);
+
     virtual void processOpData(uint32_t operatorId);
 
     virtual void traversePayload(Payload* payload);
 
+    /**
+     * @brief Adds the operators a payload delivers to when it next traverses (its source's targets at the payload's distance).
+     * @param payload The traveling payload.
+     * @param targets Receives the target IDs.
+     * @details Used by the pipelined update mode to find the operators a step touches.
+     */
+    void collectPayloadTargets(const Payload& payload, OperatorIdSet& targets) const;
+
+    /**
+     * @brief Adds the IDs of the input channel operators, which streamed and queued input is delivered to.
+     * @param ids Receives the channel operator IDs.
+     */
+    void collectInputChannelIds(OperatorIdSet& ids) const;
+
 
 
 
@@ -173,9 +217,9 @@ public:
      * @brief Handles a CREATE_OPERATOR UpdateEvent.
      * @details Gets the single dynamic layer and delegates the operator creation request to it.
      * The dynamic layer is responsible for generating and assigning the new operator's ID.
-     * @param params A vector of integers containing parameters for the new operator, such as its type.
+     * @param params Integer parameters (inline UpdateParams) containing parameters for the new operator, such as its type.
      */
-    void handleCreateOperator(const std::vector<int>& params);
+    void handleCreateOperator(const UpdateParams& params);
 
     /**
      * @brief Handles a DELETE_OPERATOR UpdateEvent.
@@ -185,33 +229,63 @@ public:
      */
     void handleDeleteOperator(uint32_t targetOperatorId);
 
+    /**
+     * @brief Enables or disables the reverse connection index.
+     * @param enabled True builds the index from the current network and keeps it in sync, false drops it.
+     * @details With the index enabled, deleting an operator also removes the connections pointing at
+     * it in O(in-degree), instead of leaving dead targets that are only noticed at delivery time.
+     * It costs one index update per connection change.
+     */
+    void setConnectionIndexEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether the reverse connection index is enabled.
+     */
+    bool isConnectionIndexEnabled() const;
+
+    /**
+     * @brief Read-only access to the reverse connection index.
+     * @return const ConnectionIndex* The index, or nullptr if disabled.
+     */
+    const ConnectionIndex* getConnectionIndex() const;
+
     /**
      * @brief Delegates a parameter change request to the appropriate layer and operator.
      * @param targetOperatorId The ID of the operator to modify.
-     * @param params A vector of integers specifying the parameter to change and its new value.
+     * @param params Integer parameters specifying the parameter to change and its new value.
      */
-    void handleParameterChange(uint32_t targetOperatorId, const std::vector<int>& params);
+    void handleParameterChange(uint32_t targetOperatorId, const UpdateParams& params);
 
     /**
      * @brief Delegates a request to add a connection to the appropriate layer and operator.
      * @param targetOperatorId The ID of the operator that will be the source of the connection.
-     * @param params A vector of integers specifying the target operator ID and distance for the new connection.
+     * @param params Integer parameters specifying the target operator ID and distance for the new connection.
      */
-    void handleAddConnection(uint32_t targetOperatorId, const std::vector<int>& params);
+    void handleAddConnection(uint32_t targetOperatorId, const UpdateParams& params);
 
     /**
      * @brief Delegates a request to remove a connection.
      * @param targetOperatorId The ID of the operator from which the connection originates.
-     * @param params A vector of integers specifying the target operator ID and distance to remove.
+     * @param params Integer parameters specifying the target operator ID and distance to remove.
      */
-    void handleRemoveConnection(uint32_t targetOperatorId, const std::vector<int>& params);
+    void handleRemoveConnection(uint32_t targetOperatorId, const UpdateParams& params);
 
     /**
      * @brief Delegates a request to move a connection.
      * @param targetOperatorId The ID of the operator whose connection is being moved.
-     * @param params A vector specifying the target ID, old distance, and new distance.
+     * @param params Integer parameters specifying the target ID, old distance, and new distance.
+     */
+    void handleMoveConnection(uint32_t targetOperatorId, const UpdateParams& params);
+
+    /**
+     * @brief Delegates a run of coalesced events for one operator to its layer.
+     * @details Used by UpdateController's batch mode. The layer is resolved once for the whole run
+     * instead of once per event. Safe to call concurrently for different operators as long as no
+     * operator or layer is created/deleted at the same time (UpdateController's parallel phase).
+     * @param targetOperatorId The ID of the operator every event in the run targets.
+     * @param events Parameter and connection events for that operator, in application order.
      */
-    void handleMoveConnection(uint32_t targetOperatorId, const std::vector<int>& params);
+    void handleOperatorUpdates(uint32_t targetOperatorId, const std::vector<UpdateEvent>& events);
 
     // --- Persistence ---
 
@@ -259,8 +333,27 @@ public:
 
     virtual int getTextCount();
 
+    /**
+     * @brief Gets the operator buffering an output channel.
+     * @return OutOperator* The channel's operator, or nullptr if the network has no OutputLayer.
+     * @details The pointer is valid until the network is replaced or cleared.
+     */
+    virtual OutOperator* getOutputChannel(ChannelType channel);
+
     virtual bool inputText(std::string input); 
 
+    /**
+     * @brief Submits characters to the InputLayer's text channel (see InputLayer::inputChars).
+     * @return bool False if the network has no InputLayer.
+     */
+    virtual bool inputChars(const char* data, size_t count);
+
+    /**
+     * @brief Submits a batch of messages to one of the InputLayer's channels (see InputLayer::inputSamples).
+     * @return bool False if the network has no InputLayer.
+     */
+    virtual bool inputSamples(ChannelType channel, const int* values, size_t count);
+
     virtual void clearTextOutput();
 
     virtual void setTextBatchSize(int size);
@@ -2,15 +2,17 @@
 
 #include <vector>
 #include <string>
-#include <unordered_set>
 #include <iosfwd> // For std::ostream forward declaration
 #include <cstddef> // For std::byte
 #include <cstdint> // For uint64_t etc.
+#include "../util/StepStats.h" // StepSample stored by value
+#include "../util/OperatorIdSet.h"
 
 // Forward Declarations
 class MetaController; // Required for dependency injection
 struct Payload;   	// Required for payload lists
 class Scheduler;  	// Can forward declare if only used for pointer type
+class OperatorProfiler; // Optional per-operator counters
 
 /**
  * @class TimeController
@@ -29,12 +31,33 @@ protected:
 	std::vector<Payload> currentStepPayloads;
 	// Payloads scheduled to start processing in the next step
 	std::vector<Payload> nextStepPayloads;
-	// IDs of operators that received messages in the previous step and need processData called
-	std::unordered_set<uint32_t> operatorsToProcess; // TODO, In order for this to work,  would need to store accumulated data when serializing operator objects. 
+	// IDs of operators that received messages in the previous step and need processData called.
+	// Processed in delivery order, and allocation-free once warmed up (see OperatorIdSet).
+	OperatorIdSet operatorsToProcess; // TODO, In order for this to work,  would need to store accumulated data when serializing operator objects. 
 
 	// Internal step counter (optional)
 	long long currentStep = 0; // TODO we currently do not store current Step, not really need, but may be nice to have. 
 
+	// Number of payloads emitted (scheduled into nextStepPayloads) during the previous step.
+	// Used as the reserve hint for the following step so emission does not reallocate mid-step.
+	size_t lastStepEmittedCount = 0;
+
+	// Instrumentation of the last processCurrentStep (traversal/operator check phases and counters).
+	// Reset at the start of every step, read by the Simulator's step statistics.
+	StepSample lastStepSample;
+
+	// Per-operator activity counters, only recorded while attached (not owned)
+	OperatorProfiler* operatorProfiler = nullptr;
+
+	/**
+     * @brief Ensures a payload vector can hold `required` elements without reallocating.
+     * @param payloads The vector to grow.
+     * @param required The total number of elements the vector must be able to hold.
+     * @details Grows geometrically (at least doubling) so repeated hints stay amortized O(1),
+     * and never shrinks. No-op when the current capacity is already sufficient.
+     */
+	static void reserveAmortized(std::vector<Payload>& payloads, size_t required);
+
 	/**
      * @brief Loads a specific number of payloads from the input stream.
      * @param in The input stream to read from.
@@ -48,10 +71,10 @@ protected:
      * @brief Loads a specific number of operator IDs from the input stream.
      * @param in The input stream to read from.
      * @param count The exact number of operator IDs to load.
-     * @return std::unordered_set<int> The set of loaded operator IDs.
+     * @return OperatorIdSet The set of loaded operator IDs.
      * @throws std::runtime_error On read errors, EOF, or parsing errors.
      */
-    std::unordered_set<uint32_t> loadOperatorsToProcess(std::istream& in, uint64_t count);
+    OperatorIdSet loadOperatorsToProcess(std::istream& in, uint64_t count);
 
 	/**
      * @brief Saves active payloads from a given vector to the output stream.
@@ -132,6 +155,28 @@ public:
  	 */
 	virtual void addToNextStepPayloads(const Payload& payload);
 
+	/**
+ 	 * @brief Constructs a new payload in place at the end of the next step's payload list.
+ 	 * @param messageData The message carried by the new payload.
+ 	 * @param sourceOperatorId The ID of the Operator starting the payload's journey.
+ 	 * @return Void.
+ 	 * @details Equivalent to `addToNextStepPayloads(Payload(messageData, sourceOperatorId))`
+ 	 * without the temporary. Capacity is pre-reserved from the previous step's emission count
+ 	 * (see advanceStep), so in steady state this does not allocate.
+ 	 * @note Called by Scheduler::emplacePayloadForNextStep.
+ 	 */
+	virtual void emplaceNextStepPayload(int messageData, uint32_t sourceOperatorId);
+
+	/**
+ 	 * @brief Hints that `additionalCount` more payloads are about to be emitted this step.
+ 	 * @param additionalCount Number of payloads the caller is about to schedule.
+ 	 * @return Void.
+ 	 * @details Lets operators that emit many payloads at once (e.g. InOperator) grow the
+ 	 * next step's payload list a single time instead of once per payload.
+ 	 * @note Called by Scheduler::reservePayloadsForNextStep.
+ 	 */
+	virtual void reserveNextStepPayloads(size_t additionalCount);
+
 	/**
  	 * @brief Delivers message data immediately and flags operator for next step processing.
  	 * @param targetOperatorId The ID of the operator receiving the message.
@@ -142,12 +187,55 @@ public:
  	 */
 	virtual void deliverAndFlagOperator(uint32_t targetOperatorId, int messageData);
 
+	/**
+ 	 * @brief Delivers a batch of messages to one operator and flags it once.
+ 	 * @param targetOperatorId The ID of the operator receiving the messages.
+ 	 * @param values The message values, in order.
+ 	 * @param count Number of values.
+ 	 * @note Called by Scheduler::scheduleMessages (bulk channel input). Counts `count` delivered messages.
+ 	 */
+	virtual void deliverBatchAndFlagOperator(uint32_t targetOperatorId, const int* values, size_t count);
+
 
 	// --- Getters (Optional) ---
 	virtual long long getCurrentStep() const;
 	virtual size_t getCurrentStepPayloadCount() const;
     virtual size_t getNextStepPayloadCount() const;
 
+	/**
+ 	 * @brief Gets the number of payloads emitted during the previous step.
+ 	 * @return size_t The count used as the reserve hint for the current step.
+ 	 */
+	virtual size_t getLastStepEmittedCount() const;
+
+	/**
+ 	 * @brief Gets the instrumentation of the last processCurrentStep call.
+ 	 * @return StepSample Traversal/operator check times and the step's counters. The update and
+ 	 * advance fields are left at 0, they are measured by the caller.
+ 	 */
+	virtual StepSample getLastStepSample() const;
+
+	/**
+ 	 * @brief Attaches a profiler that counts deliveries, fires, emitted payloads and traversal steps per operator.
+ 	 * @param profiler The profiler to record into (not owned), nullptr stops profiling.
+ 	 */
+	void setOperatorProfiler(OperatorProfiler* profiler);
+
+	/**
+ 	 * @brief Adds the operators the next processCurrentStep reads first: the sources of the
+ 	 * active payloads and the operators flagged for processData.
+ 	 * @param operators Receives the operator IDs.
+ 	 * @note Used with collectStepTargets by the Simulator's pipelined update mode.
+ 	 */
+	void collectStepSources(OperatorIdSet& operators) const;
+
+	/**
+ 	 * @brief Adds the operators the next traversal delivers to, which are also checked in the same step.
+ 	 * @param operators Receives the operator IDs.
+ 	 * @details Depends on the sources' current connections, so updates to the sources must be applied first.
+ 	 */
+	void collectStepTargets(OperatorIdSet& operators) const;
+
 	// --- Public State Persistence Methods ---
 
     /**
@@ -1,13 +1,20 @@
 #pragma once
 
 #include <vector>
-#include <queue> // Using queue might be slightly more appropriate than vector
 #include <string>
 #include <iosfwd>
+#include <unordered_map>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include "../UpdateEvent.h"          // Stored by value in the queue batches
+#include "../util/MpscBatchQueue.h"
+#include "../util/WorkerPool.h"
 
 // Forward Declarations
 class MetaController; // Required for dependency injection
-struct UpdateEvent;   // Required for the queue
+class OperatorIdSet;
 
 /**
  * @class UpdateController
@@ -20,10 +27,87 @@ private:
 	// Injected dependency (set via constructor)
 	MetaController& metaControllerInstance;
 
-	// Queue of pending update requests
-	std::queue<UpdateEvent> updateQueue;
+	// Queue of pending update requests.
+	// Lock-free multi-producer/single-consumer: operators on any thread submit into a per-thread
+	// batch, ProcessUpdates (the single consumer) drains every published batch between steps.
+	MpscBatchQueue<UpdateEvent> updateQueue;
+
+	// --- Batch mode (coalescing) state, reused between calls to avoid reallocating ---
+	bool coalescingEnabled = true;
+	std::vector<UpdateEvent> batchEvents;                  // events drained in the current round
+	std::vector<std::pair<uint32_t, size_t>> batchOrder;   // (target operator ID, index into batchEvents)
+
+	/**
+	 * @brief Slot of a coalescing key in operatorEvents. Only valid while its generation is current,
+	 * which lets the maps be reused across operators without clearing them per operator.
+	 */
+	struct CoalesceSlot {
+		size_t index = 0;
+		uint64_t generation = 0; // generations start at 1, a fresh slot never matches
+	};
+
+	/**
+	 * @brief Coalescing scratch of one shard. Every thread of the parallel phase owns one, so
+	 * shards share nothing but the (read-only) layer structure.
+	 */
+	struct CoalesceScratch {
+		std::vector<UpdateEvent> operatorEvents;                    // coalesced events of the operator being applied
+		std::unordered_map<int, CoalesceSlot> paramSlots;           // key: parameter ID
+		std::unordered_map<uint64_t, CoalesceSlot> connectionSlots; // key: (target ID << 32) | distance
+		uint64_t paramGeneration = 0;
+		uint64_t connectionGeneration = 0;
+		size_t appliedCount = 0;                                    // events dispatched by this shard
+	};
+	std::vector<CoalesceScratch> scratch;                  // index 0 also serves serial segments
+	std::vector<std::pair<size_t, size_t>> shardBounds;    // [begin, end) into batchOrder per shard
+
+	// --- Parallel update phase ---
+	size_t workerThreadCount = WorkerPool::defaultWorkerCount(); // threads besides the caller, 0 = serial
+	size_t parallelThreshold = DEFAULT_PARALLEL_THRESHOLD;       // minimum segment size worth sharding
+	std::unique_ptr<WorkerPool> workerPool;                      // started on the first parallel segment
+
+	size_t lastReceivedCount = 0; // events drained by the last ProcessUpdates
+	size_t lastAppliedCount = 0;  // events dispatched after coalescing by the last ProcessUpdates
+
+	// --- Staged events (pipelined mode), drained by StageUpdates and applied later in queue order ---
+	std::vector<UpdateEvent> stagedEvents;
+	size_t stagedLifecycleCount = 0; // CREATE/DELETE events among stagedEvents
+
+	/**
+	 * @brief Applies batchEvents (coalesced or one by one) and empties it.
+	 */
+	void applyBatchEvents();
+
+	/**
+	 * @brief Dispatches a single event to the matching MetaController handler.
+	 * @param event The UpdateEvent to apply.
+	 */
+	void applyEvent(const UpdateEvent& event);
+
+	/**
+	 * @brief Applies batchEvents, lifecycle events act as barriers between coalesced segments.
+	 */
+	void applyBatch();
+
+	/**
+	 * @brief Groups batchEvents[begin, end) by target operator and applies each group in one pass.
+	 */
+	void applySegment(size_t begin, size_t end);
+
+	/**
+	 * @brief Coalesces and applies every operator run within batchOrder[begin, end) using one scratch.
+	 */
+	void applyRuns(CoalesceScratch& shard, size_t begin, size_t end);
+
+	/**
+	 * @brief Builds shard.operatorEvents from the batchOrder entries [runBegin, runEnd) of one operator.
+	 */
+	void coalesceOperatorEvents(CoalesceScratch& shard, size_t runBegin, size_t runEnd);
 
 public:
+	// Segments smaller than this are applied on the calling thread, waking the pool would cost more
+	static constexpr size_t DEFAULT_PARALLEL_THRESHOLD = 4096;
+
 	/**
  	 * @brief Constructor for UpdateController.
  	 * @param metaController A reference to the simulation's MetaController instance.
@@ -50,10 +134,20 @@ public:
  	 * @brief Adds an UpdateEvent to the processing queue.
  	 * @param event The UpdateEvent to be queued.
  	 * @return Void.
- 	 * @note Called by UpdateScheduler::Submit.
+ 	 * @note Called by UpdateScheduler::Submit. Thread-safe and lock-free, the event is buffered
+ 	 * in the calling thread's batch until the batch fills or is flushed.
  	 */
 	void AddToQueue(const UpdateEvent& event);
 
+	/**
+ 	 * @brief Publishes the calling thread's partially filled batch of events.
+ 	 * @return Void.
+ 	 * @details Worker threads that submit updates must call this once they finish their share
+ 	 * of a step, before the update barrier. The thread running ProcessUpdates is flushed automatically.
+ 	 * @note Called by UpdateScheduler::Flush.
+ 	 */
+	void FlushThreadBatch();
+
 	/**
  	 * @brief Processes all events currently in the update queue.
  	 * @param None
@@ -61,10 +155,106 @@ public:
  	 * @details Iterates through the queue, coordinates with MetaController for
  	 * lifecycle events, retrieves Operator pointers, and calls internal
  	 * update methods on Operators for parameter/connection changes.
- 	 * Clears the queue afterwards. Should be called between Time steps.
+ 	 * Clears the queue afterwards. Should be called between Time steps, by a single thread.
+ 	 * In batch mode (default) events are grouped by target operator and redundant ones are merged
+ 	 * before being applied, see SetCoalescing. Staged events (see StageUpdates) are applied first.
  	 */
 	void ProcessUpdates();
 
+	/**
+ 	 * @brief Drains the queue into the staging area without applying anything.
+ 	 * @return size_t Number of events staged by this call.
+ 	 * @details First half of the pipelined update mode (see Simulator::setPipelinedUpdates): the
+ 	 * events of step N are staged at the end of the step and applied at the start of step N+1, the
+ 	 * ones the step's operators depend on first (ApplyStagedFor), the rest (ApplyStaged) possibly on
+ 	 * another thread while the step runs. Resets LastReceivedCount/LastAppliedCount, the apply calls
+ 	 * add to LastAppliedCount. Called by the simulation thread.
+ 	 */
+	size_t StageUpdates();
+
+	/**
+ 	 * @brief Applies, in queue order, the staged events targeting one of `operators`, and unstages them.
+ 	 * @param operators Target operator IDs.
+ 	 * @return size_t Number of staged events taken.
+ 	 * @details Events keep their relative order and are coalesced like in ProcessUpdates. Every event
+ 	 * only touches its target operator, so applying a subset first gives the same result as the
+ 	 * queue order as long as nothing reads the remaining targets in between. If a CREATE/DELETE is
+ 	 * staged, which can change any operator, everything staged is applied.
+ 	 */
+	size_t ApplyStagedFor(const OperatorIdSet& operators);
+
+	/**
+ 	 * @brief Applies every staged event in queue order and empties the staging area.
+ 	 * @details May run on another thread than the simulation thread, as long as nothing else reads
+ 	 * or writes the staged events' target operators meanwhile and no other UpdateController call
+ 	 * except AddToQueue/FlushThreadBatch is made until it returns.
+ 	 */
+	void ApplyStaged();
+
+	/**
+ 	 * @brief Number of events staged and not yet applied.
+ 	 */
+	size_t StagedCount() const;
+
+	/**
+ 	 * @brief Checks whether a CREATE/DELETE event is staged (ApplyStagedFor then applies everything).
+ 	 */
+	bool HasStagedLifecycleEvents() const;
+
+	/**
+ 	 * @brief Enables or disables batch mode for ProcessUpdates.
+ 	 * @param enabled True to group and coalesce events (default), false to apply every event on its own in queue order.
+ 	 * @details Batch mode gives the same resulting network as applying events one by one:
+ 	 * - Create/delete events are barriers, everything before them is applied first.
+ 	 * - Between barriers, events are grouped per target operator (per-operator order is kept) and
+ 	 *   each operator is resolved once.
+ 	 * - Repeated CHANGE_OPERATOR_PARAMETER on the same parameter keeps only the last value.
+ 	 * - Add/remove of the same (target, distance) keeps only the last one, so an add followed by a
+ 	 *   remove ends as a single remove. A move is applied in place and is not merged across.
+ 	 */
+	void SetCoalescing(bool enabled);
+
+	/**
+ 	 * @brief Checks whether batch mode is enabled.
+ 	 * @return bool True if ProcessUpdates coalesces events.
+ 	 */
+	bool IsCoalescing() const;
+
+	/**
+ 	 * @brief Number of events drained by the last ProcessUpdates call.
+ 	 * @return size_t The event count before coalescing.
+ 	 */
+	size_t LastReceivedCount() const;
+
+	/**
+ 	 * @brief Number of events actually applied by the last ProcessUpdates call.
+ 	 * @return size_t The event count after coalescing (equal to LastReceivedCount when batch mode is off).
+ 	 */
+	size_t LastAppliedCount() const;
+
+	/**
+ 	 * @brief Sets how many worker threads the parallel update phase uses besides the calling thread.
+ 	 * @param count Worker threads, 0 applies every update on the calling thread. Defaults to hardware threads - 1.
+ 	 * @details In batch mode, parameter and connection events of different operators never conflict,
+ 	 * so a large segment is sharded by target operator ID (each operator's events stay in one shard
+ 	 * and in order) and the shards are applied concurrently. CREATE/DELETE events stay in a serial
+ 	 * lane on the calling thread, in queue order, so ID generation is unchanged. The result does not
+ 	 * depend on the thread count.
+ 	 */
+	void SetWorkerThreads(size_t count);
+
+	/**
+ 	 * @brief Gets the number of worker threads used besides the calling thread.
+ 	 * @return size_t The configured worker count.
+ 	 */
+	size_t GetWorkerThreads() const;
+
+	/**
+ 	 * @brief Sets the minimum number of events in a segment before it is applied in parallel.
+ 	 * @param minEvents Segment size threshold, see DEFAULT_PARALLEL_THRESHOLD.
+ 	 */
+	void SetParallelThreshold(size_t minEvents);
+
 	/**
  	 * @brief Checks if the update queue is empty.
  	 * @return bool True if the queue is empty, false otherwise.
@@ -85,6 +275,7 @@ public:
      * @param filePath The path to the file where the queue state should be saved.
      * @return bool True if saving was successful, false otherwise.
      * @details Writes UpdateEvents sequentially using their serialization format. No header/count.
+     * Staged events (pipelined mode) come first, then the queued ones, in the order they would be applied.
      * State File Format (Condensed - Big Endian): Sequence of UpdateEvent Blocks.
      * - UpdateEvent Block: [uint8_t Size N][N bytes of Event Data] (See UpdateEvent format)
      */
@@ -0,0 +1,9 @@
+#pragma once
+#include <cstdint>
+
+// Channels of the InputLayer and OutputLayer, the value is the channel operator's offset in the layer's ID range
+enum class ChannelType : uint8_t {
+    TEXT = 0,
+    IMAGE = 1,
+    AUDIO = 2
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Layer.h" // Include the abstract base class
+#include "ChannelType.h"
 
 // Forward declarations
 class Randomizer;
@@ -77,4 +78,21 @@ public:
      */
     void inputText(std::string text); 
 
+    /**
+     * @brief Submits `count` characters into the text channel, without copying them into a string first.
+     * @param data The characters, in order.
+     * @param count Number of characters.
+     * @details Used by the streaming text input (TextInputStream), which feeds a bounded slice per step.
+     */
+    void inputChars(const char* data, size_t count);
+
+    /**
+     * @brief Submits `count` already converted messages into a channel's operator as one batch.
+     * @param channel The channel (image and audio samples are converted by SampleCodec).
+     * @param values The messages, in order.
+     * @param count Number of messages.
+     * @details The batch is scheduled with a single call, the operator is flagged once for the next step.
+     */
+    void inputSamples(ChannelType channel, const int* values, size_t count);
+
 };
\ No newline at end of file
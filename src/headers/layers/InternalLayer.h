@@ -7,7 +7,12 @@ class Randomizer;
 struct IdRange;
 
 class InternalLayer : public Layer {
+private:
+    size_t randomInitThreads = 0; // 0 = one per hardware thread
+
 public:
+    static constexpr size_t RANDOM_INIT_CHUNK_SIZE = 4096; // operators per RNG stream and parallel task
+
     /**
      * @brief Constructor for programmatic creation.
      * @param isLayerRangeFinal Defines if the layer's ID range is static or dynamic.
@@ -43,6 +48,17 @@ public:
      * @param validConnectionRange The global ID range this layer's operators are permitted to connect to.
      * This range is determined by MetaController (e.g., by combining the ID ranges of all
      * internal and output layers).
+     *
+     * @details The new operators are randomized in chunks of RANDOM_INIT_CHUNK_SIZE, each drawing from its
+     * own child of `randomizer` (Randomizer::split), and the chunks run in parallel. The children are split
+     * in chunk order before any work starts, so the network is identical for every thread count. If the
+     * randomizer cannot be split (e.g. a mock), the operators draw from it one after another.
      */
     void randomInit(IdRange* validConnectionRange, Randomizer* randomizer) override;
+
+    /**
+     * @brief Sets the number of threads used by randomInit.
+     * @param threads 0 (default) uses one per hardware thread. The result does not depend on it.
+     */
+    void setRandomInitThreads(size_t threads) { randomInitThreads = threads; }
 };
\ No newline at end of file
@@ -15,6 +15,9 @@ class Payload;
 class MetaController;
 class Serializer;     // Assumed to be available
 class Randomizer; 
+class ConnectionIndex;
+struct UpdateParams;
+struct UpdateEvent;
 class Layer {
 protected:
     LayerType type;
@@ -25,6 +28,7 @@ protected:
     uint32_t currentMinId = std::numeric_limits<uint32_t>::max(); 
     uint32_t currentMaxId = 0; 
     std::unordered_map<uint32_t, Operator*> operators;
+    ConnectionIndex* connectionIndex = nullptr; // Not owned (MetaController), attached to every operator added
 
     // not accessible for construction, as is to be treated as abstract
     // set reserved range to 
@@ -111,6 +115,12 @@ public:
 
     Operator* getOperator(uint32_t operatorId) const;
     const std::unordered_map<uint32_t, Operator*>& getAllOperators() const;
+
+    /**
+     * @brief Attaches the layer and all of its operators to a reverse connection index.
+     * @param index The index to keep in sync, nullptr detaches. Operators added later are attached too.
+     */
+    void setConnectionIndex(ConnectionIndex* index);
     
 
     LayerType getLayerType() const { return type; }
@@ -129,6 +139,9 @@ public:
      */
     bool messageOperator(uint32_t operatorId, int message);
 
+    // delivers a batch of messages to one operator (see Operator::messageBatch), false if it does not exist
+    bool messageOperatorBatch(uint32_t operatorId, const int* values, size_t count);
+
     void processOperatorData(uint32_t operatorId);
 
     void traverseOperatorPayload(Payload* Payload);
@@ -142,7 +155,7 @@ public:
      * internal ID generation to assign a new ID and instantiates the operator.
      * @param params Parameters from the UpdateEvent, specifying operator type, etc.
      */
-    virtual void createOperator(const std::vector<int>& params);
+    virtual void createOperator(const UpdateParams& params);
 
     /**
      * @brief Deletes an operator from this layer.
@@ -156,28 +169,37 @@ public:
      * @param targetOperatorId The ID of the operator to modify.
      * @param params Parameters from the UpdateEvent for the change.
      */
-    virtual void changeOperatorParam(uint32_t targetOperatorId, const std::vector<int>& params);
+    virtual void changeOperatorParam(uint32_t targetOperatorId, const UpdateParams& params);
 
     /**
      * @brief Adds a connection to an operator within this layer.
      * @param sourceOperatorId The ID of the operator to add the connection to.
      * @param params Parameters from the UpdateEvent specifying target and distance.
      */
-    virtual void addOperatorConnection(uint32_t sourceOperatorId, const std::vector<int>& params);
+    virtual void addOperatorConnection(uint32_t sourceOperatorId, const UpdateParams& params);
 
     /**
      * @brief Removes a connection from an operator within this layer.
      * @param sourceOperatorId The ID of the operator to remove the connection from.
      * @param params Parameters from the UpdateEvent specifying target and distance.
      */
-    virtual void removeOperatorConnection(uint32_t sourceOperatorId, const std::vector<int>& params);
+    virtual void removeOperatorConnection(uint32_t sourceOperatorId, const UpdateParams& params);
 
     /**
      * @brief Moves a connection for an operator within this layer.
      * @param sourceOperatorId The ID of the operator whose connection is to be moved.
      * @param params Parameters from the UpdateEvent specifying target, old, and new distances.
      */
-    virtual void moveOperatorConnection(uint32_t sourceOperatorId, const std::vector<int>& params);
+    virtual void moveOperatorConnection(uint32_t sourceOperatorId, const UpdateParams& params);
+
+    /**
+     * @brief Applies a run of already coalesced update events to one operator in a single pass.
+     * @details The operator is looked up once, then each parameter/connection event is applied in
+     * order. Lifecycle events (create/delete) are not per-operator and are ignored here.
+     * @param operatorId The ID of the operator every event in the run targets.
+     * @param events The events to apply, in application order.
+     */
+    virtual void applyOperatorUpdates(uint32_t operatorId, const std::vector<UpdateEvent>& events);
 
 
     /**
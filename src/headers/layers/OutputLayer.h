@@ -1,10 +1,12 @@
 #pragma once
 
 #include "Layer.h" // Include the abstract base class
+#include "ChannelType.h"
 
 // Forward declarations
 class Randomizer;
 struct IdRange;
+class OutOperator;
 
 class OutputLayer : public Layer {
 private: 
@@ -68,6 +70,13 @@ public:
     void clearTextOutput();
 
     std::string getTextOutput(); 
+
+    /**
+     * @brief Gets the operator that buffers a channel's output.
+     * @param channel The output channel.
+     * @return OutOperator* The channel's operator, owned by this layer.
+     */
+    OutOperator* getChannelOperator(ChannelType channel);
     /**
      * @brief Implements the random initialization logic specific to an Internal Layer.
      *
@@ -36,13 +36,16 @@ class Serializer;
  * - Resets `accumulateData` to 0.
  */
 class AddOperator : public Operator {
-private:
+public:
+    // Randomization limits, shared with NetworkGenerator so generated networks stay within them
     static constexpr int MAX_CONNECTIONS = 2 << Constants::NETWORK_SIZE;
     static constexpr int MAX_DISTANCE = 2 << Constants::NETWORK_SIZE; 
     static constexpr int MIN_THRESHOLD = 0;
     static constexpr int MAX_THRESHOLD = 32; // TODO issue, inOperators will only pass
     static constexpr int MIN_WEIGHT = -2056;
     static constexpr int MAX_WEIGHT = 2056; 
+
+private:
     int weight;
     int threshold;
     int accumulateData; // Specific to AddOperator for integer accumulation
@@ -133,7 +136,7 @@ public:
     std::string toJson(bool prettyPrint = false, bool encloseInBrackets = true, int indentLevel = 0) const override;
 
 
-    void changeParams(const std::vector<int>& params) override; // TODO may not want method to be of const type 
+    void changeParams(const UpdateParams& params) override; // TODO may not want method to be of const type 
 
 
 
@@ -8,11 +8,22 @@
 class InOperator: public Operator{
 private:
     std::vector<int> accumulatedData; // TODO does order matter? Will it be preserved 
+    size_t droppedThisStep = 0; // values refused since the last processData, logged there
+    uint64_t droppedTotal = 0;
 
 public:
     static constexpr Operator::Type OP_TYPE = Operator::Type::IN;
     static constexpr int MAX_CONNECTIONS = 2 << Constants::NETWORK_SIZE;
     static constexpr int MAX_DISTANCE = 2 << Constants::NETWORK_SIZE; 
+    /**
+     * @brief Upper bound on values held in `accumulatedData` between two processData calls.
+     * @details Messages arriving after the limit is reached within a step are dropped, so a
+     * single large submission cannot grow the buffer (and the next step's payload burst)
+     * without bound. Callers feeding more than this per step should spread input across steps.
+     * Dropped values are counted (getDroppedCount) and reported as an "in_operator.dropped"
+     * warning when the step is processed.
+     */
+    static constexpr size_t MAX_ACCUMULATED_DATA = 1 << 17; // 131072 values per step
 
 
     InOperator(uint32_t id) ;
@@ -29,6 +40,7 @@ public:
     void randomInit(IdRange* idRange, Randomizer* rng) override;
 
     void message(const int payloadData) override;
+    void messageBatch(const int* values, size_t count) override; // appends the batch, same bound as message(int)
     void message(const float payloadData) override; // InOperator might ignore or cast these
     void message(const double payloadData) override; // InOperator might ignore or cast these
 
@@ -45,6 +57,11 @@ public:
     void processData() override; 
 
 
+    /**
+     * @brief Number of values dropped at the MAX_ACCUMULATED_DATA bound since construction.
+     */
+    uint64_t getDroppedCount() const;
+
     Operator::Type getOpType() const override; 
     std::vector<std::byte> serializeToBytes() const override;
 
@@ -57,7 +74,7 @@ public:
      * @note Key Logic Steps: Constructs a JSON object string by calling the base class `toJson` method to get common properties, then appending its own specific properties like "weight", "threshold", and "accumulateData".
      */
     std::string toJson(bool prettyPrint = false, bool encloseInBrackets = true, int indentLevel = 0) const override;
-    void changeParams(const std::vector<int>& params) override; // TODO may not want method to be of const type, and needs support for different data Types
+    void changeParams(const UpdateParams& params) override; // TODO may not want method to be of const type, and needs support for different data Types
 
     /**
      * @brief [Override] Compares this InOperator's state with another for equality.
@@ -16,6 +16,7 @@
 class Scheduler;
 class UpdateScheduler;
 class Serializer; // For use in derived classes, and potentially base for connections
+class ConnectionIndex; // Optional reverse (incoming) connection index
 
 /**
  * @class Operator
@@ -46,6 +47,7 @@ class Operator {
 protected:
     uint32_t operatorId;             // Unique ID for this Operator. Read by constructor from stream.
     DynamicArray<std::unordered_set<uint32_t>> outputConnections; // Stores outgoing connections.
+    ConnectionIndex* incomingIndex = nullptr; // Not owned. When set, connection changes are mirrored into it.
 
 
     /**
@@ -140,6 +142,15 @@ public:
      */
     virtual void message(const double payloadData) = 0;
 
+    /**
+     * @brief Receives `count` integer messages at once, in order.
+     * @param values The message values.
+     * @param count Number of values.
+     * @details Default: one message(int) per value. Operators that buffer their input (InOperator)
+     * override it to append the whole batch. Called by TimeController::deliverBatchAndFlagOperator.
+     */
+    virtual void messageBatch(const int* values, size_t count);
+
 
     /**
      * @brief [Pure Virtual] Processes accumulated/received data and potentially fires/creates new payloads.
@@ -154,7 +165,7 @@ public:
      * Use to make changes to the operator, when update event occurs. 
      * Operator specific 
      */
-    virtual void changeParams(const std::vector<int>& params) = 0; 
+    virtual void changeParams(const UpdateParams& params) = 0; 
 
     /**
      * @brief [Pure Virtual] Gets the specific OperatorType of this concrete operator instance.
@@ -200,6 +211,15 @@ public:
     /** @brief Gets a read-only reference to the output connections map. @return const DynamicArray<...>& */
     virtual const DynamicArray<std::unordered_set<uint32_t>>& getOutputConnections() const;
 
+    /**
+     * @brief Attaches this operator to a reverse connection index (or detaches it with nullptr).
+     * @param index The index to mirror connection changes into, not owned.
+     * @details The operator's existing connections are removed from the previous index and
+     * registered with the new one, after which the Internal connection methods keep it in sync.
+     * Passing the current index again re-registers the connections, e.g. after the index was cleared.
+     */
+    void setConnectionIndex(ConnectionIndex* index);
+
     // --- Common Concrete Methods See "Operator.cpp"---
 
     /**
@@ -226,7 +246,7 @@ public:
      * UpdateController via the UpdateScheduler static interface. Used for internal
      * self-modification requests or triggered cleanup actions (like removing dangling connections).
      */
-    virtual void requestUpdate(UpdateType type, const std::vector<int>& params);
+    virtual void requestUpdate(UpdateType type, const UpdateParams& params);
 
 
     /**
@@ -1,18 +1,37 @@
 #pragma once
 
 #include "Operator.h"
-#include <deque> 
+#include "../util/SpscRing.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 
 // TODO better comments
 class OutOperator: public Operator{
 
 private: 
-    std::deque<int> data; 
+    /**
+     * Output values, oldest first. The simulation thread is the only producer (message), readers
+     * consume in place. Reader-side operations are serialized by readerMutex so the run loop never
+     * waits for a reader, and a reader never needs simMutex. The ring starts small and grows with the
+     * backlog up to MAX_DATA_BUFFER_SIZE, so an idle or promptly read channel stays cheap.
+     */
+    SpscRing<int> data{MAX_DATA_BUFFER_SIZE, INITIAL_DATA_BUFFER_SIZE};
+    mutable std::mutex readerMutex;
+    std::atomic<uint64_t> droppedCount{0}; // values rejected because the buffer was full
+
+    // appends a value, counting it as dropped if the buffer is full
+    void store(int value);
+
+    // copy of the buffered values, oldest first, without consuming them
+    std::vector<int> snapshotData() const;
 
 public:
     static constexpr Operator::Type OP_TYPE = Operator::Type::OUT;
-    static constexpr size_t MAX_DATA_BUFFER_SIZE = 8192000;
-    size_t output_batch_size = 512; // batch size for operator 
+    static constexpr size_t MAX_DATA_BUFFER_SIZE = 8192000; // buffered values, further output is dropped until read
+    static constexpr size_t INITIAL_DATA_BUFFER_SIZE = 1024; // slots allocated on the first value, doubled as needed
+    size_t output_batch_size = 512; // most characters per getDataAsString call, 0 = no limit
     // TODO batch size may not be relevant for say image channel
 
     OutOperator(uint32_t id) ;
@@ -66,12 +85,12 @@ public:
      * @note Key Logic Steps: Constructs a JSON object string by calling the base class `toJson` method to get common properties, then appending its own specific properties like "weight", "threshold", and "accumulateData".
      */
     std::string toJson(bool prettyPrint = false, bool encloseInBrackets = true, int indentLevel = 0) const override;
-    void changeParams(const std::vector<int>& params) override; // TODO may not want method to be of const type, and needs support for different data Types
+    void changeParams(const UpdateParams& params) override; // TODO may not want method to be of const type, and needs support for different data Types
 
     /**
      * @brief [Override] Compares this OutOperator's state with another for equality.
      * @param other The Operator object to compare against.
-     * @return bool True if the base state is equal and the `data` vectors are identical.
+     * @return bool True if the base state is equal and the buffered data is identical.
      * @details Invokes the base `Operator::equals` method first, then compares the
      * content of the internal data buffer. 
      */
@@ -79,17 +98,55 @@ public:
 
     // --- OutOperator-Specific Methods ---
     /**
-     * @brief Converts the stored integer data into an ASCII string and clears the internal buffer.
-     * @return std::string A string where each character is derived from an integer in the data buffer.
+     * @brief Converts the oldest stored integer data into an ASCII string and removes it from the buffer.
+     * @return std::string A string where each character is derived from an integer in the data buffer,
+     * at most `output_batch_size` characters (see setBatchSize), the rest stays for the next call.
      * @details For each integer `v` in the internal `data` vector, this method scales it from the
      * range of a positive integer `[0, INT_MAX]` down to the ASCII range `[0, 255]`. It uses an
      * efficient bit-shift operation `(v >> (INT_BITS - 8))` to approximate `(v * 255) / INT_MAX`.
-     * After generating the string, the internal data buffer is cleared.
      */
     std::string getDataAsString();
 
+    /**
+     * @brief Converts up to `maxChars` of the oldest buffered values into `out` and consumes them.
+     * @return size_t Number of characters written (not NUL-terminated).
+     * @details Same scaling as getDataAsString, through a vectorized kernel (SampleCodec::messagesToBytes),
+     * without a string in between and independent of the batch size. Thread-safe in the same way as drainOutput.
+     */
+    size_t readText(char* out, size_t maxChars);
+
     void clearData();
 
+    /**
+     * @brief Consumes up to `maxItems` of the oldest buffered values in place, without copying.
+     * @param maxItems Most values handed out.
+     * @param consumer Called as consumer(const int* values, size_t count) once, or twice when the
+     * buffer wraps. The values are only valid during the call.
+     * @return size_t Number of values consumed.
+     * @details Safe to call from any thread while the simulation runs: it only takes this operator's
+     * reader lock, which the run loop never takes.
+     */
+    template<typename Fn>
+    size_t drainOutput(size_t maxItems, Fn&& consumer) {
+        std::lock_guard<std::mutex> lock(readerMutex);
+        return data.consume(maxItems, consumer);
+    }
+
+    /**
+     * @brief Copies up to `maxItems` of the oldest buffered values into `out` and consumes them.
+     * @return size_t Number of values written to `out`.
+     * @details Thread-safe in the same way as drainOutput.
+     */
+    size_t readOutput(int* out, size_t maxItems);
+
+    /**
+     * @brief Number of values dropped because the buffer held MAX_DATA_BUFFER_SIZE unread values.
+     */
+    uint64_t getDroppedCount() const;
+
+    /**
+     * @brief Sets the most characters returned per getDataAsString call, 0 for no limit (negative is ignored).
+     */
     void setBatchSize(int size);
 
 };
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class AllocationCounter
+ * @brief Opt-in heap allocation counter for tests, benchmarks and the performance harness.
+ *
+ * @details Nothing is counted unless an executable installs the counting operator new by including
+ * AllocationHooks.h in exactly one of its translation units; the library itself never does. Counting
+ * is armed per thread with a Scope (allocations made by that thread) or for every thread with
+ * Scope(AllocationCounter::ALL_THREADS), and costs a thread-local check per allocation otherwise.
+ *
+ * Usage:
+ *     AllocationCounter::Scope scope;
+ *     timeController.processCurrentStep();
+ *     EXPECT_EQ(scope.allocations(), 0u);
+ */
+class AllocationCounter {
+public:
+    static constexpr bool ALL_THREADS = true;
+
+private:
+    static inline std::atomic<uint64_t> allocationCount{0};
+    static inline std::atomic<uint64_t> allocatedBytes{0};
+    static inline std::atomic<int> allThreadsArmed{0};   // Scopes counting every thread
+    static inline thread_local int threadArmed = 0;      // Scopes counting this thread
+    static inline std::atomic<bool> hooksInstalled{false};
+
+public:
+    /**
+     * @brief Called by the hooks for every allocation.
+     */
+    static void record(size_t bytes) noexcept {
+        if (threadArmed > 0 || allThreadsArmed.load(std::memory_order_relaxed) > 0) {
+            allocationCount.fetch_add(1, std::memory_order_relaxed);
+            allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Called once by AllocationHooks.h during static initialization.
+     */
+    static void markInstalled() noexcept { hooksInstalled.store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks whether this executable counts allocations at all.
+     * @return bool False if AllocationHooks.h is not linked in, every Scope then reads zero.
+     */
+    static bool isInstalled() noexcept { return hooksInstalled.load(std::memory_order_relaxed); }
+
+    /**
+     * @class Scope
+     * @brief Counts the allocations made while it is alive.
+     * @details Scopes may nest and overlap; each reports the total counted during its own lifetime,
+     * including allocations of other armed threads.
+     */
+    class Scope {
+    private:
+        bool allThreads;
+        uint64_t startCount;
+        uint64_t startBytes;
+
+    public:
+        explicit Scope(bool countAllThreads = false) noexcept : allThreads(countAllThreads) {
+            if (allThreads) {
+                allThreadsArmed.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                ++threadArmed;
+            }
+            startCount = allocationCount.load(std::memory_order_relaxed);
+            startBytes = allocatedBytes.load(std::memory_order_relaxed);
+        }
+
+        ~Scope() {
+            if (allThreads) {
+                allThreadsArmed.fetch_sub(1, std::memory_order_relaxed);
+            } else {
+                --threadArmed;
+            }
+        }
+
+        uint64_t allocations() const noexcept { return allocationCount.load(std::memory_order_relaxed) - startCount; }
+        uint64_t bytes() const noexcept { return allocatedBytes.load(std::memory_order_relaxed) - startBytes; }
+
+        // Prevent copying/assignment
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+};
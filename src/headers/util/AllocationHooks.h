@@ -0,0 +1,57 @@
+#pragma once
+
+// Counting replacements of the global operator new/delete, feeding AllocationCounter.
+// Include in exactly ONE translation unit of a test, benchmark or tool executable (the replacements
+// are ordinary definitions, a second copy is a link error). Never include it from the library.
+
+#include "AllocationCounter.h"
+#include <cstdlib>
+#include <new>
+
+namespace athena_allocation_hooks {
+    inline void* allocate(std::size_t size) {
+        AllocationCounter::record(size);
+        if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+            return ptr;
+        }
+        throw std::bad_alloc();
+    }
+
+    inline void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+        AllocationCounter::record(size);
+        std::size_t align = static_cast<std::size_t>(alignment);
+        std::size_t rounded = (size + align - 1) / align * align; // aligned_alloc needs a multiple of the alignment
+        if (void* ptr = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+            return ptr;
+        }
+        throw std::bad_alloc();
+    }
+
+    const bool installed = (AllocationCounter::markInstalled(), true);
+}
+
+void* operator new(std::size_t size) { return athena_allocation_hooks::allocate(size); }
+void* operator new[](std::size_t size) { return athena_allocation_hooks::allocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return athena_allocation_hooks::allocate(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return athena_allocation_hooks::allocate(size); } catch (...) { return nullptr; }
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return athena_allocation_hooks::allocateAligned(size, alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return athena_allocation_hooks::allocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct LogField
+ * @brief One structured key/value pair of a log record. The key must be a string literal.
+ */
+struct LogField {
+    const char* key;
+    long long value;
+};
+
+/**
+ * @class AsyncLogger
+ * @brief Leveled, structured logger whose formatting and I/O happen on a background thread.
+ *
+ * @details
+ * Logging a record only copies it (level, timestamp, event name, up to MAX_FIELDS integer fields
+ * and a short text) into a bounded lock-free ring. The writer thread formats the records, batches
+ * them and writes each batch with a single console write, so the simulation thread never waits
+ * on I/O or on the console mutex.
+ *
+ * - Records below the minimum level are rejected by one relaxed atomic load.
+ * - When the ring is full the record is dropped (counted, never blocks).
+ * - At most `rateLimit` records per second are accepted, ERROR records are exempt. Suppressed
+ *   and dropped records are reported by the writer as a summary line.
+ *
+ * Output line format: `[LEVEL] <seconds since start>s <event> key=value ... "text"`.
+ * Event names and field keys are stored as pointers and must be string literals.
+ */
+class AsyncLogger {
+public:
+    enum class Level : uint8_t {
+        DEBUG = 0,
+        INFO = 1,
+        WARN = 2,
+        ERROR = 3,
+        OFF = 4
+    };
+
+    static constexpr size_t MAX_FIELDS = 4;
+    static constexpr size_t TEXT_CAPACITY = 120;
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+    static constexpr size_t DEFAULT_RATE_LIMIT = 1000; // records per second
+
+private:
+    struct LogRecord {
+        Level level = Level::INFO;
+        uint8_t fieldCount = 0;
+        uint64_t timestampNs = 0;
+        const char* event = nullptr;
+        LogField fields[MAX_FIELDS] = {};
+        char text[TEXT_CAPACITY] = {};
+    };
+
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        LogRecord record;
+    };
+
+    // --- Bounded MPSC ring (sequence-numbered slots) ---
+    std::vector<Slot> slots;
+    size_t mask;
+    std::atomic<size_t> enqueuePos{0};
+    size_t dequeuePos = 0;                  // writer thread only
+    std::atomic<size_t> consumedPos{0};     // published dequeuePos, for flush
+
+    std::atomic<Level> minLevel{Level::INFO};
+    std::atomic<size_t> rateLimit{DEFAULT_RATE_LIMIT};
+    std::atomic<uint64_t> rateWindowSecond{0};
+    std::atomic<size_t> rateWindowCount{0};
+    std::atomic<uint64_t> droppedCount{0};
+    std::atomic<uint64_t> suppressedCount{0};
+    uint64_t reportedDropped = 0;           // writer thread only
+    uint64_t reportedSuppressed = 0;        // writer thread only
+
+    const uint64_t startNs;
+
+    // --- Writer thread ---
+    std::thread writer;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable flushedCondition;
+    bool stopping = false;
+    bool flushRequested = false;
+
+    std::mutex sinkMutex;
+    std::ostream* sink = nullptr;           // nullptr = console (through ConsoleWriter)
+
+    static uint64_t nowNs();
+    bool admit(Level level);
+    void writerLoop();
+    size_t drainOnce(std::string& batch);
+    void appendFormatted(std::string& batch, const LogRecord& record) const;
+    void writeBatch(const std::string& batch);
+
+public:
+    /**
+     * @brief Constructor, starts the writer thread.
+     * @param capacity Ring capacity in records, rounded up to a power of two.
+     */
+    explicit AsyncLogger(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Writes every queued record, then stops the writer thread.
+     */
+    ~AsyncLogger();
+
+    // Prevent copying/assignment
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    /**
+     * @brief Gets the process-wide logger used by the simulator.
+     */
+    static AsyncLogger& get();
+
+    /**
+     * @brief Queues a record. Never blocks and never formats on the calling thread.
+     * @param level Severity of the record.
+     * @param event Static event name (e.g. "sim.finished").
+     * @param fields Up to MAX_FIELDS integer fields, extra ones are ignored.
+     * @param text Optional free text, truncated to TEXT_CAPACITY - 1 characters.
+     * @return bool True if the record was queued, false if filtered, rate limited or dropped.
+     */
+    bool log(Level level, const char* event, std::initializer_list<LogField> fields = {}, std::string_view text = {});
+
+    bool debug(const char* event, std::initializer_list<LogField> fields = {}, std::string_view text = {}) { return log(Level::DEBUG, event, fields, text); }
+    bool info(const char* event, std::initializer_list<LogField> fields = {}, std::string_view text = {}) { return log(Level::INFO, event, fields, text); }
+    bool warn(const char* event, std::initializer_list<LogField> fields = {}, std::string_view text = {}) { return log(Level::WARN, event, fields, text); }
+    bool error(const char* event, std::initializer_list<LogField> fields = {}, std::string_view text = {}) { return log(Level::ERROR, event, fields, text); }
+
+    /**
+     * @brief Checks whether records of `level` pass the level filter.
+     */
+    bool isEnabled(Level level) const { return level >= minLevel.load(std::memory_order_relaxed); }
+
+    void setLevel(Level level) { minLevel.store(level, std::memory_order_relaxed); }
+    Level getLevel() const { return minLevel.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Sets the maximum number of non-error records accepted per second (0 = unlimited).
+     */
+    void setRateLimit(size_t recordsPerSecond) { rateLimit.store(recordsPerSecond, std::memory_order_relaxed); }
+
+    /**
+     * @brief Redirects output, nullptr writes to the console.
+     * @param output Stream that must outlive the logger or the next setSink call.
+     */
+    void setSink(std::ostream* output);
+
+    /**
+     * @brief Blocks until every record queued before the call has been written.
+     */
+    void flush();
+
+    uint64_t getDroppedCount() const { return droppedCount.load(std::memory_order_relaxed); }
+    uint64_t getSuppressedCount() const { return suppressedCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Parses a level name ("debug", "info", "warn", "error", "off").
+     * @return bool False (level untouched) if the name is unknown.
+     */
+    static bool parseLevel(const std::string& name, Level& level);
+
+    static const char* levelName(Level level);
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "SpscRing.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @class ChannelInputQueue
+ * @brief Pending bulk input of one media channel (image or audio), converted on submission and fed per step.
+ *
+ * @details Producers hand over whole frames or sample buffers; the samples are converted to channel
+ * messages (SampleCodec) straight into a lock-free ring, so the conversion runs on the producer's thread
+ * and never under the simulation lock. At the start of each step the run loop takes up to
+ * `samplesPerStep` messages and delivers them to the channel operator as one batch, which spreads a
+ * large frame over several steps instead of flooding a single one.
+ *
+ * A full queue accepts only what fits: the submit calls return the number of samples taken, so the
+ * producer sees the backpressure and resubmits the rest later.
+ *
+ * Thread-safety: the submit calls and setSamplesPerStep may be called from any thread (producers are
+ * serialized by an internal mutex the run loop never takes). `nextStep` and `clear` are called by the
+ * run loop only.
+ */
+class ChannelInputQueue {
+private:
+    SpscRing<int> pending;
+    std::mutex producerMutex;
+    std::atomic<size_t> samplesPerStep;
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 20;       // 4 MB of messages, allocated on first use
+    static constexpr size_t DEFAULT_SAMPLES_PER_STEP = 4096;
+
+    explicit ChannelInputQueue(size_t capacity = DEFAULT_CAPACITY, size_t perStep = DEFAULT_SAMPLES_PER_STEP);
+
+    /**
+     * @brief Queues 8-bit samples (e.g. image pixels).
+     * @return size_t Number of samples accepted, from the start of `bytes`.
+     */
+    size_t submitBytes(const uint8_t* bytes, size_t count);
+
+    /**
+     * @brief Queues signed 16-bit samples (e.g. PCM audio).
+     * @return size_t Number of samples accepted, from the start of `samples`.
+     */
+    size_t submitSamples16(const int16_t* samples, size_t count);
+
+    /**
+     * @brief Hands the next step's messages to `deliver`, called as deliver(const int* values, size_t count)
+     * once or twice (when the ring wraps).
+     * @return size_t Number of messages delivered, at most the samples-per-step rate.
+     */
+    template<typename Fn>
+    size_t nextStep(Fn&& deliver) {
+        return pending.consume(samplesPerStep.load(std::memory_order_relaxed), deliver);
+    }
+
+    /**
+     * @brief Sets how many samples are delivered per step (at least 1).
+     */
+    void setSamplesPerStep(size_t perStep);
+
+    size_t getSamplesPerStep() const { return samplesPerStep.load(std::memory_order_relaxed); }
+
+    // Messages waiting to be delivered (a snapshot)
+    size_t pendingCount() const { return pending.size(); }
+
+    bool empty() const { return pending.empty(); }
+
+    // Discards the pending messages (run loop side)
+    void clear() { pending.clear(); }
+
+    // Prevent copying/assignment
+    ChannelInputQueue(const ChannelInputQueue&) = delete;
+    ChannelInputQueue& operator=(const ChannelInputQueue&) = delete;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct IncomingEdge
+ * @brief One inbound connection of an operator: who points at it and at which distance.
+ */
+struct IncomingEdge {
+    uint32_t sourceId;
+    int distance;
+
+    bool operator==(const IncomingEdge& other) const {
+        return sourceId == other.sourceId && distance == other.distance;
+    }
+};
+
+/**
+ * @class ConnectionIndex
+ * @brief Reverse view of the network's output connections, target ID -> incoming edges.
+ * @details Optional, owned by MetaController. Operators attached to it report every connection
+ * they actually add or remove (see Operator::addConnectionInternal / removeConnectionInternal),
+ * so deleting an operator can remove the connections pointing at it in O(in-degree) instead of
+ * leaving dangling targets behind.
+ *
+ * The map is split into mutex-protected stripes by target ID, so operators updated concurrently
+ * by the parallel update phase only contend when they touch targets in the same stripe.
+ */
+class ConnectionIndex {
+private:
+    static constexpr size_t STRIPE_COUNT = 64;
+
+    struct Stripe {
+        mutable std::mutex mutex;
+        std::unordered_map<uint32_t, std::vector<IncomingEdge>> incoming;
+    };
+
+    std::array<Stripe, STRIPE_COUNT> stripes;
+
+    Stripe& stripeFor(uint32_t targetId) { return stripes[targetId % STRIPE_COUNT]; }
+    const Stripe& stripeFor(uint32_t targetId) const { return stripes[targetId % STRIPE_COUNT]; }
+
+public:
+    ConnectionIndex() = default;
+
+    /**
+     * @brief Records the connection source -> target at the given distance.
+     * @details Callers only report connections that were not present yet, so no duplicate check is done.
+     */
+    void addEdge(uint32_t sourceId, uint32_t targetId, int distance);
+
+    /**
+     * @brief Forgets the connection source -> target at the given distance, if recorded.
+     */
+    void removeEdge(uint32_t sourceId, uint32_t targetId, int distance);
+
+    /**
+     * @brief Copies the incoming edges of an operator.
+     * @param targetId The operator whose inbound connections are requested.
+     * @return std::vector<IncomingEdge> A snapshot, safe to iterate while the connections are removed.
+     */
+    std::vector<IncomingEdge> getIncoming(uint32_t targetId) const;
+
+    /**
+     * @brief Number of connections pointing at an operator.
+     */
+    size_t getInDegree(uint32_t targetId) const;
+
+    /**
+     * @brief Drops every incoming edge recorded for an operator.
+     */
+    void forgetTarget(uint32_t targetId);
+
+    /**
+     * @brief Total number of recorded connections.
+     */
+    size_t getEdgeCount() const;
+
+    /**
+     * @brief Removes every recorded edge.
+     */
+    void clear();
+
+    // Prevent copying/assignment
+    ConnectionIndex(const ConnectionIndex&) = delete;
+    ConnectionIndex& operator=(const ConnectionIndex&) = delete;
+};
@@ -19,6 +19,25 @@ public:
         return static_cast<int>(randombytes_uniform(range)) + min;
     }
 
+    void fillInt(int* out, size_t count, int min, int max) override {
+        // One randombytes_buf call for the batch instead of randombytes_uniform per value.
+        // Multiply-shift maps each word to the range, the rare biased words are redrawn with randombytes_uniform.
+        if (count == 0) return;
+        if (min > max) std::swap(min, max);
+        uint32_t range = static_cast<uint32_t>(max) - min + 1;
+        uint32_t* raw = reinterpret_cast<uint32_t*>(out);
+        randombytes_buf(raw, count * sizeof(uint32_t));
+        if (range == 0) return; // full 32-bit range, raw words are already uniform
+        uint32_t threshold = static_cast<uint32_t>(-range) % range;
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t product = static_cast<uint64_t>(raw[i]) * range;
+            uint32_t offset = static_cast<uint32_t>(product) < threshold
+                ? randombytes_uniform(range)
+                : static_cast<uint32_t>(product >> 32);
+            out[i] = static_cast<int>(static_cast<int64_t>(min) + offset);
+        }
+    }
+
     double getDouble(double min, double max) override {
         if (min > max) std::swap(min, max);
         // Generate 64 random bits and scale them to the range [0.0, 1.0)
@@ -30,4 +49,9 @@ public:
     float getFloat(float min, float max) override {
         return 0.0; // TODO temporary need actually implement
     }
+
+    // Not reproducible in the first place, so every child simply draws from libsodium too.
+    std::unique_ptr<RandomSource> split() override {
+        return std::make_unique<LibsodiumRandomSource>();
+    }
 };
\ No newline at end of file
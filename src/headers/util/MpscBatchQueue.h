@@ -0,0 +1,262 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @class MpscBatchQueue
+ * @brief Lock-free multi-producer, single-consumer queue that moves items in per-thread batches.
+ * @tparam T Item type. Must be default constructible and copy assignable (e.g. UpdateEvent).
+ * @tparam BATCH_SIZE Number of items a producer thread buffers locally before publishing.
+ *
+ * @details
+ * Producers (`push`) append to a batch owned by the calling thread, no atomics are touched until
+ * the batch is full. A full batch is published with a single CAS onto a shared stack. The consumer
+ * takes the whole stack with one exchange, restores FIFO order and walks the items (`drain`).
+ * Drained batches are handed back to producers through a recycle stack, so once the queue has
+ * warmed up neither side allocates.
+ *
+ * Ordering: items pushed by the same thread are consumed in push order. There is no ordering
+ * between different producer threads, same as with any concurrent submission.
+ *
+ * Threading contract:
+ * - `push` and `flushLocal` may be called from any number of threads concurrently.
+ * - `drain`, `forEach`, `clear`, `size` and `empty` are consumer operations, called from one thread at a time.
+ * - A producer thread other than the consumer must call `flushLocal` once it is done submitting
+ *   (e.g. at the end of a parallel phase), otherwise its partial batch is not visible to the consumer.
+ *   The consumer's own partial batch is flushed automatically by `drain`, `forEach`, `size` and `empty`.
+ * - A thread's unflushed batch must not outlive the queue it was filled for.
+ */
+template<typename T, size_t BATCH_SIZE = 64>
+class MpscBatchQueue {
+private:
+    struct Batch {
+        T items[BATCH_SIZE];
+        size_t count = 0;
+        Batch* next = nullptr;
+    };
+
+    /**
+     * @brief Per-thread producer state: the batch being filled and a cache of empty batches.
+     * @details A thread fills for one queue at a time. Pushing to another queue publishes the
+     * partial batch to its owner first.
+     */
+    struct LocalState {
+        const MpscBatchQueue* owner = nullptr;
+        Batch* current = nullptr;
+        Batch* spare = nullptr; // singly linked list of empty batches
+
+        ~LocalState() {
+            delete current;
+            while (spare) {
+                Batch* next = spare->next;
+                delete spare;
+                spare = next;
+            }
+        }
+    };
+
+    static inline thread_local LocalState local;
+
+    // Producer -> consumer: stack of published batches (newest first)
+    mutable std::atomic<Batch*> published{nullptr};
+    // Consumer -> producer: stack of empty batches available for reuse
+    mutable std::atomic<Batch*> recycled{nullptr};
+    // Items published but not yet consumed
+    mutable std::atomic<size_t> publishedCount{0};
+
+    // Consumer-owned FIFO of collected batches (only touched by the consumer thread)
+    mutable Batch* collectedHead = nullptr;
+    mutable Batch* collectedTail = nullptr;
+
+    static void pushStack(std::atomic<Batch*>& stack, Batch* batch) {
+        batch->next = stack.load(std::memory_order_relaxed);
+        while (!stack.compare_exchange_weak(batch->next, batch,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+            // batch->next updated with the current head, retry
+        }
+    }
+
+    /**
+     * @brief Gets an empty batch for the calling thread, reusing recycled batches when possible.
+     */
+    Batch* acquireBatch() const {
+        if (!local.spare) {
+            // take every recycled batch at once, exchange avoids the ABA problem of popping one
+            local.spare = recycled.exchange(nullptr, std::memory_order_acquire);
+        }
+        if (local.spare) {
+            Batch* batch = local.spare;
+            local.spare = batch->next;
+            batch->next = nullptr;
+            batch->count = 0;
+            return batch;
+        }
+        return new Batch();
+    }
+
+    /**
+     * @brief Publishes the calling thread's current batch (if any) to its owning queue.
+     */
+    static void publishLocal() {
+        if (local.current && local.current->count > 0 && local.owner) {
+            Batch* batch = local.current;
+            local.current = nullptr;
+            local.owner->publishedCount.fetch_add(batch->count, std::memory_order_relaxed);
+            pushStack(local.owner->published, batch);
+        }
+    }
+
+    /**
+     * @brief [Consumer] Moves every published batch into the consumer-owned FIFO.
+     * @details The published stack is newest-first, so it is reversed before being appended.
+     */
+    void collect() const {
+        if (local.owner == this) {
+            publishLocal(); // the consumer's own submissions
+        }
+        Batch* stack = published.exchange(nullptr, std::memory_order_acquire);
+        if (!stack) {
+            return;
+        }
+        Batch* reversed = nullptr;
+        Batch* tail = stack; // the newest batch ends up last
+        while (stack) {
+            Batch* next = stack->next;
+            stack->next = reversed;
+            reversed = stack;
+            stack = next;
+        }
+        if (collectedTail) {
+            collectedTail->next = reversed;
+        } else {
+            collectedHead = reversed;
+        }
+        collectedTail = tail;
+    }
+
+    void recycle(Batch* batch) const {
+        batch->count = 0;
+        pushStack(recycled, batch);
+    }
+
+public:
+    MpscBatchQueue() = default;
+
+    /**
+     * @brief Frees all batches still held by the queue.
+     * @details The calling thread's partial batch is discarded if it belongs to this queue.
+     */
+    ~MpscBatchQueue() {
+        if (local.owner == this) {
+            if (local.current) local.current->count = 0;
+            local.owner = nullptr;
+        }
+        auto freeList = [](Batch* batch) {
+            while (batch) {
+                Batch* next = batch->next;
+                delete batch;
+                batch = next;
+            }
+        };
+        freeList(published.exchange(nullptr));
+        freeList(recycled.exchange(nullptr));
+        freeList(collectedHead);
+    }
+
+    // Prevent copying/assignment
+    MpscBatchQueue(const MpscBatchQueue&) = delete;
+    MpscBatchQueue& operator=(const MpscBatchQueue&) = delete;
+
+    /**
+     * @brief [Producer] Appends an item to the calling thread's batch, publishing it when full.
+     * @param item The item to queue, copied into the batch.
+     */
+    void push(const T& item) {
+        if (local.owner != this) {
+            publishLocal(); // hand the partial batch of another queue to its owner
+            local.owner = this;
+        }
+        if (!local.current) {
+            local.current = acquireBatch();
+        }
+        local.current->items[local.current->count++] = item;
+        if (local.current->count == BATCH_SIZE) {
+            publishLocal();
+        }
+    }
+
+    /**
+     * @brief [Producer] Publishes the calling thread's partial batch so the consumer can see it.
+     */
+    void flushLocal() {
+        if (local.owner == this) {
+            publishLocal();
+        }
+    }
+
+    /**
+     * @brief [Consumer] Removes every visible item, calling `fn(item)` on each in FIFO order.
+     * @param fn Callable taking `const T&`. Items pushed by `fn` on this thread are picked up by the next drain.
+     * @return size_t The number of items consumed.
+     */
+    template<typename Fn>
+    size_t drain(Fn&& fn) {
+        collect();
+        Batch* batch = collectedHead;
+        collectedHead = nullptr;
+        collectedTail = nullptr;
+
+        size_t consumed = 0;
+        while (batch) {
+            Batch* next = batch->next;
+            for (size_t i = 0; i < batch->count; ++i) {
+                fn(batch->items[i]);
+            }
+            consumed += batch->count;
+            recycle(batch);
+            batch = next;
+        }
+        publishedCount.fetch_sub(consumed, std::memory_order_relaxed);
+        return consumed;
+    }
+
+    /**
+     * @brief [Consumer] Visits every visible item in FIFO order without removing it.
+     * @param fn Callable taking `const T&`.
+     */
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        collect();
+        for (Batch* batch = collectedHead; batch; batch = batch->next) {
+            for (size_t i = 0; i < batch->count; ++i) {
+                fn(batch->items[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief [Consumer] Discards every visible item.
+     */
+    void clear() {
+        drain([](const T&) {});
+    }
+
+    /**
+     * @brief [Consumer] Number of items visible to the consumer.
+     * @details Includes the calling thread's own partial batch, not other threads' unflushed batches.
+     */
+    size_t size() const {
+        size_t pendingLocal = (local.owner == this && local.current) ? local.current->count : 0;
+        return publishedCount.load(std::memory_order_relaxed) + pendingLocal;
+    }
+
+    /**
+     * @brief [Consumer] True if no item is visible to the consumer.
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+};
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "../operators/AddOperator.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct NetworkSpec
+ * @brief Shape of a synthetic network built by NetworkGenerator.
+ * @details The layout matches MetaController::randomizeNetwork: input channels 0-2, output channels 3-5,
+ * internal AddOperators from 6. Every operator (input channels and internal) connects into the
+ * output + internal ID range.
+ */
+struct NetworkSpec {
+    /**
+     * @enum DegreeModel
+     * @brief Distribution of the number of outgoing connections per operator.
+     */
+    enum class DegreeModel {
+        UNIFORM,     // out-degree uniform in [0, 2 * meanDegree]
+        POWER_LAW,   // Pareto out-degree (exponent powerLawExponent) scaled to meanDegree, uniform targets
+        SMALL_WORLD  // Watts-Strogatz ring: the next meanDegree operators, each edge rewired with rewireProbability
+    };
+
+    /**
+     * @enum DistanceModel
+     * @brief Distribution of the connection distances.
+     */
+    enum class DistanceModel {
+        UNIFORM,     // uniform in [0, maxDistance - 1]
+        GEOMETRIC    // geometric with mean meanDistance, capped at maxDistance - 1
+    };
+
+    uint32_t internalOperators = 0;
+    uint64_t seed = 1;
+
+    DegreeModel degreeModel = DegreeModel::UNIFORM;
+    double meanDegree = 8.0;
+    uint32_t maxDegree = AddOperator::MAX_CONNECTIONS;
+    double powerLawExponent = 2.5;   // POWER_LAW only, must be > 2 for a finite mean
+    double rewireProbability = 0.1;  // SMALL_WORLD only
+
+    DistanceModel distanceModel = DistanceModel::UNIFORM;
+    uint32_t maxDistance = 16;       // at most AddOperator::MAX_DISTANCE
+    double meanDistance = 4.0;       // GEOMETRIC only
+
+    uint32_t inputDegree = 8;        // connections of each input channel
+    size_t threads = 0;              // 0 = one per hardware thread, the output does not depend on it
+};
+
+/**
+ * @struct GeneratedNetworkInfo
+ * @brief Totals of a generated network.
+ */
+struct GeneratedNetworkInfo {
+    uint64_t operators = 0;    // all layers, channels included
+    uint64_t connections = 0;  // after removing duplicate (distance, target) pairs
+    uint64_t bytes = 0;        // size of the configuration file
+};
+
+/**
+ * @class NetworkGenerator
+ * @brief Builds seeded synthetic networks and writes them straight to the configuration file format.
+ *
+ * @details
+ * Each operator draws from its own Philox substream keyed by (seed, operator ID), so an operator's
+ * connections, weight and threshold depend only on the seed and its ID. Chunks of operators are therefore
+ * generated in parallel (WorkerPool) and the file is identical for every thread count.
+ *
+ * No Operator objects are built: each chunk is encoded into the layout produced by
+ * Layer::serializeToBytes / AddOperator::serializeToBytes and written in ID order, so memory stays
+ * bounded by the chunks in flight. The result loads with MetaController::loadConfiguration
+ * (`load-config`).
+ */
+class NetworkGenerator {
+public:
+    /**
+     * @struct Connection
+     * @brief One outgoing connection of a generated operator.
+     */
+    struct Connection {
+        uint16_t distance;
+        uint32_t target;
+
+        bool operator<(const Connection& other) const {
+            return distance != other.distance ? distance < other.distance : target < other.target;
+        }
+        bool operator==(const Connection& other) const {
+            return distance == other.distance && target == other.target;
+        }
+    };
+
+    static constexpr uint32_t INPUT_MIN_ID = 0;
+    static constexpr uint32_t OUTPUT_MIN_ID = 3;
+    static constexpr uint32_t INTERNAL_MIN_ID = 6;
+    static constexpr uint32_t CHANNEL_COUNT = 3;
+    static constexpr size_t CHUNK_SIZE = 16384; // operators per parallel task
+
+private:
+    NetworkSpec spec;
+    uint32_t connectionMinId;  // first output channel
+    uint32_t connectionMaxId;  // last internal operator (or last output channel when there are none)
+    double powerLawMinDegree;  // Pareto scale giving meanDegree
+
+    void encodeInternalOperator(uint32_t operatorId, std::vector<Connection>& scratch,
+                                std::vector<std::byte>& buffer, uint64_t& connections) const;
+
+public:
+    /**
+     * @brief Constructor, validates the spec.
+     * @param networkSpec The network to build.
+     * @throws std::invalid_argument If a parameter is out of range (see NetworkSpec).
+     */
+    explicit NetworkGenerator(const NetworkSpec& networkSpec);
+
+    /**
+     * @brief Draws the sorted, duplicate-free connections of an internal operator.
+     * @param operatorId ID in the internal range.
+     * @param out Replaced with the connections, ordered by (distance, target).
+     */
+    void generateConnections(uint32_t operatorId, std::vector<Connection>& out) const;
+
+    /**
+     * @brief Draws the connections of an input channel (0-2).
+     */
+    void generateChannelConnections(uint32_t channelId, std::vector<Connection>& out) const;
+
+    /**
+     * @brief Draws the weight and threshold of an internal operator, in AddOperator's limits.
+     * @return std::pair<int, int> (weight, threshold).
+     */
+    std::pair<int, int> generateParameters(uint32_t operatorId) const;
+
+    /**
+     * @brief Generates the network and writes it as a configuration file.
+     * @param filePath Destination, overwritten.
+     * @param info Optional totals of the written network.
+     * @return bool True on success, false on I/O error or if the internal layer exceeds the
+     * format's 4 GiB layer limit (reported on std::cerr).
+     */
+    bool writeConfiguration(const std::string& filePath, GeneratedNetworkInfo* info = nullptr) const;
+
+    const NetworkSpec& getSpec() const { return spec; }
+
+    /**
+     * @brief Parses a degree model name ("uniform", "power-law", "small-world").
+     * @return bool False (model untouched) if the name is unknown.
+     */
+    static bool parseDegreeModel(const std::string& name, NetworkSpec::DegreeModel& model);
+};
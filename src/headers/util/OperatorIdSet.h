@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class OperatorIdSet
+ * @brief Set of operator IDs that stops allocating once it has warmed up.
+ *
+ * @details Membership is a dense flag per ID, and the members are kept in insertion order in a vector.
+ * clear() only resets the flags of the current members and keeps both buffers. A set that is filled and
+ * cleared every step (TimeController::operatorsToProcess) therefore reaches a steady state without heap
+ * allocation, where std::unordered_set allocates a node per insert. Memory is one byte per ID up to the
+ * highest ID inserted, which suits the dense, sequential IDs of a network. Callers insert only IDs of
+ * existing operators; IDs read from files are checked against the network first (TimeController::loadState).
+ */
+class OperatorIdSet {
+private:
+    std::vector<uint8_t> flags;     // flags[id] != 0 if id is a member
+    std::vector<uint32_t> members;  // insertion order
+
+public:
+    using const_iterator = std::vector<uint32_t>::const_iterator;
+
+    /**
+     * @brief Adds an ID.
+     * @return bool True if the ID was not a member yet.
+     */
+    bool insert(uint32_t id) {
+        if (id >= flags.size()) {
+            // geometric growth, so IDs arriving in increasing order do not resize every time
+            flags.resize(std::max(static_cast<size_t>(id) + 1, flags.size() * 2), 0);
+        }
+        if (flags[id] != 0) {
+            return false;
+        }
+        flags[id] = 1;
+        members.push_back(id);
+        return true;
+    }
+
+    bool contains(uint32_t id) const { return id < flags.size() && flags[id] != 0; }
+
+    size_t size() const { return members.size(); }
+
+    bool empty() const { return members.empty(); }
+
+    /**
+     * @brief Removes every member, keeping the allocated capacity.
+     */
+    void clear() {
+        for (uint32_t id : members) {
+            flags[id] = 0;
+        }
+        members.clear();
+    }
+
+    /**
+     * @brief Reserves room for `count` members (the flags grow with the highest ID).
+     */
+    void reserve(size_t count) { members.reserve(count); }
+
+    const_iterator begin() const { return members.begin(); }
+    const_iterator end() const { return members.end(); }
+};
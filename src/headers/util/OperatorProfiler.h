@@ -0,0 +1,153 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// Forward Declarations
+class MetaController; // Walked (read-only) for the degree/distance histograms
+
+/**
+ * @struct OperatorCounters
+ * @brief Activity counters of one operator, 16 bytes per operator ID.
+ * @details Counters saturate at UINT32_MAX instead of wrapping.
+ */
+struct OperatorCounters {
+    uint32_t deliveries = 0; // messages received (TimeController::deliverAndFlagOperator)
+    uint32_t fires = 0;      // processData calls that emitted at least one payload
+    uint32_t emitted = 0;    // payloads emitted by processData
+    uint32_t traversals = 0; // traversal steps of payloads originating from the operator
+};
+
+/**
+ * @struct DegreeHistograms
+ * @brief Structural histograms of a network, bucketed by powers of two.
+ * @details Bucket 0 holds the value 0, bucket b > 0 holds values in [2^(b-1), 2^b - 1],
+ * see OperatorProfiler::bucketIndex / bucketLabel.
+ */
+struct DegreeHistograms {
+    std::vector<uint64_t> outDegree; // operators by number of outgoing connections
+    std::vector<uint64_t> inDegree;  // operators by number of incoming connections
+    std::vector<uint64_t> distance;  // connections by distance
+    uint64_t operatorCount = 0;
+    uint64_t connectionCount = 0;
+    uint64_t danglingConnections = 0; // connections whose target does not exist
+};
+
+/**
+ * @class OperatorProfiler
+ * @brief Optional per-operator activity counters and network structure report.
+ * @details Counters live in a dense array indexed by operator ID, so recording is an indexed
+ * increment. The TimeController records into it only while a profiler is attached
+ * (see TimeController::setOperatorProfiler), otherwise the hooks cost one null check.
+ * Not thread-safe, recording happens on the simulation thread.
+ */
+class OperatorProfiler {
+public:
+    /**
+     * @enum Metric
+     * @brief Counter used to rank operators in the top-K report.
+     */
+    enum class Metric {
+        DELIVERIES,
+        FIRES,
+        EMITTED,
+        TRAVERSALS
+    };
+
+private:
+    std::vector<OperatorCounters> counters; // index = operator ID
+
+    OperatorCounters& countersFor(uint32_t operatorId) {
+        if (operatorId >= counters.size()) {
+            counters.resize(static_cast<size_t>(operatorId) + 1);
+        }
+        return counters[operatorId];
+    }
+
+    static void bump(uint32_t& counter, uint32_t amount = 1) {
+        counter = (counter > UINT32_MAX - amount) ? UINT32_MAX : counter + amount;
+    }
+
+public:
+    OperatorProfiler() = default;
+
+    /**
+     * @brief Pre-sizes the counter array so recording never grows it.
+     * @param maxOperatorId The highest operator ID expected.
+     */
+    void reserve(uint32_t maxOperatorId);
+
+    /** @brief Counts a message delivered to `operatorId`. */
+    void recordDelivery(uint32_t operatorId) { bump(countersFor(operatorId).deliveries); }
+
+    /** @brief Counts `count` messages delivered to `operatorId` at once (bulk channel input). */
+    void recordDeliveries(uint32_t operatorId, size_t count) {
+        bump(countersFor(operatorId).deliveries, count > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(count));
+    }
+
+    /**
+     * @brief Counts one processData call of `operatorId`.
+     * @param emittedPayloads Payloads the call emitted, a call that emitted any counts as a fire.
+     */
+    void recordCheck(uint32_t operatorId, size_t emittedPayloads) {
+        if (emittedPayloads == 0) {
+            return;
+        }
+        OperatorCounters& entry = countersFor(operatorId);
+        bump(entry.fires);
+        bump(entry.emitted, emittedPayloads > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(emittedPayloads));
+    }
+
+    /** @brief Counts one traversal step of a payload owned by `operatorId`. */
+    void recordTraversal(uint32_t operatorId) { bump(countersFor(operatorId).traversals); }
+
+    /**
+     * @brief Gets the counters of one operator.
+     * @return OperatorCounters All zero if nothing was recorded for the ID.
+     */
+    OperatorCounters getCounters(uint32_t operatorId) const;
+
+    /**
+     * @brief Gets the K operators with the highest value of `metric`.
+     * @param k Maximum number of entries.
+     * @param metric Ranking counter, ties are ordered by ascending operator ID.
+     * @return Pairs of (operator ID, counters), operators with a zero metric are left out.
+     */
+    std::vector<std::pair<uint32_t, OperatorCounters>> topK(size_t k, Metric metric) const;
+
+    /**
+     * @brief Discards every counter.
+     */
+    void clear();
+
+    /**
+     * @brief Builds the out-degree, in-degree and distance histograms from the operators' outputConnections.
+     * @param metaController The network to inspect.
+     * @return DegreeHistograms The bucketed histograms.
+     */
+    static DegreeHistograms buildDegreeHistograms(const MetaController& metaController);
+
+    /**
+     * @brief Formats the top-K table and the structural histograms as text.
+     * @param metaController The network the counters were recorded on.
+     * @param k Number of operators in the top-K table.
+     * @param metric Ranking counter of the table.
+     * @return std::string The report.
+     */
+    std::string buildReport(const MetaController& metaController, size_t k, Metric metric) const;
+
+    /** @brief Power-of-two bucket of a value (0 -> 0, 1 -> 1, 2..3 -> 2, 4..7 -> 3, ...). */
+    static size_t bucketIndex(uint64_t value);
+
+    /** @brief Printable range of a bucket, e.g. "4-7". */
+    static std::string bucketLabel(size_t bucket);
+
+    /**
+     * @brief Parses a metric name ("deliveries", "fires", "emitted", "traversals").
+     * @return bool False (metric untouched) if the name is unknown.
+     */
+    static bool parseMetric(const std::string& name, Metric& metric);
+};
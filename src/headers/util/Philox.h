@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class Philox
+ * @brief Counter-based random number generator (Philox4x32-10, Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3").
+ *
+ * @details
+ * Output block n of stream s is a pure function of (seed, s, n): the seed is the 64-bit key and the
+ * 128-bit counter holds the block index (low half) and the stream ID (high half). Consequently
+ * - any number of independent substreams (per thread, per chunk, per operator) can be derived from
+ *   one seed without locking or shared state, see substream();
+ * - a stream can jump to any position in O(1), see seek();
+ * - bulk fill() produces whole blocks of four values without per-value overhead.
+ *
+ * Integer ranges are drawn without modulo bias (multiply-shift with rejection). Not thread-safe:
+ * use one instance (or substream) per thread.
+ */
+class Philox {
+public:
+    using Block = std::array<uint32_t, 4>;
+    static constexpr uint64_t DEFAULT_SEED = 0x5DEECE66DULL;
+
+private:
+    uint64_t seed;
+    uint64_t stream;
+    uint64_t blockIndex = 0;  // next block to generate
+    Block buffer{};           // current block
+    unsigned bufferPos = 4;   // next unread word of buffer, 4 = empty
+
+    Block nextBlock() { return generateBlock(seed, stream, blockIndex++); }
+
+    static void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        uint64_t product = static_cast<uint64_t>(a) * b;
+        hi = static_cast<uint32_t>(product >> 32);
+        lo = static_cast<uint32_t>(product);
+    }
+
+    /**
+     * @brief Maps a 32-bit draw into [0, bound) by multiply-shift, redrawing the rare biased values.
+     */
+    uint32_t reduce(uint32_t value, uint32_t bound) {
+        uint64_t product = static_cast<uint64_t>(value) * bound;
+        uint32_t low = static_cast<uint32_t>(product);
+        if (low < bound) {
+            uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                product = static_cast<uint64_t>(nextUint32()) * bound;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<uint32_t>(product >> 32);
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     * @param seedValue 64-bit key shared by all substreams.
+     * @param streamId Stream within the seed (e.g. a thread, chunk or operator ID).
+     */
+    explicit Philox(uint64_t seedValue = DEFAULT_SEED, uint64_t streamId = 0) : seed(seedValue), stream(streamId) {}
+
+    /**
+     * @brief Computes one output block, the pure function behind every draw.
+     * @param key The seed.
+     * @param streamId High half of the counter.
+     * @param index Low half of the counter (block position in the stream).
+     * @return Block Four uniformly distributed 32-bit words.
+     */
+    static Block generateBlock(uint64_t key, uint64_t streamId, uint64_t index) {
+        uint32_t c0 = static_cast<uint32_t>(index), c1 = static_cast<uint32_t>(index >> 32);
+        uint32_t c2 = static_cast<uint32_t>(streamId), c3 = static_cast<uint32_t>(streamId >> 32);
+        uint32_t k0 = static_cast<uint32_t>(key), k1 = static_cast<uint32_t>(key >> 32);
+        for (int round = 0; round < 10; ++round) {
+            uint32_t hi0, lo0, hi1, lo1;
+            mulhilo(0xD2511F53u, c0, hi0, lo0);
+            mulhilo(0xCD9E8D57u, c2, hi1, lo1);
+            uint32_t n0 = hi1 ^ c1 ^ k0;
+            uint32_t n2 = hi0 ^ c3 ^ k1;
+            c0 = n0; c1 = lo1; c2 = n2; c3 = lo0;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        return {c0, c1, c2, c3};
+    }
+
+    /**
+     * @brief Derives an independent stream of the same seed, starting at its first block.
+     */
+    Philox substream(uint64_t streamId) const { return Philox(seed, streamId); }
+
+    /**
+     * @brief Moves to the start of block `index` of this stream (each block is four 32-bit values).
+     */
+    void seek(uint64_t index) {
+        blockIndex = index;
+        bufferPos = 4;
+    }
+
+    uint64_t getSeed() const { return seed; }
+    uint64_t getStream() const { return stream; }
+
+    uint32_t nextUint32() {
+        if (bufferPos == 4) {
+            buffer = nextBlock();
+            bufferPos = 0;
+        }
+        return buffer[bufferPos++];
+    }
+
+    uint64_t nextUint64() {
+        uint64_t high = nextUint32();
+        return (high << 32) | nextUint32();
+    }
+
+    /**
+     * @brief Uniform integer in [0, bound), bound > 0.
+     */
+    uint32_t below(uint32_t bound) { return reduce(nextUint32(), bound); }
+
+    /**
+     * @brief Uniform integer in [min, max] (inclusive, swapped if min > max).
+     */
+    int getInt(int min, int max);
+
+    /**
+     * @brief Uniform double in [min, max), 53 random bits.
+     */
+    double getDouble(double min, double max);
+
+    /**
+     * @brief Uniform float in [min, max), 24 random bits.
+     */
+    float getFloat(float min, float max);
+
+    /**
+     * @brief Fills `out` with `count` raw 32-bit values. Produces the same values as `count` nextUint32 calls.
+     */
+    void fill(uint32_t* out, size_t count);
+
+    /**
+     * @brief Fills `out` with `count` uniform integers in [min, max] (inclusive, swapped if min > max).
+     */
+    void fillInt(int* out, size_t count, int min, int max);
+
+    /**
+     * @brief Fills `out` with `count` uniform doubles in [min, max).
+     */
+    void fillDouble(double* out, size_t count, double min, double max);
+};
@@ -0,0 +1,41 @@
+#pragma once
+#include "RandomSource.h"
+#include "Philox.h"
+
+/**
+ * @class PhiloxRandomSource
+ * @brief RandomSource backed by the counter-based Philox generator.
+ * @details Seedable and reproducible like PseudoRandomSource, with a native bulk fillInt, and
+ * independent per-thread or per-chunk substreams of the same seed (see Philox::substream).
+ */
+class PhiloxRandomSource : public RandomSource {
+private:
+    Philox engine;
+
+public:
+    /**
+     * @param seed Key of the generator.
+     * @param stream Stream within the seed.
+     */
+    explicit PhiloxRandomSource(uint64_t seed = Philox::DEFAULT_SEED, uint64_t stream = 0) : engine(seed, stream) {}
+
+    int getInt(int min, int max) override { return engine.getInt(min, max); }
+
+    double getDouble(double min, double max) override { return engine.getDouble(min, max); }
+
+    float getFloat(float min, float max) override { return engine.getFloat(min, max); }
+
+    void fillInt(int* out, size_t count, int min, int max) override { engine.fillInt(out, count, min, max); }
+
+    /**
+     * @brief Child keyed by the next 64-bit draw of this stream, so repeated splits never share a key.
+     */
+    std::unique_ptr<RandomSource> split() override {
+        return std::make_unique<PhiloxRandomSource>(engine.nextUint64(), engine.getStream());
+    }
+
+    /**
+     * @brief Direct access to the engine, for callers that derive substreams.
+     */
+    Philox& getEngine() { return engine; }
+};
@@ -39,6 +39,21 @@ public:
         return dist(pseudoRandomEngine);
     }
 
+    void fillInt(int* out, size_t count, int min, int max) override {
+        if (min > max) std::swap(min, max);
+        std::uniform_int_distribution<int> dist(min, max); // one distribution for the whole batch
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = dist(pseudoRandomEngine);
+        }
+    }
+
+    /**
+     * @brief Child engine seeded with the next draw of this engine.
+     */
+    std::unique_ptr<RandomSource> split() override {
+        return std::make_unique<PseudoRandomSource>(static_cast<unsigned int>(pseudoRandomEngine()));
+    }
+
     double getDouble(double min, double max) override {
         if (min > max) std::swap(min, max);
         std::uniform_real_distribution<double> dist(min, max);
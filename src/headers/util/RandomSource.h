@@ -1,7 +1,9 @@
 // In headers/util/RandomSource.h
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 
 /**
  * @class RandomSource
@@ -15,4 +17,22 @@ public:
     virtual int getInt(int min, int max) = 0;
     virtual double getDouble(double min, double max) = 0;
     virtual float getFloat(float min, float max) = 0;
+
+    /**
+     * @brief Fills `out` with `count` integers in [min, max] (inclusive).
+     * @details Default draws one getInt per value, sources with a cheaper batch path override it.
+     */
+    virtual void fillInt(int* out, size_t count, int min, int max) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = getInt(min, max);
+        }
+    }
+
+    /**
+     * @brief Derives an independent child source, advancing this one by a fixed number of draws.
+     * @details Children split in the same order from the same seed produce the same sequences, which
+     * lets work be divided into chunks that each own a stream (see InternalLayer::randomInit).
+     * @return std::unique_ptr<RandomSource> The child, or nullptr if the source cannot be split.
+     */
+    virtual std::unique_ptr<RandomSource> split() { return nullptr; }
 };
\ No newline at end of file
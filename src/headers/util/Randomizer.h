@@ -45,4 +45,23 @@ public:
     // uint32_t getSecureRandomUint32(); // Might use std::random_device directly or wrap a CSPRNG library
 
     virtual float getFloat(float min, float max);
+
+    /**
+     * @brief Fills `out` with `count` random integers in [min, max] (inclusive).
+     * @details One virtual call per batch instead of per value, the source generates the batch
+     * natively when it can (PhiloxRandomSource, PseudoRandomSource, LibsodiumRandomSource).
+     * @param out Destination of at least `count` ints.
+     * @param count Number of values.
+     * @param min The minimum value of the range.
+     * @param max The maximum value of the range.
+     */
+    virtual void fillInt(int* out, size_t count, int min, int max);
+
+    /**
+     * @brief Derives an independent child randomizer from the source (see RandomSource::split).
+     * @details Must be called from one thread, in a fixed order, for the children to be reproducible.
+     * @return std::unique_ptr<Randomizer> The child, or nullptr if there is no splittable source
+     * (e.g. mocks), in which case callers draw from this randomizer sequentially.
+     */
+    virtual std::unique_ptr<Randomizer> split();
 };
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Conversions between media samples and the integer messages of the image and audio channels.
+ *
+ * @details A sample is placed in the most significant value bits of the message: an 8-bit pixel
+ * becomes `v << 23`, a 16-bit audio sample `s * 65536`. Reading output applies the inverse, taking
+ * the top bits of the magnitude for bytes (the same scaling OutOperator::getDataAsString uses for text)
+ * and the top 16 bits for audio, so a sample that travels through unchanged comes back unchanged.
+ *
+ * Every function is a straight loop over arrays without branches in the body, which the compiler
+ * turns into SIMD code at -O3 (the Release build): with SSE2, messagesToBytes converts 16 values
+ * per iteration and packs them into one 16-byte store.
+ */
+namespace SampleCodec {
+    // Shift that moves a byte into the top 8 value bits of an int
+    constexpr int BYTE_SHIFT = std::numeric_limits<int>::digits - 8;
+    // Shift that moves a 16-bit sample into the top 16 bits of an int
+    constexpr int SAMPLE16_SHIFT = 16;
+
+    void bytesToMessages(const uint8_t* bytes, size_t count, int* messages);
+
+    void samples16ToMessages(const int16_t* samples, size_t count, int* messages);
+
+    void messagesToBytes(const int* messages, size_t count, uint8_t* bytes);
+
+    void messagesToSamples16(const int* messages, size_t count, int16_t* samples);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @class SeqLock
+ * @brief Single-writer sequence lock publishing a small trivially copyable value to any number of readers.
+ * @tparam T The published value, trivially copyable (e.g. SimulationStatus).
+ *
+ * @details The writer bumps the sequence to odd, writes the value and bumps it to even again; it never
+ * waits. A reader copies the value between two reads of the sequence and retries if a write overlapped
+ * (odd or changed sequence), so a reader never blocks the writer and never sees a torn value. The value
+ * is stored as atomic 64-bit words, which keeps the concurrent copy free of data races.
+ *
+ * Threading contract: `store` is called by one writer at a time (callers serialize writers with their
+ * own lock), `load` and `getVersion` from any thread.
+ */
+template<typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock values are copied word by word");
+
+private:
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    alignas(64) std::atomic<uint64_t> sequence{0}; // odd while a write is in progress
+    std::atomic<uint64_t> words[WORDS];
+
+public:
+    SeqLock() {
+        store(T{});
+    }
+
+    /**
+     * @brief Publishes a new value (writer).
+     */
+    void store(const T& value) {
+        uint64_t buffer[WORDS] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+        uint64_t current = sequence.load(std::memory_order_relaxed);
+        sequence.store(current + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release); // the odd sequence is visible before any word
+        for (size_t i = 0; i < WORDS; ++i) {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        sequence.store(current + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Reads the latest completely published value (reader).
+     * @details Retries while a write overlaps the copy, yielding so a preempted writer can finish.
+     */
+    T load() const {
+        uint64_t buffer[WORDS];
+        for (;;) {
+            uint64_t before = sequence.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                for (size_t i = 0; i < WORDS; ++i) {
+                    buffer[i] = words[i].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire); // the words are read before the check
+                if (sequence.load(std::memory_order_relaxed) == before) {
+                    break;
+                }
+            }
+            std::this_thread::yield();
+        }
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Number of values published so far, including the initial one.
+     */
+    uint64_t getVersion() const {
+        return sequence.load(std::memory_order_acquire) / 2;
+    }
+
+    // Prevent copying/assignment
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+};
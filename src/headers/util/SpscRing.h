@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @class SpscRing
+ * @brief Bounded, lock-free single-producer, single-consumer ring buffer.
+ * @tparam T Item type, trivially copyable (e.g. int output values).
+ *
+ * @details The producer (`push`) and the consumer (`consume`, `peek`, `clear`) each own one position
+ * counter; they only exchange an acquire/release pair per call, so neither side ever waits for the
+ * other. A full ring rejects the new item (`push` returns false) instead of blocking the producer.
+ *
+ * The consumer reads items in place: `consume` and `peek` hand out at most two contiguous spans
+ * (`fn(const T* data, size_t count)`, the second when the range wraps), so batches are read without
+ * copying. The slot array is allocated on the first push, a ring that never receives an item costs
+ * nothing. It starts at `initialItems` slots and the producer doubles it whenever it fills up, until
+ * it holds `maxItems` (rounded up to a power of two). Growing copies the unread items into the new
+ * array and publishes it before any item written there; the replaced arrays stay allocated until the
+ * ring is destroyed, because the consumer may still be reading from one (they add up to less than the
+ * current array).
+ *
+ * Threading contract:
+ * - `push` and `produce` are called by one producer thread at a time.
+ * - `consume`, `peek` and `clear` are called by one consumer thread at a time (callers with several
+ *   readers serialize them with their own lock, the producer never takes it).
+ * - `size` and `empty` may be called from any thread, the value is a snapshot.
+ */
+template<typename T>
+class SpscRing {
+private:
+    struct Buffer {
+        std::unique_ptr<T[]> slots;
+        size_t slotCount;
+        size_t mask;
+    };
+
+    std::vector<std::unique_ptr<Buffer>> buffers; // producer-owned, the last one is current
+    std::atomic<const Buffer*> current{nullptr};  // published by the producer before the items written to it
+    Buffer* writable = nullptr;                   // producer's view of current
+    size_t usable = 0;                            // items the current array may hold, min(capacity, slotCount)
+    size_t capacity;
+    size_t initialSlotCount;
+    size_t maxSlotCount;
+
+    alignas(64) std::atomic<uint64_t> head{0}; // next item to read, advanced by the consumer
+    alignas(64) std::atomic<uint64_t> tail{0}; // next slot to write, advanced by the producer
+    uint64_t cachedHead = 0;                   // producer's last view of head, avoids reading it per push
+
+    static size_t roundUpPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Producer: replaces the slot array by one holding at least `needed` items, copying the unread
+    // items [cachedHead, position). False if `needed` exceeds the capacity.
+    bool grow(uint64_t position, size_t needed) {
+        if (needed > capacity) {
+            return false;
+        }
+        size_t slotCount = writable ? writable->slotCount * 2 : initialSlotCount;
+        while (slotCount < needed) {
+            slotCount <<= 1;
+        }
+        slotCount = std::min(slotCount, maxSlotCount);
+
+        std::unique_ptr<Buffer> buffer(new Buffer{std::unique_ptr<T[]>(new T[slotCount]), slotCount, slotCount - 1});
+        if (writable) {
+            for (uint64_t i = cachedHead; i < position; ++i) {
+                buffer->slots[static_cast<size_t>(i) & buffer->mask] = writable->slots[static_cast<size_t>(i) & writable->mask];
+            }
+        }
+        writable = buffer.get();
+        usable = std::min(capacity, slotCount);
+        buffers.push_back(std::move(buffer));
+        current.store(writable, std::memory_order_release);
+        return true;
+    }
+
+    // Hands the `count` items starting at position `from` to fn, as one or two contiguous spans.
+    // Called after reading tail, so the array loaded here holds every item before it.
+    template<typename Fn>
+    void visit(uint64_t from, size_t count, Fn& fn) const {
+        const Buffer* buffer = current.load(std::memory_order_acquire);
+        size_t start = static_cast<size_t>(from) & buffer->mask;
+        size_t first = std::min(count, buffer->slotCount - start);
+        fn(static_cast<const T*>(buffer->slots.get() + start), first);
+        if (count > first) {
+            fn(static_cast<const T*>(buffer->slots.get()), count - first);
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor for SpscRing.
+     * @param maxItems Most items the ring holds, further pushes are rejected until the consumer reads.
+     * @param initialItems Size of the slot array allocated on the first push, grown up to `maxItems`
+     * as needed. Defaults to `maxItems`, a ring that never grows.
+     */
+    explicit SpscRing(size_t maxItems, size_t initialItems = SIZE_MAX) :
+        capacity(std::max<size_t>(maxItems, 1)),
+        initialSlotCount(roundUpPowerOfTwo(std::min(std::max<size_t>(initialItems, 1), capacity))),
+        maxSlotCount(roundUpPowerOfTwo(capacity))
+    {
+    }
+
+    /**
+     * @brief Appends an item (producer).
+     * @return bool False if the ring is full, the item is not stored.
+     */
+    bool push(const T& item) {
+        uint64_t position = tail.load(std::memory_order_relaxed);
+        if (position - cachedHead >= usable) {
+            cachedHead = head.load(std::memory_order_acquire);
+            size_t used = static_cast<size_t>(position - cachedHead);
+            if (used >= usable && !grow(position, used + 1)) {
+                return false;
+            }
+        }
+        writable->slots[static_cast<size_t>(position) & writable->mask] = item;
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Appends up to `maxItems` items written in place (producer).
+     * @param fill Called as fill(T* slots, size_t count) for one or two contiguous spans, in order; it
+     * must write all `count` items of each span.
+     * @return size_t Number of items appended, less than `maxItems` if the ring filled up.
+     */
+    template<typename Fn>
+    size_t produce(size_t maxItems, Fn&& fill) {
+        uint64_t position = tail.load(std::memory_order_relaxed);
+        size_t used = static_cast<size_t>(position - cachedHead);
+        if (usable - used < maxItems) {
+            cachedHead = head.load(std::memory_order_acquire);
+            used = static_cast<size_t>(position - cachedHead);
+            size_t wanted = std::min(maxItems, capacity - used);
+            if (used + wanted > usable) {
+                grow(position, used + wanted);
+            }
+        }
+        size_t count = std::min(maxItems, usable - used);
+        if (count == 0) {
+            return 0;
+        }
+        size_t start = static_cast<size_t>(position) & writable->mask;
+        size_t first = std::min(count, writable->slotCount - start);
+        fill(writable->slots.get() + start, first);
+        if (count > first) {
+            fill(writable->slots.get(), count - first);
+        }
+        tail.store(position + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Reads and removes up to `maxItems` of the oldest items (consumer).
+     * @param fn Called as fn(const T* data, size_t count) for one or two spans, oldest first. The
+     * spans are valid only during the call.
+     * @return size_t Number of items consumed.
+     */
+    template<typename Fn>
+    size_t consume(size_t maxItems, Fn&& fn) {
+        uint64_t from = head.load(std::memory_order_relaxed);
+        size_t count = static_cast<size_t>(std::min<uint64_t>(maxItems, tail.load(std::memory_order_acquire) - from));
+        if (count == 0) {
+            return 0;
+        }
+        visit(from, count, fn);
+        head.store(from + count, std::memory_order_release); // the slots may be overwritten from here on
+        return count;
+    }
+
+    /**
+     * @brief Reads up to `maxItems` of the oldest items without removing them (consumer).
+     * @return size_t Number of items visited.
+     */
+    template<typename Fn>
+    size_t peek(size_t maxItems, Fn&& fn) const {
+        uint64_t from = head.load(std::memory_order_relaxed);
+        size_t count = static_cast<size_t>(std::min<uint64_t>(maxItems, tail.load(std::memory_order_acquire) - from));
+        if (count > 0) {
+            visit(from, count, fn);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Discards every item published so far (consumer).
+     */
+    void clear() {
+        head.store(tail.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    size_t size() const {
+        uint64_t from = head.load(std::memory_order_acquire);
+        return static_cast<size_t>(tail.load(std::memory_order_acquire) - from);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    size_t getCapacity() const { return capacity; }
+
+    // Slots currently allocated, 0 before the first push
+    size_t getAllocatedSlots() const {
+        const Buffer* buffer = current.load(std::memory_order_acquire);
+        return buffer ? buffer->slotCount : 0;
+    }
+
+    // Prevent copying/assignment
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+};
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <iosfwd>
+
+/**
+ * @struct StepSample
+ * @brief Instrumentation of a single simulation step, split by phase.
+ * @details Times are wall clock nanoseconds. TimeController fills the traversal and operator
+ * check phases and the payload/operator counters, Simulator adds the update and advance phases.
+ */
+struct StepSample {
+    // --- Phase wall times (ns) ---
+    uint64_t traversalNs = 0;       // processPayloadTraversal, includes message delivery
+    uint64_t operatorChecksNs = 0;  // processOperatorChecks, includes payload emission
+    uint64_t updatesNs = 0;         // UpdateController::ProcessUpdates
+    uint64_t advanceNs = 0;         // TimeController::advanceStep
+
+    // --- Counters ---
+    uint64_t messagesDelivered = 0;   // messages that reached an existing operator
+    uint64_t payloadsCreated = 0;     // payloads emitted into the next step during the step
+    uint64_t payloadsDeactivated = 0; // payloads removed after traversal
+    uint64_t operatorsFired = 0;      // flagged operators whose processData emitted a payload
+    uint64_t updatesApplied = 0;      // update events applied after coalescing
+
+    uint64_t totalNs() const { return traversalNs + operatorChecksNs + updatesNs + advanceNs; }
+};
+
+/**
+ * @struct MetricSummary
+ * @brief Rolling statistics of one metric over the sample window.
+ */
+struct MetricSummary {
+    double last = 0.0;
+    double mean = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+};
+
+/**
+ * @struct StepStatsSummary
+ * @brief Snapshot of the per-phase step statistics, times in microseconds.
+ * @details Produced by StepStats::summarize and carried by SimulationStatus to the CLI.
+ */
+struct StepStatsSummary {
+    size_t windowSteps = 0;  // steps the rolling statistics are computed over
+    uint64_t totalSteps = 0; // steps recorded since the last reset
+
+    MetricSummary traversalUs;
+    MetricSummary operatorChecksUs;
+    MetricSummary updatesUs;
+    MetricSummary advanceUs;
+    MetricSummary stepUs;
+
+    MetricSummary messagesDelivered;
+    MetricSummary payloadsCreated;
+    MetricSummary payloadsDeactivated;
+    MetricSummary operatorsFired;
+    MetricSummary updatesApplied;
+
+    /**
+     * @brief Name of the phase with the highest mean time over the window.
+     * @return std::string "traversal", "operator-checks", "updates", "advance", or "none" when empty.
+     */
+    std::string dominantPhase() const;
+
+    /**
+     * @brief Prints the summary as a table (last, mean and percentiles per metric).
+     */
+    void print() const;
+
+    /**
+     * @brief Prints the summary table to the given stream.
+     */
+    void print(std::ostream& out) const;
+};
+
+/**
+ * @class StepStats
+ * @brief Fixed-size rolling window of StepSamples.
+ * @details `record` is O(1) and never allocates once the window is full, so it can run on every
+ * step. Averages and percentiles are only computed on demand by `summarize`.
+ * Not thread-safe, the Simulator guards it with its simulation mutex.
+ */
+class StepStats {
+private:
+    std::vector<StepSample> window; // ring buffer, oldest sample at `next` once full
+    size_t capacity;
+    size_t next = 0;
+    uint64_t totalSteps = 0;
+
+    /**
+     * @brief Summarizes one metric, `field` extracts it (already scaled) from a sample.
+     */
+    template<typename Extract>
+    MetricSummary summarizeMetric(Extract field, std::vector<double>& scratch) const;
+
+public:
+    static constexpr size_t DEFAULT_WINDOW_SIZE = 256;
+
+    /**
+     * @brief Constructor for StepStats.
+     * @param windowSize Number of most recent steps kept for the rolling statistics (minimum 1).
+     */
+    explicit StepStats(size_t windowSize = DEFAULT_WINDOW_SIZE);
+
+    /**
+     * @brief Adds the sample of a completed step, replacing the oldest one when the window is full.
+     * @param sample The step's instrumentation.
+     */
+    void record(const StepSample& sample);
+
+    /**
+     * @brief Computes the rolling averages and percentiles of every metric.
+     * @return StepStatsSummary The summary, all zero if no step was recorded.
+     */
+    StepStatsSummary summarize() const;
+
+    /**
+     * @brief Gets the most recently recorded sample.
+     * @return StepSample The last sample, or an empty one if nothing was recorded.
+     */
+    StepSample getLastSample() const;
+
+    /**
+     * @brief Discards every sample and resets the step total.
+     */
+    void clear();
+
+    size_t getWindowSize() const { return capacity; }
+    size_t getSampleCount() const { return window.size(); }
+    uint64_t getTotalSteps() const { return totalSteps; }
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct TextStreamOptions
+ * @brief Rate, buffering and backpressure settings of a TextInputStream.
+ */
+struct TextStreamOptions {
+    size_t charsPerStep = 64;            // characters handed to the text channel per step, at most
+    size_t bufferCapacity = 64 * 1024;   // ring buffer size in bytes, the most the stream holds in memory
+    size_t maxInFlightPayloads = 100000; // no input while the network carries this many payloads, 0 = no limit
+};
+
+/**
+ * @struct TextStreamStats
+ * @brief Counters of a TextInputStream, for status output.
+ */
+struct TextStreamStats {
+    uint64_t charsRead = 0;      // bytes read from the source into the ring
+    uint64_t charsFed = 0;       // characters handed to the network
+    uint64_t throttledSteps = 0; // steps that fed nothing because of backpressure
+    size_t buffered = 0;         // characters read but not fed yet
+    bool sourceExhausted = false; // end of file, or the pipe's writer closed it
+};
+
+/**
+ * @class TextInputStream
+ * @brief Feeds text from a file or pipe to the network at a bounded rate per step.
+ *
+ * @details Submitting a whole corpus with Simulator::submitText delivers every character to the
+ * text channel in one step, so InOperator buffers all of it and emits one payload per character the
+ * step after. A stream instead hands at most `charsPerStep` characters to the network each step
+ * (Simulator calls `nextStep` before the step's traversal).
+ *
+ * The source is read without blocking into a fixed ring buffer, only when the ring holds less than
+ * a step's worth of characters, and only as much as fits. Memory therefore stays at `bufferCapacity`
+ * whatever the size of the source, and a pipe writer is held back by the pipe itself once the ring
+ * is full. Backpressure: while the network has `maxInFlightPayloads` or more payloads in flight,
+ * `nextStep` feeds nothing (counted in `throttledSteps`) and reads nothing.
+ *
+ * Reading uses POSIX file descriptors (non-blocking reads), the stream is driven by the simulation
+ * thread only and is not thread-safe on its own.
+ */
+class TextInputStream {
+private:
+    int fd = -1;
+    bool ownsFd = true;
+    TextStreamOptions options;
+
+    std::vector<char> ring; // fixed size bufferCapacity
+    size_t head = 0;        // index of the oldest buffered character
+    size_t count = 0;       // buffered characters
+
+    TextStreamStats stats;
+
+    /**
+     * @brief Reads whatever the source has available into the free space of the ring, without blocking.
+     */
+    void refill();
+
+public:
+    /**
+     * @brief Creates a stream reading from an open file descriptor.
+     * @param fileDescriptor Source, switched to non-blocking reads.
+     * @param streamOptions Rate, buffering and backpressure settings.
+     * @param takeOwnership True to close the descriptor in the destructor.
+     * @throws std::invalid_argument If charsPerStep is 0 or larger than bufferCapacity, or fd is negative.
+     */
+    TextInputStream(int fileDescriptor, const TextStreamOptions& streamOptions, bool takeOwnership = true);
+
+    /**
+     * @brief Opens a file or named pipe as a stream.
+     * @param path File to read. Opening a named pipe waits for its writer, like `cat` does.
+     * @param streamOptions Rate, buffering and backpressure settings.
+     * @return std::unique_ptr<TextInputStream> The stream, or nullptr (with a message on std::cerr) if the path cannot be opened.
+     * @throws std::invalid_argument If the options are invalid.
+     */
+    static std::unique_ptr<TextInputStream> open(const std::string& path, const TextStreamOptions& streamOptions);
+
+    ~TextInputStream();
+
+    /**
+     * @brief Takes the characters to feed in the coming step.
+     * @param inFlightPayloads Payloads currently in the network (current + next step).
+     * @param out Replaced with up to charsPerStep characters, empty when throttled or nothing is buffered.
+     * Its capacity is reused between calls.
+     * @return size_t Number of characters placed in `out`.
+     */
+    size_t nextStep(size_t inFlightPayloads, std::string& out);
+
+    /**
+     * @brief Checks whether everything the source will ever provide has been fed.
+     */
+    bool isDrained() const { return stats.sourceExhausted && count == 0; }
+
+    const TextStreamOptions& getOptions() const { return options; }
+
+    TextStreamStats getStats() const;
+
+    // Prevent copying/assignment
+    TextInputStream(const TextInputStream&) = delete;
+    TextInputStream& operator=(const TextInputStream&) = delete;
+};
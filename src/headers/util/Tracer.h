@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @file Tracer.h
+ * @brief Scoped tracing of the simulation phases, written as Chrome trace-event JSON.
+ *
+ * @details
+ * Hooks are placed with `ATHENA_TRACE_SCOPE("name")`. They exist only when the library is built
+ * with `ATHENA_ENABLE_TRACING` (CMake option of the same name, ON by default). With the option OFF
+ * the macro expands to nothing, so the hooks cost nothing.
+ *
+ * When compiled in, recording is still switched at runtime (`Tracer::start` / `Tracer::stop`,
+ * CLI `trace start` / `trace stop <path>`), so production runs can be profiled without rebuilding.
+ * While stopped, a hook costs one relaxed atomic load.
+ *
+ * Events go into a fixed-size ring buffer owned by the recording thread. Recording takes no lock,
+ * and when the ring is full the oldest events are overwritten. A thread's ring is released when the
+ * thread exits and reused by the next recording thread, so short-lived threads do not add rings.
+ * The resulting file opens in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Event names must be string literals (or otherwise outlive the trace), only the pointer is stored.
+ */
+
+#if defined(ATHENA_ENABLE_TRACING)
+#define ATHENA_TRACE_CONCAT_INNER(a, b) a##b
+#define ATHENA_TRACE_CONCAT(a, b) ATHENA_TRACE_CONCAT_INNER(a, b)
+#define ATHENA_TRACE_SCOPE(name) TraceScope ATHENA_TRACE_CONCAT(athenaTraceScope_, __LINE__)(name)
+#else
+#define ATHENA_TRACE_SCOPE(name) ((void)0)
+#endif
+
+/**
+ * @struct TraceEvent
+ * @brief One completed scope ("X" event), times relative to the trace start.
+ */
+struct TraceEvent {
+    const char* name = nullptr;
+    uint64_t startNs = 0;
+    uint64_t durationNs = 0;
+};
+
+/**
+ * @class Tracer
+ * @brief Process-wide trace recorder with per-thread lock-free ring buffers.
+ * @details Threading contract: any thread may record while tracing is enabled. `start`, `stop`,
+ * `toChromeTraceJson` and `writeChromeTrace` are control operations for a single thread. The
+ * JSON should be written after `stop`, events recorded concurrently with the dump may be missed
+ * (never torn: events whose slot was rewritten while it was copied are dropped).
+ */
+class Tracer {
+private:
+    static std::atomic<bool> enabled;
+
+public:
+    static constexpr size_t DEFAULT_EVENTS_PER_THREAD = 1 << 16;
+
+    /**
+     * @brief True if the tracing hooks were compiled into the library.
+     */
+    static constexpr bool isCompiledIn() {
+#if defined(ATHENA_ENABLE_TRACING)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Discards previous events and starts recording.
+     * @param eventsPerThread Ring capacity of each recording thread (minimum 1).
+     */
+    static void start(size_t eventsPerThread = DEFAULT_EVENTS_PER_THREAD);
+
+    /**
+     * @brief Stops recording, recorded events are kept until the next start.
+     */
+    static void stop();
+
+    /**
+     * @brief Checks whether events are currently being recorded.
+     */
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Monotonic clock reading in nanoseconds, the time base of recorded events.
+     */
+    static uint64_t nowNs();
+
+    /**
+     * @brief Records a completed scope on the calling thread's ring.
+     * @param name Static event name.
+     * @param startNs Start time from nowNs().
+     * @param endNs End time from nowNs().
+     * @details Ignored if tracing is disabled.
+     */
+    static void recordComplete(const char* name, uint64_t startNs, uint64_t endNs);
+
+    /**
+     * @brief Number of events currently retained across all threads of this trace.
+     */
+    static size_t getEventCount();
+
+    /**
+     * @brief Number of per-thread rings allocated so far, at most the peak number of recording threads.
+     */
+    static size_t getRingCount();
+
+    /**
+     * @brief Builds the Chrome trace-event JSON of the retained events.
+     * @return std::string `{"traceEvents":[...],"displayTimeUnit":"ms"}`, events sorted by start time.
+     */
+    static std::string toChromeTraceJson();
+
+    /**
+     * @brief Writes the Chrome trace-event JSON to a file.
+     * @param filePath Destination path.
+     * @return bool True if the file was written.
+     */
+    static bool writeChromeTrace(const std::string& filePath);
+};
+
+/**
+ * @class TraceScope
+ * @brief RAII helper behind ATHENA_TRACE_SCOPE, records the lifetime of the enclosing scope.
+ */
+class TraceScope {
+private:
+    const char* name;
+    uint64_t startNs = 0;
+    bool active;
+
+public:
+    explicit TraceScope(const char* eventName) : name(eventName), active(Tracer::isEnabled()) {
+        if (active) {
+            startNs = Tracer::nowNs();
+        }
+    }
+
+    ~TraceScope() {
+        if (active) {
+            Tracer::recordComplete(name, startNs, Tracer::nowNs());
+        }
+    }
+
+    // Prevent copying/assignment
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class WorkerPool
+ * @brief Fixed set of persistent worker threads for fork/join phases of a step.
+ * @details `parallelFor` hands out task indices to the workers and to the calling thread, and
+ * returns once every task has finished. Threads are created once and sleep between phases, so
+ * a phase costs a wake-up rather than a thread spawn.
+ *
+ * `dispatch` and `join` split a phase in two, so the caller can do other work while the workers
+ * run it (the pipelined update phase overlapping the step).
+ *
+ * Only one phase may run at a time (the simulation loop is the only caller).
+ */
+class WorkerPool {
+private:
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wakeCondition;  // workers wait here for a new phase
+    std::condition_variable doneCondition;  // the caller waits here for the phase to finish
+
+    const std::function<void(size_t)>* currentTask = nullptr;
+    size_t taskCount = 0;
+    std::atomic<size_t> nextTask{0};
+    size_t busyWorkers = 0;
+    uint64_t phase = 0;      // incremented for every parallelFor, wakes the workers
+    bool phaseActive = false; // a dispatched phase has not been joined yet
+    bool stopping = false;
+    std::exception_ptr firstError;
+
+    /**
+     * @brief Body of each worker thread: wait for a phase, run tasks, report completion.
+     */
+    void workerLoop();
+
+    /**
+     * @brief Claims and runs task indices until none are left. Records the first exception.
+     */
+    void runTasks(const std::function<void(size_t)>& task);
+
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param workerCount Number of threads besides the caller. 0 runs every task on the calling thread.
+     */
+    explicit WorkerPool(size_t workerCount);
+
+    /**
+     * @brief Stops and joins all worker threads.
+     */
+    ~WorkerPool();
+
+    /**
+     * @brief Total number of threads a phase runs on, workers plus the calling thread.
+     * @return size_t workerCount + 1.
+     */
+    size_t getThreadCount() const;
+
+    /**
+     * @brief Runs `task(i)` for every i in [0, count) across the pool and waits for all of them.
+     * @param count Number of tasks.
+     * @param task Callable taking the task index. Must be safe to run concurrently for different indices.
+     * @throws Rethrows the first exception thrown by a task, after every task has finished.
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    /**
+     * @brief Starts `task(i)` for every i in [0, count) on the workers only and returns immediately.
+     * @param count Number of tasks.
+     * @param task Callable taking the task index. Must stay alive until join() returns.
+     * @details Joins a previous phase that was never joined first. Without workers the tasks run
+     * on the calling thread before dispatch returns.
+     */
+    void dispatch(size_t count, const std::function<void(size_t)>& task);
+
+    /**
+     * @brief Waits for the phase started by dispatch. Returns at once if none is running.
+     * @throws Rethrows the first exception thrown by a task of that phase.
+     */
+    void join();
+
+    /**
+     * @brief Default worker count for this machine, one less than the hardware threads (at least 0).
+     */
+    static size_t defaultWorkerCount();
+
+    /**
+     * @brief Pins the workers of pools created from now on to consecutive CPUs.
+     * @param enabled True to pin, false to leave placement to the OS scheduler (default).
+     * @param firstCpu CPU of the next pool's first worker. Its other workers and the pools created after it
+     * take the following CPUs (wrapping around), so they do not share one.
+     * @details Process-wide, meant for dedicated processes such as AthenaBatch that also pin the
+     * simulation thread (pinCurrentThread). Only supported on Linux, elsewhere pools are not pinned.
+     */
+    static void setCpuPinning(bool enabled, size_t firstCpu = 1);
+
+    /**
+     * @brief Pins the calling thread to one CPU (taken modulo the hardware threads).
+     * @return bool False if pinning is not supported or was refused.
+     */
+    static bool pinCurrentThread(size_t cpu);
+
+    // Prevent copying/assignment
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+};
+
+/**
+ * @class ScopedThreadPin
+ * @brief Pins the calling thread to one CPU for its lifetime and restores the previous affinity afterwards.
+ * @details Threads inherit the affinity of the thread that creates them, so helper threads should be
+ * started before the pin. Only supported on Linux, elsewhere it does nothing.
+ */
+class ScopedThreadPin {
+private:
+    std::vector<int> originalCpus; // the thread's CPUs before the pin
+    bool pinned = false;
+
+public:
+    /**
+     * @brief Pins the calling thread to `cpu` (taken modulo the hardware threads).
+     */
+    explicit ScopedThreadPin(size_t cpu);
+
+    /**
+     * @brief Restores the affinity saved by the constructor. Must run on the same thread.
+     */
+    ~ScopedThreadPin();
+
+    /**
+     * @brief Checks whether the pin took effect.
+     */
+    bool isPinned() const { return pinned; }
+
+    // Prevent copying/assignment
+    ScopedThreadPin(const ScopedThreadPin&) = delete;
+    ScopedThreadPin& operator=(const ScopedThreadPin&) = delete;
+};
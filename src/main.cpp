@@ -1,16 +1,18 @@
-#include "../tests/unit_tests/helpers/MockSimulator.h" // Temporarily using mock simulator to run cli 
 #include "headers/cli/CLI.h"
+#include "headers/cli/ControlServer.h"
 #include "headers/Simulator.h"
 #include "headers/util/LibsodiumRandomSource.h"
 #include "headers/util/PseudoRandomSource.h"
 #include <iostream>
 #include <memory>
+#include <string>
 
 /**
  * @brief The main entry point for the Neuron Simulator application.
  * @details This function is responsible for initializing the core `Simulator` object
  * and the `CLI` object. It then starts the command-line interface, which takes over
- * the main thread until the user quits.
+ * the main thread until the user quits. With `--socket <path>` the same commands are served
+ * on a Unix domain socket instead (`ControlServer`) until a client sends `shutdown`.
  */
 int main(int argc, char* argv[]) {
     // Use a smart pointer to manage the Simulator's lifetime and share it safely.
@@ -24,11 +26,20 @@ int main(int argc, char* argv[]) {
     //Randomizer* rand = new Randomizer(std::make_unique<PseudoRandomSource>());
     auto simulator = std::make_shared<Simulator>("", rand );
 
+    if (argc == 3 && std::string(argv[1]) == "--socket") {
+        ControlServer server(simulator, argv[2]);
+        std::cout << "Serving commands on control socket " << argv[2] << std::endl;
+        bool served = server.run();
+        server.stopBackgroundRuns(); // a run started by a client may still be inside a step
+        return served ? 0 : 1;
+    }
+
     // Create the CLI object, passing it the simulator instance.
     auto cli = std::make_unique<CLI>(simulator);
 
     // Run the CLI. This will block the main thread until the user quits.
     cli->run();
+    cli->stopBackgroundRuns(); // the input may also have ended without `quit`
 
     std::cout << "Application will now exit." << std::endl;
 
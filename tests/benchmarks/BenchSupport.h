@@ -0,0 +1,105 @@
+#pragma once
+
+#include "controllers/MetaController.h"
+#include "controllers/TimeController.h"
+#include "controllers/UpdateController.h"
+#include "Scheduler.h"
+#include "UpdateScheduler.h"
+#include "Payload.h"
+#include "util/Randomizer.h"
+#include "util/PseudoRandomSource.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+/**
+ * @file BenchSupport.h
+ * @brief Shared fixtures for AthenaBench: seeded networks and a scheduler context for component benchmarks.
+ */
+namespace bench {
+
+// Every benchmark network is built from this seed so runs are comparable across builds
+inline constexpr unsigned int BENCH_SEED = 20240501;
+
+// First internal operator ID of a MetaController(numOperators, ...) network (after Input 0-2, Output 3-5)
+inline constexpr uint32_t FIRST_INTERNAL_ID = 6;
+
+/**
+ * @brief Creates a randomizer backed by a seeded PseudoRandomSource.
+ */
+inline std::unique_ptr<Randomizer> makeSeededRandomizer(unsigned int seed = BENCH_SEED) {
+    return std::make_unique<Randomizer>(std::make_unique<PseudoRandomSource>(seed));
+}
+
+// Randomized networks from this size up only run with ATHENA_BENCH_LARGE=1 (100K ~ 4.5GB)
+inline constexpr int LARGE_NETWORK_OPERATORS = 100000;
+
+/**
+ * @brief True if benchmarks on large (LARGE_NETWORK_OPERATORS and up) networks should run.
+ * @details Opt in with ATHENA_BENCH_LARGE=1. A randomized operator takes roughly 45KB (connection
+ * buckets included), several GB at 100K and far more memory than a typical machine has at 10M.
+ */
+inline bool largeBenchmarksEnabled() {
+    const char* flag = std::getenv("ATHENA_BENCH_LARGE");
+    return flag != nullptr && flag[0] != '\0' && flag[0] != '0';
+}
+
+/**
+ * @class BenchTimeController
+ * @brief TimeController with access to its payload lists so benchmarks can reset them between batches.
+ */
+class BenchTimeController : public TimeController {
+public:
+    using TimeController::TimeController;
+
+    void discardPayloads() {
+        currentStepPayloads.clear();
+        nextStepPayloads.clear();
+        operatorsToProcess.clear();
+    }
+};
+
+/**
+ * @class BenchMetaController
+ * @brief MetaController exposing the protected operator lookup.
+ */
+class BenchMetaController : public MetaController {
+public:
+    using MetaController::MetaController;
+    using MetaController::getOperatorPtr;
+};
+
+/**
+ * @struct NetworkContext
+ * @brief A seeded network with its controllers and the global schedulers wired to them.
+ * @details Mirrors what Simulator::init does, without the Simulator's locking and logging,
+ * so component benchmarks measure only the component.
+ */
+struct NetworkContext {
+    std::unique_ptr<Randomizer> randomizer;
+    BenchMetaController metaController;
+    UpdateController updateController;
+    BenchTimeController timeController;
+
+    explicit NetworkContext(int numOperators, unsigned int seed = BENCH_SEED)
+        : randomizer(makeSeededRandomizer(seed)),
+          metaController(numOperators, randomizer.get()),
+          updateController(metaController),
+          timeController(metaController) {
+        Scheduler::ResetInstances();
+        UpdateScheduler::ResetInstances();
+        Scheduler::CreateInstance(&timeController);
+        UpdateScheduler::CreateInstance(&updateController);
+    }
+
+    ~NetworkContext() {
+        Scheduler::ResetInstances();
+        UpdateScheduler::ResetInstances();
+    }
+
+    NetworkContext(const NetworkContext&) = delete;
+    NetworkContext& operator=(const NetworkContext&) = delete;
+};
+
+} // namespace bench
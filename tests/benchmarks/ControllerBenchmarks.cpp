@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include "BenchSupport.h"
+
+#include <cstdint>
+
+// Operator lookup by ID across the layers, cycling through every ID of the network (100K needs ATHENA_BENCH_LARGE)
+static void BM_MetaControllerGetOperatorPtr(benchmark::State& state) {
+    const int numOperators = static_cast<int>(state.range(0));
+    if (numOperators >= bench::LARGE_NETWORK_OPERATORS && !bench::largeBenchmarksEnabled()) {
+        state.SkipWithError("set ATHENA_BENCH_LARGE=1 to run 100K operator networks");
+        return;
+    }
+    auto randomizer = bench::makeSeededRandomizer();
+    bench::BenchMetaController metaController(numOperators, randomizer.get());
+    const uint32_t idCount = static_cast<uint32_t>(metaController.getOpCount());
+
+    uint32_t id = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(metaController.getOperatorPtr(id));
+        if (++id == idCount) {
+            id = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetaControllerGetOperatorPtr)->Arg(1000)->Arg(100000);
+
+// Building a random network (operators randomized in parallel chunks, see InternalLayer::randomInit)
+static void BM_MetaControllerRandomizeNetwork(benchmark::State& state) {
+    const int numOperators = static_cast<int>(state.range(0));
+    auto randomizer = bench::makeSeededRandomizer();
+    bench::BenchMetaController metaController(0, randomizer.get());
+    for (auto _ : state) {
+        metaController.randomizeNetwork(numOperators);
+    }
+    state.SetItemsProcessed(state.iterations() * numOperators);
+}
+BENCHMARK(BM_MetaControllerRandomizeNetwork)->Arg(1000)->Arg(20000)->Unit(benchmark::kMillisecond);
+
+// One full step (operator checks + payload traversal) with a payload seeded on every internal operator
+// (100K needs ATHENA_BENCH_LARGE)
+static void BM_TimeControllerProcessCurrentStep(benchmark::State& state) {
+    const int numOperators = static_cast<int>(state.range(0));
+    if (numOperators >= bench::LARGE_NETWORK_OPERATORS && !bench::largeBenchmarksEnabled()) {
+        state.SkipWithError("set ATHENA_BENCH_LARGE=1 to run 100K operator networks");
+        return;
+    }
+    bench::NetworkContext ctx(numOperators);
+    const uint32_t lastId = bench::FIRST_INTERNAL_ID + static_cast<uint32_t>(numOperators);
+
+    int64_t payloads = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        ctx.timeController.discardPayloads();
+        for (uint32_t id = bench::FIRST_INTERNAL_ID; id < lastId; ++id) {
+            ctx.timeController.emplaceNextStepPayload(1, id);
+        }
+        ctx.timeController.advanceStep(); // seeded payloads become the current step
+        state.ResumeTiming();
+
+        ctx.timeController.processCurrentStep();
+        payloads += numOperators;
+    }
+    state.SetItemsProcessed(payloads);
+}
+BENCHMARK(BM_TimeControllerProcessCurrentStep)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include "util/NetworkGenerator.h"
+#include "BenchSupport.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string GENERATED_FILE = "bench_generated_network.bin";
+}
+
+// Per-operator connection draws only (no encoding or I/O), by degree model
+static void BM_GeneratorConnections(benchmark::State& state) {
+    NetworkSpec spec;
+    spec.internalOperators = 1 << 20;
+    spec.seed = bench::BENCH_SEED;
+    spec.degreeModel = static_cast<NetworkSpec::DegreeModel>(state.range(0));
+    NetworkGenerator generator(spec);
+    std::vector<NetworkGenerator::Connection> connections;
+    uint32_t operatorId = NetworkGenerator::INTERNAL_MIN_ID;
+    for (auto _ : state) {
+        generator.generateConnections(operatorId, connections);
+        benchmark::DoNotOptimize(connections.data());
+        if (++operatorId == NetworkGenerator::INTERNAL_MIN_ID + spec.internalOperators) {
+            operatorId = NetworkGenerator::INTERNAL_MIN_ID;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GeneratorConnections)
+    ->Arg(static_cast<int>(NetworkSpec::DegreeModel::UNIFORM))
+    ->Arg(static_cast<int>(NetworkSpec::DegreeModel::POWER_LAW))
+    ->Arg(static_cast<int>(NetworkSpec::DegreeModel::SMALL_WORLD));
+
+// Whole configuration file (generation, encoding and writing), in operators per second.
+// 10M operators are opt-in (ATHENA_BENCH_LARGE), the file is about 75 bytes per operator at mean degree 8.
+static void BM_GeneratorWriteConfiguration(benchmark::State& state) {
+    if (state.range(0) >= 10000000 && !bench::largeBenchmarksEnabled()) {
+        state.SkipWithError("set ATHENA_BENCH_LARGE=1 to run 10M operators");
+        return;
+    }
+    NetworkSpec spec;
+    spec.internalOperators = static_cast<uint32_t>(state.range(0));
+    spec.seed = bench::BENCH_SEED;
+    NetworkGenerator generator(spec);
+    GeneratedNetworkInfo info;
+    for (auto _ : state) {
+        if (!generator.writeConfiguration(GENERATED_FILE, &info)) {
+            state.SkipWithError("could not write the generated network");
+            break;
+        }
+    }
+    std::remove(GENERATED_FILE.c_str());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(info.operators));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(info.bytes));
+}
+BENCHMARK(BM_GeneratorWriteConfiguration)->Arg(100000)->Arg(10000000)->Unit(benchmark::kMillisecond);
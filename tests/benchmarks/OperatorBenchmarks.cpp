@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include "BenchSupport.h"
+#include "operators/AddOperator.h"
+
+#include <memory>
+
+// Full walk of one payload over every distance bucket of an operator (each hop delivers to the bucket's targets)
+static void BM_OperatorTraverse(benchmark::State& state) {
+    bench::NetworkContext ctx(static_cast<int>(state.range(0)));
+    Operator* op = ctx.metaController.getOperatorPtr(bench::FIRST_INTERNAL_ID);
+    if (op == nullptr) {
+        state.SkipWithError("network has no internal operator");
+        return;
+    }
+
+    int64_t hops = 0;
+    int64_t batch = 0;
+    for (auto _ : state) {
+        Payload payload(0, bench::FIRST_INTERNAL_ID, 0, true); // message 0 leaves the targets' accumulators untouched
+        while (payload.active) {
+            op->traverse(&payload);
+            ++hops;
+        }
+        if (++batch == 1024) { // delivered targets pile up in operatorsToProcess
+            state.PauseTiming();
+            ctx.timeController.discardPayloads();
+            batch = 0;
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(hops);
+}
+BENCHMARK(BM_OperatorTraverse)->Arg(1000);
+
+// Saturating integer accumulation
+static void BM_AddOperatorMessage(benchmark::State& state) {
+    AddOperator op(static_cast<uint32_t>(bench::FIRST_INTERNAL_ID));
+    int value = 1;
+    for (auto _ : state) {
+        op.message(value);
+        value = -value; // keep the accumulator near zero instead of pinning it at saturation
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddOperatorMessage);
+
+// Threshold check and payload emission into the next step (operator taken from a seeded network, so it has connections)
+static void BM_AddOperatorProcessData(benchmark::State& state) {
+    bench::NetworkContext ctx(1000);
+    Operator* op = ctx.metaController.getOperatorPtr(bench::FIRST_INTERNAL_ID);
+    if (op == nullptr) {
+        state.SkipWithError("network has no internal operator");
+        return;
+    }
+
+    int64_t batch = 0;
+    for (auto _ : state) {
+        op->message(1000);
+        op->processData();
+        if (++batch == 4096) {
+            state.PauseTiming();
+            ctx.timeController.discardPayloads();
+            batch = 0;
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddOperatorProcessData);
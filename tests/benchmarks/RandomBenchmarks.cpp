@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+#include "BenchSupport.h"
+#include "util/Philox.h"
+#include "util/PhiloxRandomSource.h"
+
+#include <memory>
+#include <vector>
+
+// Per-call draws through the virtual Randomizer -> RandomSource chain (the pre-batching path)
+static void BM_RandomizerGetInt_Pseudo(benchmark::State& state) {
+    auto randomizer = bench::makeSeededRandomizer();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomizer->getInt(0, 511));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomizerGetInt_Pseudo);
+
+static void BM_RandomizerGetInt_Philox(benchmark::State& state) {
+    Randomizer randomizer(std::make_unique<PhiloxRandomSource>(bench::BENCH_SEED));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomizer.getInt(0, 511));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomizerGetInt_Philox);
+
+// Batched draws: one virtual call per batch of state.range(0) values
+static void BM_RandomizerFillInt_Pseudo(benchmark::State& state) {
+    auto randomizer = bench::makeSeededRandomizer();
+    std::vector<int> values(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        randomizer->fillInt(values.data(), values.size(), 0, 511);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RandomizerFillInt_Pseudo)->Arg(64)->Arg(4096);
+
+static void BM_RandomizerFillInt_Philox(benchmark::State& state) {
+    Randomizer randomizer(std::make_unique<PhiloxRandomSource>(bench::BENCH_SEED));
+    std::vector<int> values(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        randomizer.fillInt(values.data(), values.size(), 0, 511);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RandomizerFillInt_Philox)->Arg(64)->Arg(4096);
+
+// Raw engine throughput
+static void BM_PhiloxFill(benchmark::State& state) {
+    Philox engine(bench::BENCH_SEED);
+    std::vector<uint32_t> values(4096);
+    for (auto _ : state) {
+        engine.fill(values.data(), values.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 4096);
+}
+BENCHMARK(BM_PhiloxFill);
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include "util/Serializer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    constexpr size_t VALUES_PER_BATCH = 4096;
+}
+
+// Big-endian writes of mixed field types, the shape of an operator record
+static void BM_SerializerWrite(benchmark::State& state) {
+    std::vector<std::byte> buffer;
+    buffer.reserve(VALUES_PER_BATCH * (4 + 4 + 2));
+    for (auto _ : state) {
+        buffer.clear();
+        for (size_t i = 0; i < VALUES_PER_BATCH; ++i) {
+            Serializer::write(buffer, static_cast<uint32_t>(i));
+            Serializer::write(buffer, static_cast<int>(i) - 2048);
+            Serializer::write(buffer, static_cast<uint16_t>(i & 0xFFFF));
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * VALUES_PER_BATCH * 3);
+    state.SetBytesProcessed(state.iterations() * VALUES_PER_BATCH * 10);
+}
+BENCHMARK(BM_SerializerWrite);
+
+// Reading back the same record layout with bounds checks
+static void BM_SerializerRead(benchmark::State& state) {
+    std::vector<std::byte> buffer;
+    for (size_t i = 0; i < VALUES_PER_BATCH; ++i) {
+        Serializer::write(buffer, static_cast<uint32_t>(i));
+        Serializer::write(buffer, static_cast<int>(i) - 2048);
+        Serializer::write(buffer, static_cast<uint16_t>(i & 0xFFFF));
+    }
+
+    for (auto _ : state) {
+        const std::byte* current = buffer.data();
+        const std::byte* end = buffer.data() + buffer.size();
+        uint64_t checksum = 0;
+        while (current < end) {
+            checksum += Serializer::read_uint32(current, end);
+            checksum += static_cast<uint32_t>(Serializer::read_int(current, end));
+            checksum += Serializer::read_uint16(current, end);
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * VALUES_PER_BATCH * 3);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+}
+BENCHMARK(BM_SerializerRead);
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include "BenchSupport.h"
+#include "Simulator.h"
+
+#include <memory>
+#include <string>
+
+namespace {
+    constexpr int STEPS_PER_RUN = 20;
+    const std::string INPUT_TEXT = "the quick brown fox jumps over the lazy dog";
+}
+
+// End-to-end step rate: Simulator::run(N) on a seeded network, fed with text so the network is active.
+// Network creation is excluded. Random networks take roughly 45KB per operator (100K ~ 4.5GB),
+// so 100K and 10M operators are only run with ATHENA_BENCH_LARGE=1 on a machine that can hold them.
+static void BM_SimulatorRun(benchmark::State& state) {
+    const int numOperators = static_cast<int>(state.range(0));
+    if (numOperators >= bench::LARGE_NETWORK_OPERATORS && !bench::largeBenchmarksEnabled()) {
+        state.SkipWithError("set ATHENA_BENCH_LARGE=1 to run 100K and 10M operator networks");
+        return;
+    }
+
+    auto randomizer = bench::makeSeededRandomizer();
+    Simulator simulator("", randomizer.get());
+    simulator.createNewNetwork(numOperators);
+    simulator.setLogFrequency(STEPS_PER_RUN + 1); // status is printed on the first and last step only
+
+    int64_t steps = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        simulator.submitText(INPUT_TEXT);
+        long long startStep = simulator.getStatus().currentStep;
+        state.ResumeTiming();
+
+        simulator.run(STEPS_PER_RUN);
+
+        state.PauseTiming();
+        steps += simulator.getStatus().currentStep - startStep;
+        state.ResumeTiming();
+    }
+    state.counters["steps/s"] = benchmark::Counter(static_cast<double>(steps), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_SimulatorRun)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(5);
@@ -0,0 +1,205 @@
+// AthenaPerf: end-to-end performance scenario runner.
+// Runs one scenario (load a network, feed fixed text, run fixed steps, checkpoint) and prints the
+// measurements as JSON. scripts/perf_regression.py runs every scenario in its own process (so peak
+// RSS is per scenario), merges the results and compares them with tests/perf/baseline.json.
+
+#include "Simulator.h"
+#include "util/AllocationHooks.h" // counts every heap allocation of this executable
+#include "util/AsyncLogger.h"
+#include "util/NetworkGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/resource.h>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    const char* const DEFAULT_TEXT = "the quick brown fox jumps over the lazy dog 0123456789";
+
+    /**
+     * @struct PerfOptions
+     * @brief Command line of AthenaPerf.
+     */
+    struct PerfOptions {
+        std::string scenario = "testnet";     // "testnet" (load --config) or "generated"
+        std::string configPath = "testNet.bin";
+        uint32_t operators = 10000;           // generated only
+        uint64_t seed = 1;                    // generated only
+        long long steps = 1000;
+        long long submitEvery = 100;          // steps between text submissions
+        int checkpointRepeats = 3;
+        std::string text = DEFAULT_TEXT;
+        std::string outPath;                  // empty = stdout
+    };
+
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    long peakRssKb() {
+        struct rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss; // kilobytes on Linux
+    }
+
+    uint64_t fileSize(const std::string& path) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        return in ? static_cast<uint64_t>(in.tellg()) : 0;
+    }
+
+    std::string jsonEscape(const std::string& value) {
+        std::string out;
+        for (char c : value) {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    void printUsage() {
+        std::cerr << "Usage: AthenaPerf [--scenario testnet|generated] [--config <path>] [--operators <n>]\n"
+                  << "                  [--seed <n>] [--steps <n>] [--submit-every <n>] [--checkpoints <n>]\n"
+                  << "                  [--text <text>] [--out <path>]" << std::endl;
+    }
+
+    bool parseOptions(int argc, char** argv, PerfOptions& options) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (i + 1 >= argc) {
+                return false; // every option takes a value
+            }
+            std::string value = argv[++i];
+            try {
+                if (arg == "--scenario") options.scenario = value;
+                else if (arg == "--config") options.configPath = value;
+                else if (arg == "--operators") options.operators = static_cast<uint32_t>(std::stoul(value));
+                else if (arg == "--seed") options.seed = std::stoull(value);
+                else if (arg == "--steps") options.steps = std::stoll(value);
+                else if (arg == "--submit-every") options.submitEvery = std::stoll(value);
+                else if (arg == "--checkpoints") options.checkpointRepeats = std::stoi(value);
+                else if (arg == "--text") options.text = value;
+                else if (arg == "--out") options.outPath = value;
+                else return false;
+            } catch (const std::exception&) {
+                return false;
+            }
+        }
+        return (options.scenario == "testnet" || options.scenario == "generated")
+            && options.steps > 0 && options.submitEvery > 0 && options.checkpointRepeats > 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    PerfOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+    AsyncLogger::get().setLevel(AsyncLogger::Level::WARN);
+
+    // 1. Network
+    std::string networkPath = options.configPath;
+    std::string generatedPath;
+    if (options.scenario == "generated") {
+        NetworkSpec spec;
+        spec.internalOperators = options.operators;
+        spec.seed = options.seed;
+        generatedPath = "athena_perf_network.bin";
+        if (!NetworkGenerator(spec).writeConfiguration(generatedPath)) {
+            return 1;
+        }
+        networkPath = generatedPath;
+    }
+
+    Clock::time_point loadStart = Clock::now();
+    Simulator simulator;
+    try {
+        simulator.loadConfiguration(networkPath); // as `load-config` does
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    double loadSeconds = secondsSince(loadStart);
+    size_t operatorCount = simulator.getStatus().totalOperators;
+    if (operatorCount == 0) {
+        std::cerr << "Error: network '" << networkPath << "' is empty." << std::endl;
+        return 1;
+    }
+    simulator.setLogFrequency(0);
+
+    // 2. Steps, with the same text fed every submitEvery steps
+    long long firstStep = simulator.getStatus().currentStep;
+    AllocationCounter::Scope runScope(AllocationCounter::ALL_THREADS); // the logger and worker threads too
+    Clock::time_point runStart = Clock::now();
+    for (long long done = 0; done < options.steps; done += options.submitEvery) {
+        simulator.submitText(options.text);
+        long long chunk = std::min(options.submitEvery, options.steps - done);
+        simulator.run(static_cast<int>(chunk)); // stops early if the network falls silent
+    }
+    double runSeconds = secondsSince(runStart);
+    uint64_t runAllocations = runScope.allocations();
+    uint64_t runBytes = runScope.bytes();
+    long long executedSteps = simulator.getStatus().currentStep - firstStep;
+
+    // 3. Checkpoint (network configuration + payload state), best of the repeats
+    const std::string configCheckpoint = "athena_perf_checkpoint.bin";
+    const std::string stateCheckpoint = "athena_perf_checkpoint_state.bin";
+    double bestCheckpointSeconds = 0.0;
+    uint64_t checkpointBytes = 0;
+    for (int i = 0; i < options.checkpointRepeats; ++i) {
+        Clock::time_point checkpointStart = Clock::now();
+        simulator.saveConfiguration(configCheckpoint);
+        simulator.saveState(stateCheckpoint);
+        double seconds = secondsSince(checkpointStart);
+        if (i == 0 || seconds < bestCheckpointSeconds) {
+            bestCheckpointSeconds = seconds;
+        }
+        checkpointBytes = fileSize(configCheckpoint) + fileSize(stateCheckpoint);
+    }
+    std::remove(configCheckpoint.c_str());
+    std::remove(stateCheckpoint.c_str());
+    if (!generatedPath.empty()) {
+        std::remove(generatedPath.c_str());
+    }
+
+    // 4. Report
+    double perStep = executedSteps > 0 ? 1.0 / static_cast<double>(executedSteps) : 0.0;
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"scenario\": \"" << jsonEscape(options.scenario == "generated"
+                ? "generated-" + std::to_string(options.operators) : "testnet") << "\",\n"
+         << "  \"operators\": " << operatorCount << ",\n"
+         << "  \"requestedSteps\": " << options.steps << ",\n"
+         << "  \"executedSteps\": " << executedSteps << ",\n"
+         << "  \"loadSeconds\": " << loadSeconds << ",\n"
+         << "  \"runSeconds\": " << runSeconds << ",\n"
+         << "  \"stepsPerSecond\": " << (runSeconds > 0.0 ? executedSteps / runSeconds : 0.0) << ",\n"
+         << "  \"allocationsPerStep\": " << runAllocations * perStep << ",\n"
+         << "  \"allocatedBytesPerStep\": " << runBytes * perStep << ",\n"
+         << "  \"checkpointBytes\": " << checkpointBytes << ",\n"
+         << "  \"checkpointSeconds\": " << bestCheckpointSeconds << ",\n"
+         << "  \"checkpointMBPerSecond\": "
+         << (bestCheckpointSeconds > 0.0 ? checkpointBytes / bestCheckpointSeconds / 1e6 : 0.0) << ",\n"
+         << "  \"peakRssKb\": " << peakRssKb() << "\n"
+         << "}\n";
+
+    if (options.outPath.empty()) {
+        std::cout << json.str();
+    } else {
+        std::ofstream out(options.outPath);
+        out << json.str();
+        if (!out) {
+            std::cerr << "Error: could not write '" << options.outPath << "'." << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
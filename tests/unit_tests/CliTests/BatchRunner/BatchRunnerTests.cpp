@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include "cli/BatchRunner.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+// Fixture: a runner reporting into a captured error stream, temporary files removed afterwards
+class BatchRunnerTest : public ::testing::Test {
+protected:
+    std::stringstream errors;
+    BatchRunner runner{errors};
+    std::vector<std::string> tempFiles;
+
+    std::string tempPath(const std::string& name) {
+        tempFiles.push_back("batch_runner_test_" + name);
+        return tempFiles.back();
+    }
+
+    static bool fileExists(const std::string& path) {
+        return static_cast<bool>(std::ifstream(path, std::ios::binary));
+    }
+
+    void TearDown() override {
+        for (const std::string& path : tempFiles) {
+            std::remove(path.c_str());
+        }
+    }
+};
+
+// Test that command line options describe a single job
+TEST_F(BatchRunnerTest, ParseArguments_SingleJob) {
+    ASSERT_TRUE(runner.parseArguments({"--config", "net.bin", "--steps", "100", "--output", "-",
+                                       "--update-threads", "2", "--pipeline", "--pin-cpu", "3"}));
+    std::vector<BatchJob> jobs = runner.getJobs();
+    ASSERT_EQ(jobs.size(), 1u);
+    EXPECT_EQ(jobs[0].configPath, "net.bin");
+    EXPECT_EQ(jobs[0].steps, 100);
+    EXPECT_EQ(jobs[0].outputPath, "-");
+    EXPECT_EQ(jobs[0].updateThreads, 2u);
+    EXPECT_TRUE(jobs[0].pipelinedUpdates);
+    EXPECT_EQ(jobs[0].pinCpu, 3);
+    EXPECT_FALSE(jobs[0].verbose);
+}
+
+// Test that a script queues a job per run line, later jobs keeping the options they do not change
+TEST_F(BatchRunnerTest, ParseScript_QueuesJobs) {
+    std::istringstream script(
+        "# two runs of one network\n"
+        "generate 500\n"
+        "seed 7\n"
+        "text hello world\n"
+        "steps 50\n"
+        "run\n"
+        "\n"
+        "  steps 80  \n"
+        "pipeline off\n"
+        "run\n");
+    ASSERT_TRUE(runner.parseScript(script));
+    std::vector<BatchJob> jobs = runner.getJobs();
+    ASSERT_EQ(jobs.size(), 2u);
+    EXPECT_EQ(jobs[0].generateOperators, 500);
+    EXPECT_EQ(jobs[0].seed, 7u);
+    EXPECT_EQ(jobs[0].inputText, "hello world");
+    EXPECT_EQ(jobs[0].steps, 50);
+    EXPECT_EQ(jobs[1].generateOperators, 500);
+    EXPECT_EQ(jobs[1].steps, 80);
+}
+
+// Test that unknown options, missing values and invalid numbers are rejected and reported
+TEST_F(BatchRunnerTest, Parse_RejectsInvalidInput) {
+    EXPECT_FALSE(runner.parseArguments({"--bogus", "1"}));
+    EXPECT_FALSE(runner.parseArguments({"--steps"}));
+    EXPECT_FALSE(runner.parseArguments({"steps", "10"}));
+    EXPECT_FALSE(runner.setOption("steps", "-5"));
+    EXPECT_FALSE(runner.setOption("steps", "12x"));
+    EXPECT_FALSE(runner.setOption("pipeline", "maybe"));
+
+    std::istringstream script("steps 10\nfrobnicate\n");
+    EXPECT_FALSE(runner.parseScript(script));
+    EXPECT_NE(errors.str().find("script:2"), std::string::npos);
+    EXPECT_EQ(runner.getJobs()[0].steps, 10); // rejected values leave the previous one
+}
+
+// Test that a job without a network or a step count fails before building a simulator
+TEST_F(BatchRunnerTest, RunJob_RequiresNetworkAndSteps) {
+    BatchJob noNetwork;
+    noNetwork.steps = 10;
+    EXPECT_FALSE(BatchRunner::runJob(noNetwork, errors));
+
+    BatchJob noSteps;
+    noSteps.generateOperators = 10;
+    EXPECT_FALSE(BatchRunner::runJob(noSteps, errors));
+
+    BatchJob missingConfig;
+    missingConfig.configPath = "batch_runner_test_missing.bin";
+    missingConfig.steps = 10;
+    EXPECT_FALSE(BatchRunner::runJob(missingConfig, errors));
+}
+
+// Test a full job: generated network, text input, output file and saved network and state
+TEST_F(BatchRunnerTest, RunAll_EndToEnd) {
+    std::string output = tempPath("output.txt");
+    std::string config = tempPath("config.bin");
+    std::string state = tempPath("state.bin");
+    ASSERT_TRUE(runner.parseArguments({"--generate", "200", "--seed", "3", "--text", "hello",
+                                       "--steps", "40", "--output", output,
+                                       "--save-config", config, "--save-state", state}));
+    EXPECT_EQ(runner.runAll(), 0) << errors.str();
+    EXPECT_TRUE(fileExists(output));
+    EXPECT_TRUE(fileExists(config));
+    EXPECT_TRUE(fileExists(state));
+
+    // The saved network runs as a job of its own
+    BatchJob reload;
+    reload.configPath = config;
+    reload.statePath = state;
+    reload.steps = 10;
+    EXPECT_TRUE(BatchRunner::runJob(reload, errors)) << errors.str();
+}
+
+// Test that a state that fails to load or save fails the job, even where the target path already exists
+TEST_F(BatchRunnerTest, RunJob_StateFailuresFailTheJob) {
+    std::string garbage = tempPath("garbage_state.bin");
+    std::ofstream(garbage, std::ios::binary) << "not a state file";
+    BatchJob load;
+    load.generateOperators = 10;
+    load.statePath = garbage;
+    load.steps = 5;
+    EXPECT_FALSE(BatchRunner::runJob(load, errors));
+    EXPECT_NE(errors.str().find("Could not load the state"), std::string::npos);
+
+    std::string inside = tempPath("state_dir/keep.txt"); // removed before its directory
+    std::string directory = tempPath("state_dir");
+    ASSERT_EQ(::mkdir(directory.c_str(), 0700), 0);
+    std::ofstream(inside) << "keeps the directory from being removed";
+    BatchJob save;
+    save.generateOperators = 10;
+    save.steps = 5;
+    save.saveStatePath = directory; // exists, but cannot be written as a file
+    EXPECT_FALSE(BatchRunner::runJob(save, errors));
+    EXPECT_NE(errors.str().find("Could not save the state"), std::string::npos);
+}
@@ -4,6 +4,10 @@
 #include <memory>
 #include <string>
 #include <sstream>
+#include <cstdio>
+#include <fstream>
+#include <chrono>
+#include <thread>
 
 /**
  * @class CLITest
@@ -138,6 +142,72 @@ TEST_F(CLITest, Command_Status) {
     EXPECT_EQ(mockSim->callCount, 1);
 }
 
+TEST_F(CLITest, Command_Stats) {
+    process("stats");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::GET_STATUS);
+    EXPECT_EQ(mockSim->callCount, 1);
+}
+
+TEST_F(CLITest, Command_StatsReset) {
+    process("stats reset");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::RESET_STATS);
+    EXPECT_EQ(mockSim->callCount, 1);
+}
+
+TEST_F(CLITest, Command_TraceStartStop) {
+    process("trace start");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::START_TRACE);
+    process("trace stop trace.json");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::STOP_TRACE);
+    EXPECT_EQ(mockSim->lastPath, "trace.json");
+    EXPECT_EQ(mockSim->callCount, 2);
+}
+
+TEST_F(CLITest, Command_TraceStopWithoutPath) {
+    process("trace stop");
+    EXPECT_EQ(mockSim->callCount, 0);
+}
+
+TEST_F(CLITest, Command_ProfileOnOff) {
+    process("profile on");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::SET_PROFILING);
+    EXPECT_TRUE(mockSim->lastProfilingEnabled);
+    process("profile off");
+    EXPECT_FALSE(mockSim->lastProfilingEnabled);
+    EXPECT_EQ(mockSim->callCount, 2);
+}
+
+TEST_F(CLITest, Command_ProfileReport) {
+    process("profile report 5 emitted");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::GET_PROFILE_REPORT);
+    EXPECT_EQ(mockSim->lastTopK, 5u);
+    EXPECT_EQ(mockSim->lastMetric, OperatorProfiler::Metric::EMITTED);
+}
+
+TEST_F(CLITest, Command_ProfileReportUnknownMetric) {
+    process("profile report 5 bogus");
+    EXPECT_EQ(mockSim->callCount, 0);
+}
+
+TEST_F(CLITest, Command_Pipeline) {
+    process("pipeline on");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::SET_PIPELINED_UPDATES);
+    EXPECT_TRUE(mockSim->lastPipelinedUpdates);
+    EXPECT_EQ(mockSim->lastPipelineThreshold, Simulator::DEFAULT_PIPELINE_THRESHOLD);
+    process("pipeline on 64");
+    EXPECT_EQ(mockSim->lastPipelineThreshold, 64u);
+    process("pipeline off");
+    EXPECT_FALSE(mockSim->lastPipelinedUpdates);
+    EXPECT_EQ(mockSim->callCount, 3);
+}
+
+TEST_F(CLITest, Command_Pipeline_InvalidArgs) {
+    process("pipeline");
+    process("pipeline maybe");
+    process("pipeline on many");
+    EXPECT_EQ(mockSim->callCount, 0);
+}
+
 TEST_F(CLITest, Command_PrintNetwork) {
     process("print-network");
     EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::GET_JSON);
@@ -160,6 +230,89 @@ TEST_F(CLITest, Command_LogFrequency_InvalidArg) {
     EXPECT_EQ(mockSim->callCount, 0); // Should fail validation (must be positive)
 }
 
+TEST_F(CLITest, Command_GenerateNetwork) {
+    process("generate-network net.bin 5000 power-law 12.5 42");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::GENERATE_NETWORK);
+    EXPECT_EQ(mockSim->lastPath, "net.bin");
+    EXPECT_EQ(mockSim->lastNetworkSpec.internalOperators, 5000u);
+    EXPECT_EQ(mockSim->lastNetworkSpec.degreeModel, NetworkSpec::DegreeModel::POWER_LAW);
+    EXPECT_DOUBLE_EQ(mockSim->lastNetworkSpec.meanDegree, 12.5);
+    EXPECT_EQ(mockSim->lastNetworkSpec.seed, 42u);
+}
+
+TEST_F(CLITest, Command_GenerateNetwork_InvalidArgs) {
+    process("generate-network net.bin");
+    EXPECT_EQ(mockSim->callCount, 0); // missing count
+    process("generate-network net.bin 100 scale-free");
+    EXPECT_EQ(mockSim->callCount, 0); // unknown model
+}
+
+TEST_F(CLITest, Command_StreamText) {
+    process("stream-text corpus.txt 32 5000");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::OPEN_TEXT_STREAM);
+    EXPECT_EQ(mockSim->lastPath, "corpus.txt");
+    EXPECT_EQ(mockSim->lastTextStreamOptions.charsPerStep, 32u);
+    EXPECT_EQ(mockSim->lastTextStreamOptions.maxInFlightPayloads, 5000u);
+
+    process("stream-text status");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::GET_TEXT_STREAM_STATS);
+    process("stream-text close");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::CLOSE_TEXT_STREAM);
+}
+
+TEST_F(CLITest, Command_StreamText_InvalidArgs) {
+    process("stream-text");
+    EXPECT_EQ(mockSim->callCount, 0); // missing path
+    process("stream-text corpus.txt 0");
+    EXPECT_EQ(mockSim->callCount, 0); // zero rate
+    process("stream-text corpus.txt 8 -1");
+    EXPECT_EQ(mockSim->callCount, 0); // negative limit
+}
+
+TEST_F(CLITest, Command_SubmitMedia) {
+    const char* path = "cli_submit_media_test.raw";
+    {
+        std::ofstream out(path, std::ios::binary);
+        const unsigned char bytes[] = {0, 127, 255, 16};
+        out.write(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+    }
+    process(std::string("submit-media image ") + path + " 2");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::SUBMIT_IMAGE_FRAME);
+    EXPECT_EQ(mockSim->lastSamples, (std::vector<int>{0, 127, 255, 16}));
+    EXPECT_EQ(mockSim->lastChannel, ChannelType::IMAGE);
+    EXPECT_EQ(mockSim->lastSamplesPerStep, 2u);
+
+    process(std::string("submit-media audio ") + path);
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::SUBMIT_AUDIO_SAMPLES);
+    EXPECT_EQ(mockSim->lastSamples.size(), 2u); // four bytes are two 16-bit samples
+
+    process("read-media audio cli_submit_media_test.out 8");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::READ_AUDIO_OUTPUT);
+    std::remove(path);
+    std::remove("cli_submit_media_test.out");
+}
+
+TEST_F(CLITest, Command_SubmitMedia_InvalidArgs) {
+    process("submit-media video frame.raw");
+    EXPECT_EQ(mockSim->callCount, 0); // unknown channel
+    process("submit-media image");
+    EXPECT_EQ(mockSim->callCount, 0); // missing path
+    process("submit-media image does_not_exist_media.raw");
+    EXPECT_EQ(mockSim->callCount, 0); // missing file
+    process("read-media image out.raw 0");
+    EXPECT_EQ(mockSim->callCount, 0); // zero limit
+}
+
+TEST_F(CLITest, Command_LogLevel) {
+    process("log-level warn");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::SET_LOG_LEVEL);
+    EXPECT_EQ(mockSim->lastLogLevel, AsyncLogger::Level::WARN);
+
+    mockSim->reset();
+    process("log-level loud");
+    EXPECT_EQ(mockSim->callCount, 0); // unknown level
+}
+
 
 TEST_F(CLITest, Command_Quit) {
     process("quit");
@@ -180,4 +333,21 @@ TEST_F(CLITest, Command_EmptyInput) {
     // No method on the simulator should be called for an empty input line.
     EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::NONE);
     EXPECT_EQ(mockSim->callCount, 0);
-}
\ No newline at end of file
+}
+// Test that stopBackgroundRuns returns only once a run started by the `run` command has ended
+TEST(CLIBackgroundRunTest, StopBackgroundRuns_WaitsForTheRun) {
+    auto simulator = std::make_shared<Simulator>();
+    simulator->setLogFrequency(0);
+    simulator->createNewNetwork(200);
+    simulator->submitText("keep the network busy");
+    CLI cli(simulator);
+    std::ostringstream out;
+    cli.execute("run 100000000", out);
+    cli.stopBackgroundRuns();
+
+    long long step = simulator->getStatus().currentStep;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(simulator->getStatus().currentStep, step); // nothing steps any more
+    EXPECT_TRUE(simulator->isFinished());
+    cli.stopBackgroundRuns(); // no runs left, returns at once
+}
@@ -0,0 +1,270 @@
+#include "gtest/gtest.h"
+#include "helpers/MockSimulator.h"
+#include "headers/cli/ControlServer.h"
+#include "OutputSubscription.h"
+#include "operators/OutOperator.h"
+#include "util/SampleCodec.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+    // Mock whose output subscriptions read a standalone channel operator the test writes to
+    class StreamingMockSimulator : public MockSimulator {
+    public:
+        OutOperator channel{7};
+        std::shared_ptr<OutputSubscription> subscription;
+
+        std::shared_ptr<OutputSubscription> subscribeOutput(ChannelType channelType, size_t batchSize) override {
+            subscription = std::make_shared<OutputSubscription>(channelType, batchSize);
+            subscription->bind(&channel);
+            return subscription;
+        }
+
+        void unsubscribeOutput(const std::shared_ptr<OutputSubscription>& unsubscribed) override {
+            unsubscribed->bind(nullptr);
+        }
+    };
+
+    // Blocking client of the control socket
+    class Client {
+    public:
+        int fd = -1;
+
+        explicit Client(const std::string& path) {
+            fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::snprintf(address.sun_path, sizeof(address.sun_path), "%s", path.c_str());
+            if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+
+        ~Client() {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+
+        void send(const std::string& text) {
+            ASSERT_EQ(::send(fd, text.data(), text.size(), MSG_NOSIGNAL), static_cast<ssize_t>(text.size()));
+        }
+
+        // Reads until `count` bytes or the end marker arrived, or the timeout passed
+        std::string receive(size_t count, const std::string& until = "", int timeoutMs = 5000) {
+            std::string received;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+            while (received.size() < count
+                   && (until.empty() || received.size() < until.size()
+                       || received.compare(received.size() - until.size(), until.size(), until) != 0)) {
+                int left = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now()).count());
+                pollfd entry{fd, POLLIN, 0};
+                if (left <= 0 || ::poll(&entry, 1, left) != 1) {
+                    break;
+                }
+                char buffer[4096];
+                ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+                if (n <= 0) {
+                    break;
+                }
+                received.append(buffer, static_cast<size_t>(n));
+            }
+            return received;
+        }
+
+        std::string command(const std::string& line) {
+            send(line + "\n");
+            return receive(SIZE_MAX, "\n.\n");
+        }
+
+        // True once the server closed the connection
+        bool closedByServer(int timeoutMs = 2000) {
+            pollfd entry{fd, POLLIN, 0};
+            if (::poll(&entry, 1, timeoutMs) != 1) {
+                return false;
+            }
+            char byte;
+            return ::recv(fd, &byte, 1, MSG_PEEK) == 0;
+        }
+    };
+
+    bool waitFor(const std::function<bool()>& condition) {
+        for (int i = 0; i < 500 && !condition(); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return condition();
+    }
+}
+
+// Fixture: a server on a per-process socket path, started against a mock simulator
+class ControlServerTest : public ::testing::Test {
+protected:
+    std::shared_ptr<StreamingMockSimulator> mockSim;
+    std::unique_ptr<ControlServer> server;
+    std::string path;
+
+    void SetUp() override {
+        path = "/tmp/athena_control_test_" + std::to_string(::getpid()) + ".sock";
+        mockSim = std::make_shared<StreamingMockSimulator>();
+        server = std::make_unique<ControlServer>(mockSim, path);
+        ASSERT_TRUE(server->start());
+    }
+
+    void TearDown() override {
+        server.reset();
+        ::unlink(path.c_str());
+    }
+};
+
+// Test that a command runs through the CLI and its response ends with the end marker
+TEST_F(ControlServerTest, Command_RespondsWithEndMarker) {
+    Client client(path);
+    ASSERT_GE(client.fd, 0);
+
+    std::string response = client.command("status");
+    EXPECT_NE(response.find("--- Step"), std::string::npos);
+    EXPECT_EQ(response.substr(response.size() - 3), "\n.\n");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::GET_STATUS);
+
+    response = client.command("submit-text hello socket");
+    EXPECT_EQ(response, "Text submitted.\n.\n");
+    EXPECT_EQ(mockSim->lastSubmittedText, "hello socket");
+
+    EXPECT_EQ(client.command("frobnicate"), "Unknown command: 'frobnicate'. Type 'help' for a list of commands.\n.\n");
+    EXPECT_EQ(client.command(""), ".\n");
+}
+
+// Test that several commands in one write are answered in order, and clients are served independently
+TEST_F(ControlServerTest, Commands_PipelinedAndConcurrentClients) {
+    Client first(path);
+    Client second(path);
+    ASSERT_GE(first.fd, 0);
+    ASSERT_GE(second.fd, 0);
+
+    first.send("save-state a.bin\r\nstop\n");
+    std::string response = first.receive(SIZE_MAX, "Stop request sent to simulation.\n.\n");
+    EXPECT_EQ(response, "Network State saved to a.bin\n.\nStop request sent to simulation.\n.\n");
+    EXPECT_EQ(mockSim->lastPath, "a.bin");
+
+    second.send("get-out"); // a partial line waits for the rest
+    EXPECT_EQ(second.receive(SIZE_MAX, "", 100), "");
+    second.send("put\n");
+    EXPECT_EQ(second.receive(SIZE_MAX, "\n.\n").rfind("Output: ", 0), 0u);
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::GET_OUTPUT);
+    EXPECT_TRUE(waitFor([&] { return server->getClientCount() == 2; }));
+}
+
+// Test that quit closes only the connection and leaves the simulation and server running
+TEST_F(ControlServerTest, Quit_ClosesConnectionOnly) {
+    Client client(path);
+    ASSERT_GE(client.fd, 0);
+    EXPECT_EQ(client.command("quit"), "Closing connection.\n.\n");
+    EXPECT_TRUE(client.closedByServer());
+    EXPECT_NE(mockSim->lastCall, MockSimulator::LastCall::REQUEST_STOP);
+    EXPECT_TRUE(waitFor([&] { return server->getClientCount() == 0; }));
+    EXPECT_TRUE(server->isRunning());
+
+    Client next(path);
+    ASSERT_GE(next.fd, 0);
+    EXPECT_EQ(next.command("submit-text again"), "Text submitted.\n.\n");
+}
+
+// Test that an unterminated line over the limit ends the connection while the client is still sending
+TEST_F(ControlServerTest, OverlongLine_ClosesConnection) {
+    Client client(path);
+    ASSERT_GE(client.fd, 0);
+    std::thread sender([&client]() {
+        std::string chunk(4096, 'x');
+        for (size_t sent = 0; sent < 4 * ControlServer::MAX_LINE_LENGTH; sent += chunk.size()) {
+            if (::send(client.fd, chunk.data(), chunk.size(), MSG_NOSIGNAL) < 0) {
+                break; // the server closed the connection
+            }
+        }
+    });
+    EXPECT_EQ(client.receive(SIZE_MAX, "\n.\n"), "Error: Command line too long.\n.\n");
+    EXPECT_TRUE(client.closedByServer());
+    sender.join();
+}
+
+// Test that more complete lines than fit under the limit in one read are all answered, in order
+TEST_F(ControlServerTest, ManyPipelinedLines_AllAnswered) {
+    Client client(path);
+    ASSERT_GE(client.fd, 0);
+    const std::string line = "submit-text " + std::string(50, 'y') + "\n";
+    const size_t lines = 2 * ControlServer::MAX_LINE_LENGTH / line.size();
+    std::thread sender([&]() {
+        std::string all;
+        for (size_t i = 0; i < lines; ++i) {
+            all += line;
+        }
+        ::send(client.fd, all.data(), all.size(), MSG_NOSIGNAL);
+    });
+    const std::string answer = "Text submitted.\n.\n";
+    std::string response = client.receive(lines * answer.size());
+    sender.join();
+    EXPECT_EQ(response.size(), lines * answer.size());
+    EXPECT_EQ(response.find("Error"), std::string::npos);
+}
+
+// Test that stream-output turns the connection into a raw stream of the text channel
+TEST_F(ControlServerTest, StreamOutput_DeliversTextAsItArrives) {
+    Client client(path);
+    ASSERT_GE(client.fd, 0);
+    EXPECT_EQ(client.command("stream-output 2"), "Streaming text output, disconnect to stop.\n.\n");
+    ASSERT_TRUE(waitFor([&] { return mockSim->subscription != nullptr; }));
+
+    const std::string text = "streamed";
+    std::vector<int> messages(text.size());
+    SampleCodec::bytesToMessages(reinterpret_cast<const uint8_t*>(text.data()), text.size(), messages.data());
+    for (int message : messages) {
+        mockSim->channel.message(message);
+    }
+    mockSim->subscription->notifyIfReady(mockSim->subscription->getBatchSize()); // a step boundary
+    EXPECT_EQ(client.receive(text.size()), text);
+
+    client.send("status\n"); // ignored on a stream
+    EXPECT_EQ(client.receive(SIZE_MAX, "", 200), "");
+
+    mockSim->channel.message(messages[0]); // below the batch size, delivered by the idle drain
+    EXPECT_EQ(client.receive(1), "s");
+}
+
+// Test that shutdown stops the simulation and the server and removes the socket file
+TEST_F(ControlServerTest, Shutdown_StopsServer) {
+    Client client(path);
+    ASSERT_GE(client.fd, 0);
+    EXPECT_EQ(client.command("shutdown"), "Control server shutting down.\n.\n");
+    EXPECT_EQ(mockSim->lastCall, MockSimulator::LastCall::REQUEST_STOP);
+    EXPECT_TRUE(waitFor([&] { return !server->isRunning(); }));
+    struct stat info{};
+    EXPECT_NE(::lstat(path.c_str(), &info), 0);
+}
+
+// Test that a second server does not take over a live socket or replace a regular file
+TEST_F(ControlServerTest, Start_RefusesTakenPaths) {
+    ControlServer second(mockSim, path);
+    EXPECT_FALSE(second.start());
+    Client client(path);
+    ASSERT_GE(client.fd, 0);
+    EXPECT_EQ(client.command("submit-text still here"), "Text submitted.\n.\n");
+
+    std::string filePath = path + ".file";
+    std::ofstream(filePath) << "keep";
+    ControlServer onFile(mockSim, filePath);
+    EXPECT_FALSE(onFile.start());
+    EXPECT_TRUE(std::ifstream(filePath).good());
+    std::remove(filePath.c_str());
+}
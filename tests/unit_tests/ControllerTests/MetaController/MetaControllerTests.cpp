@@ -12,6 +12,8 @@
 // If not, full paths from src/headers/util/ or src/headers/layers/ might be needed.
 #include "util/IdRange.h" 
 #include "layers/LayerType.h" 
+#include "operators/Operator.h"
+#include "util/ConnectionIndex.h"
 
 #include <vector>
 #include <string>
@@ -854,4 +856,70 @@ TEST_F(MetaControllerTest, InputText_SendsToInputLayer) {
     MetaController mc_empty(""); // No InputLayer
     bool result_empty_mc = mc_empty.inputText(test_input);
     EXPECT_FALSE(result_empty_mc); 
-}
\ No newline at end of file
+}
+
+// --- Group 7: Reverse Connection Index ---
+
+namespace {
+    // Counts the connections in the network pointing at targetId by scanning every operator
+    size_t countInboundConnections(const MetaController& mc, uint32_t targetId) {
+        size_t count = 0;
+        for (const auto& layer : mc.getAllLayers()) {
+            for (const auto& entry : layer->getAllOperators()) {
+                const auto& connections = entry.second->getOutputConnections();
+                for (int d = 0; d <= static_cast<int>(connections.maxIdx()); ++d) {
+                    const auto* targets = connections.get(d);
+                    if (targets != nullptr) {
+                        count += targets->count(targetId);
+                    }
+                }
+            }
+        }
+        return count;
+    }
+}
+
+TEST_F(MetaControllerTest, ConnectionIndex_MatchesNetworkConnections) {
+    MetaController mc(20, rand);
+    EXPECT_FALSE(mc.isConnectionIndexEnabled());
+    EXPECT_EQ(mc.getConnectionIndex(), nullptr);
+
+    mc.setConnectionIndexEnabled(true);
+    ASSERT_NE(mc.getConnectionIndex(), nullptr);
+
+    for (uint32_t id = 3; id < 26; ++id) {
+        EXPECT_EQ(mc.getConnectionIndex()->getInDegree(id), countInboundConnections(mc, id)) << "operator " << id;
+    }
+
+    // Connection updates keep the index in sync
+    mc.handleAddConnection(6, {25, 9});
+    mc.handleMoveConnection(6, {25, 9, 11});
+    EXPECT_EQ(mc.getConnectionIndex()->getInDegree(25), countInboundConnections(mc, 25));
+    mc.handleRemoveConnection(6, {25, 11});
+    EXPECT_EQ(mc.getConnectionIndex()->getInDegree(25), countInboundConnections(mc, 25));
+}
+
+TEST_F(MetaControllerTest, ConnectionIndex_DeleteOperatorPurgesInboundConnections) {
+    MetaController mc(20, rand);
+    mc.setConnectionIndexEnabled(true);
+
+    const uint32_t victim = 10;
+    mc.handleAddConnection(6, {static_cast<int>(victim), 4}); // guarantee at least one inbound edge
+    ASSERT_GT(countInboundConnections(mc, victim), 0u);
+
+    mc.handleDeleteOperator(victim);
+
+    EXPECT_EQ(countInboundConnections(mc, victim), 0u);
+    EXPECT_EQ(mc.getConnectionIndex()->getInDegree(victim), 0u);
+}
+
+TEST_F(MetaControllerTest, ConnectionIndex_DisabledDeleteLeavesInboundConnections) {
+    MetaController mc(20, rand);
+    const uint32_t victim = 10;
+    mc.handleAddConnection(6, {static_cast<int>(victim), 4});
+
+    mc.handleDeleteOperator(victim);
+
+    // without the index, dangling targets stay until noticed at delivery time
+    EXPECT_GT(countInboundConnections(mc, victim), 0u);
+}
@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include "util/AllocationHooks.h" // installs the counting operator new for this test binary
+#include "helpers/AllocationTestHelpers.h"
+#include "controllers/MetaController.h"
+#include "controllers/TimeController.h"
+#include "controllers/UpdateController.h"
+#include "operators/Operator.h"
+#include "util/OperatorIdSet.h"
+#include "util/PhiloxRandomSource.h"
+#include "Scheduler.h"
+#include "UpdateScheduler.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Steady-state step loop on a fixed network: a ring of ADD operators that keeps itself active.
+class StepAllocationTest : public ::testing::Test {
+protected:
+    static constexpr uint32_t FIRST_ID = 6;      // after Input 0-2 and Output 3-5
+    static constexpr int NUM_OPERATORS = 64;
+
+    std::unique_ptr<Randomizer> randomizer;
+    std::unique_ptr<MetaController> metaController;
+    std::unique_ptr<UpdateController> updateController;
+    std::unique_ptr<TimeController> timeController;
+
+    void SetUp() override {
+        randomizer = std::make_unique<Randomizer>(std::make_unique<PhiloxRandomSource>(42));
+        metaController = std::make_unique<MetaController>(0, randomizer.get());
+        updateController = std::make_unique<UpdateController>(*metaController);
+        timeController = std::make_unique<TimeController>(*metaController);
+        Scheduler::ResetInstances();
+        UpdateScheduler::ResetInstances();
+        Scheduler::CreateInstance(timeController.get());
+        UpdateScheduler::CreateInstance(updateController.get());
+
+        for (int i = 0; i < NUM_OPERATORS; ++i) {
+            metaController->handleCreateOperator({static_cast<int>(Operator::Type::ADD)});
+        }
+        // Each operator feeds its neighbour and one further along the ring, at different distances
+        for (int i = 0; i < NUM_OPERATORS; ++i) {
+            int id = static_cast<int>(FIRST_ID) + i;
+            int next = static_cast<int>(FIRST_ID) + (i + 1) % NUM_OPERATORS;
+            int skip = static_cast<int>(FIRST_ID) + (i + 7) % NUM_OPERATORS;
+            metaController->handleAddConnection(id, {next, 0});
+            metaController->handleAddConnection(id, {skip, 2});
+        }
+        timeController->deliverAndFlagOperator(FIRST_ID, 1);
+    }
+
+    void TearDown() override {
+        Scheduler::ResetInstances();
+        UpdateScheduler::ResetInstances();
+    }
+
+    void step() {
+        timeController->processCurrentStep();
+        timeController->advanceStep();
+    }
+};
+
+TEST(AllocationCounterTest, CountsAllocationsOnCallingThread) {
+    ASSERT_TRUE(AllocationCounter::isInstalled());
+    uint64_t count = AllocationTestHelpers::countAllocations([] {
+        std::unique_ptr<int> value(new int(5));
+        std::vector<int> values(16);
+    });
+    EXPECT_EQ(count, 2u);
+    EXPECT_NO_ALLOCATIONS(int local = 3; (void)local);
+    EXPECT_FALSE(AllocationTestHelpers::allocatesNothing([] { std::make_unique<int>(1); }));
+}
+
+TEST(OperatorIdSetTest, InsertClearKeepsOrderAndCapacity) {
+    OperatorIdSet set;
+    EXPECT_TRUE(set.insert(9));
+    EXPECT_TRUE(set.insert(2));
+    EXPECT_FALSE(set.insert(9));
+    EXPECT_EQ(std::vector<uint32_t>(set.begin(), set.end()), (std::vector<uint32_t>{9, 2}));
+    EXPECT_TRUE(set.contains(2));
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_FALSE(set.contains(1000));
+
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(9));
+    EXPECT_NO_ALLOCATIONS(set.insert(2); set.insert(9); set.clear());
+}
+
+TEST_F(StepAllocationTest, SteadyStateStepsDoNotAllocate) {
+    // Warm-up: payload vectors, the operator set and the operators' buffers reach their working size
+    for (int i = 0; i < 200; ++i) {
+        step();
+    }
+    ASSERT_GT(timeController->getCurrentStepPayloadCount(), 0u) << "network went quiet, the test would be vacuous";
+
+    EXPECT_NO_ALLOCATIONS(for (int i = 0; i < 100; ++i) { step(); });
+    EXPECT_GT(timeController->getCurrentStepPayloadCount(), 0u);
+}
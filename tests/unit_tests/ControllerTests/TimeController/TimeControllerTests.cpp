@@ -6,9 +6,11 @@
 #include "util/PseudoRandomSource.h"
 #include "Scheduler.h"
 #include "Payload.h"
+#include "util/OperatorProfiler.h"
 #include <memory>
 #include <vector>
 #include <string>
+#include <fstream>
 
 // Test fixture for TimeController tests
 class TimeControllerTest : public ::testing::Test {
@@ -121,6 +123,85 @@ TEST_F(TimeControllerTest, ProcessCurrentStepCallsTraverseOnPayloads) {
 }
 
 
+TEST_F(TimeControllerTest, ProcessCurrentStepRecordsStepSample) {
+    // ARRANGE: One traveling payload, one already inactive payload, and one flagged operator.
+    mockTimeController->baseAddToNextStepPayloads(Payload(100, 1));
+    mockTimeController->baseAddToNextStepPayloads(Payload(100, 2, 0, false));
+    mockTimeController->baseAdvanceStep();
+    mockTimeController->baseDeliverAndFlagOperator(5, 1);
+
+    // ACT
+    mockTimeController->baseProcessCurrentStep();
+
+    // ASSERT: Counters describe this step only, the phases the Simulator times are left at 0.
+    StepSample sample = mockTimeController->baseGetLastStepSample();
+    EXPECT_EQ(sample.payloadsDeactivated, 1u);
+    EXPECT_EQ(sample.operatorsFired, 0u); // flagged, but the mock operator emits nothing
+    EXPECT_EQ(sample.messagesDelivered, 0u); // the mock's traversal delivers nothing
+    EXPECT_EQ(sample.payloadsCreated, 0u);
+    EXPECT_EQ(sample.updatesNs, 0u);
+    EXPECT_EQ(sample.advanceNs, 0u);
+    EXPECT_EQ(mockTimeController->baseGetCurrentStepPayloadCount(), 1);
+}
+
+TEST_F(TimeControllerTest, AttachedProfilerCountsDeliveriesAndTraversals) {
+    OperatorProfiler profiler;
+    mockTimeController->setOperatorProfiler(&profiler);
+    mockTimeController->baseAddToNextStepPayloads(Payload(100, 1));
+    mockTimeController->baseAdvanceStep();
+    mockTimeController->baseDeliverAndFlagOperator(5, 1);
+
+    mockTimeController->baseProcessCurrentStep();
+    mockTimeController->setOperatorProfiler(nullptr);
+    mockTimeController->baseDeliverAndFlagOperator(5, 1); // detached, not counted
+
+    EXPECT_EQ(profiler.getCounters(5).deliveries, 1u);
+    EXPECT_EQ(profiler.getCounters(5).fires, 0u); // the mock's processOpData emits nothing
+    EXPECT_EQ(profiler.getCounters(1).traversals, 1u);
+}
+
+TEST_F(TimeControllerTest, EmplaceNextStepPayloadAddsPayloadForNextStep) {
+    // ACT: Emplace a payload the way operators do from processData.
+    mockTimeController->baseEmplaceNextStepPayload(42, 7);
+
+    // ASSERT: It is scheduled for next step, then becomes current after advancing.
+    EXPECT_EQ(mockTimeController->baseGetNextStepPayloadCount(), 1);
+    EXPECT_EQ(mockTimeController->baseGetCurrentStepPayloadCount(), 0);
+    mockTimeController->baseAdvanceStep();
+    EXPECT_EQ(mockTimeController->baseGetNextStepPayloadCount(), 0);
+    EXPECT_EQ(mockTimeController->baseGetCurrentStepPayloadCount(), 1);
+}
+
+TEST_F(TimeControllerTest, AdvanceStepReservesFromLastStepEmission) {
+    // ARRANGE: Emit a burst of payloads during the step.
+    const size_t emitted = 100;
+    for (size_t i = 0; i < emitted; ++i) {
+        mockTimeController->baseEmplaceNextStepPayload(static_cast<int>(i), 1);
+    }
+
+    // ACT
+    mockTimeController->baseAdvanceStep();
+
+    // ASSERT: The emission count is recorded and the next step's list is pre-reserved with headroom.
+    EXPECT_EQ(mockTimeController->baseGetLastStepEmittedCount(), emitted);
+    EXPECT_EQ(mockTimeController->baseGetNextStepPayloadCount(), 0);
+    EXPECT_GE(mockTimeController->nextStepPayloadCapacity(), emitted + emitted / 2);
+
+    // ACT 2: Emitting the same amount again must not need to grow the list.
+    size_t capacityBefore = mockTimeController->nextStepPayloadCapacity();
+    for (size_t i = 0; i < emitted; ++i) {
+        mockTimeController->baseEmplaceNextStepPayload(static_cast<int>(i), 1);
+    }
+    EXPECT_EQ(mockTimeController->nextStepPayloadCapacity(), capacityBefore);
+}
+
+TEST_F(TimeControllerTest, ReserveNextStepPayloadsGrowsCapacity) {
+    mockTimeController->baseReserveNextStepPayloads(64);
+    EXPECT_GE(mockTimeController->nextStepPayloadCapacity(), 64u);
+    EXPECT_EQ(mockTimeController->baseGetNextStepPayloadCount(), 0);
+}
+
+
 // --- Persistence Tests (`saveState` and `loadState`) ---
 
 TEST_F(TimeControllerTest, SaveAndLoadStateRoundTrip) {
@@ -176,4 +257,19 @@ TEST_F(TimeControllerTest, LoadStateWithNonExistentFileReturnsFalse) {
 
     // ACT & ASSERT: loadState should return false.
     EXPECT_FALSE(mockTimeController->baseLoadState(badPath));
-}
\ No newline at end of file
+}
+
+TEST_F(TimeControllerTest, LoadStateRejectsOperatorIdOutsideTheNetwork) {
+    // ARRANGE: A state file whose only content is one flagged operator with ID 0xFFFFFFFF.
+    {
+        std::ofstream out(tempStateFile, std::ios::binary);
+        const unsigned char header[24] = {0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 1};
+        const unsigned char id[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(id), sizeof(id));
+    }
+
+    // ACT & ASSERT: the ID belongs to no layer, so loading fails instead of sizing the set to it.
+    EXPECT_FALSE(mockTimeController->baseLoadState(tempStateFile));
+    EXPECT_EQ(mockTimeController->baseGetCurrentStepPayloadCount(), 0);
+}
@@ -0,0 +1,290 @@
+#include "gtest/gtest.h"
+#include "controllers/UpdateController.h"
+#include "controllers/MetaController.h"
+#include "layers/Layer.h"
+#include "operators/AddOperator.h"
+#include "util/Randomizer.h"
+#include "util/PseudoRandomSource.h"
+#include "UpdateEvent.h"
+#include "util/OperatorIdSet.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+namespace {
+    // MetaController(1, ...) gives Input 0-2, Output 3-5 and a single internal AddOperator
+    const uint32_t INTERNAL_OP_ID = 6;
+    // Target far outside every layer so random initial connections never collide with it
+    const int TEST_TARGET_ID = 100000;
+}
+
+// Test Fixture for UpdateController tests, uses a real MetaController so effects can be inspected
+class UpdateControllerTest : public ::testing::Test {
+protected:
+    std::unique_ptr<Randomizer> rand;
+    std::unique_ptr<MetaController> metaController;
+    std::unique_ptr<UpdateController> updateController;
+
+    void SetUp() override {
+        rand = std::make_unique<Randomizer>(std::make_unique<PseudoRandomSource>());
+        metaController = std::make_unique<MetaController>(1, rand.get());
+        updateController = std::make_unique<UpdateController>(*metaController);
+    }
+
+    Operator* internalOp() const {
+        Layer* layer = metaController->findLayerForOperator(INTERNAL_OP_ID);
+        return layer ? layer->getOperator(INTERNAL_OP_ID) : nullptr;
+    }
+
+    bool hasConnection(int targetId, int distance) const {
+        const auto* targets = internalOp()->getOutputConnections().get(distance);
+        return targets != nullptr && targets->count(static_cast<uint32_t>(targetId)) > 0;
+    }
+};
+
+// Test that an add followed by a remove of the same connection collapses to the remove
+TEST_F(UpdateControllerTest, AddThenRemoveSameConnection_CoalescesToRemove) {
+    ASSERT_NE(internalOp(), nullptr);
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::REMOVE_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+
+    updateController->ProcessUpdates();
+
+    EXPECT_FALSE(hasConnection(TEST_TARGET_ID, 7));
+    EXPECT_EQ(updateController->LastReceivedCount(), 2u);
+    EXPECT_EQ(updateController->LastAppliedCount(), 1u);
+    EXPECT_TRUE(updateController->IsQueueEmpty());
+}
+
+// Test that a remove followed by an add of the same connection keeps the connection
+TEST_F(UpdateControllerTest, RemoveThenAddSameConnection_KeepsConnection) {
+    updateController->AddToQueue(UpdateEvent(UpdateType::REMOVE_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+
+    updateController->ProcessUpdates();
+
+    EXPECT_TRUE(hasConnection(TEST_TARGET_ID, 7));
+    EXPECT_EQ(updateController->LastAppliedCount(), 1u);
+}
+
+// Test that repeated changes of one parameter keep only the last value
+TEST_F(UpdateControllerTest, RepeatedParameterChange_LastValueWins) {
+    updateController->AddToQueue(UpdateEvent(UpdateType::CHANGE_OPERATOR_PARAMETER, INTERNAL_OP_ID, {0, 5}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::CHANGE_OPERATOR_PARAMETER, INTERNAL_OP_ID, {1, 3}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::CHANGE_OPERATOR_PARAMETER, INTERNAL_OP_ID, {0, 9}));
+
+    updateController->ProcessUpdates();
+
+    auto* addOp = dynamic_cast<AddOperator*>(internalOp());
+    ASSERT_NE(addOp, nullptr);
+    EXPECT_EQ(addOp->getWeight(), 9);
+    EXPECT_EQ(addOp->getThreshold(), 3);
+    EXPECT_EQ(updateController->LastReceivedCount(), 3u);
+    EXPECT_EQ(updateController->LastAppliedCount(), 2u);
+}
+
+// Test that add/remove events are not merged across a move of the same connection
+TEST_F(UpdateControllerTest, MoveConnection_IsBarrierForMerging) {
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::MOVE_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7, 9}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::REMOVE_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+
+    updateController->ProcessUpdates();
+
+    EXPECT_FALSE(hasConnection(TEST_TARGET_ID, 7));
+    EXPECT_TRUE(hasConnection(TEST_TARGET_ID, 9));
+    EXPECT_EQ(updateController->LastAppliedCount(), 3u);
+}
+
+// Test that events for different operators interleaved in the queue are all applied
+TEST_F(UpdateControllerTest, InterleavedOperators_AllApplied) {
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, 0, {TEST_TARGET_ID, 4}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 8}));
+
+    updateController->ProcessUpdates();
+
+    EXPECT_TRUE(hasConnection(TEST_TARGET_ID, 7));
+    EXPECT_TRUE(hasConnection(TEST_TARGET_ID, 8));
+    const auto* inTargets = metaController->findLayerForOperator(0)->getOperator(0)->getOutputConnections().get(4);
+    ASSERT_NE(inTargets, nullptr);
+    EXPECT_EQ(inTargets->count(TEST_TARGET_ID), 1u);
+    EXPECT_EQ(updateController->LastAppliedCount(), 3u);
+}
+
+// Test that events before a delete are applied before it, and events after it see the deletion
+TEST_F(UpdateControllerTest, DeleteOperator_ActsAsBarrier) {
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::DELETE_OPERATOR, INTERNAL_OP_ID));
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 8}));
+
+    updateController->ProcessUpdates();
+
+    EXPECT_EQ(internalOp(), nullptr);
+    EXPECT_EQ(updateController->LastReceivedCount(), 3u);
+}
+
+// Test that disabling batch mode applies every event on its own
+TEST_F(UpdateControllerTest, CoalescingDisabled_AppliesEveryEvent) {
+    updateController->SetCoalescing(false);
+    EXPECT_FALSE(updateController->IsCoalescing());
+
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::REMOVE_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+
+    updateController->ProcessUpdates();
+
+    EXPECT_FALSE(hasConnection(TEST_TARGET_ID, 7));
+    EXPECT_EQ(updateController->LastReceivedCount(), 2u);
+    EXPECT_EQ(updateController->LastAppliedCount(), 2u);
+}
+
+// Test that the parallel phase gives the same network as the serial one
+TEST_F(UpdateControllerTest, ParallelPhase_MatchesSerialResult) {
+    const int numInternalOps = 64;
+    Randomizer serialRand(std::make_unique<PseudoRandomSource>());
+    MetaController serialMeta(numInternalOps, &serialRand);
+    UpdateController serialController(serialMeta);
+    serialController.SetWorkerThreads(0);
+
+    Randomizer parallelRand(std::make_unique<PseudoRandomSource>());
+    MetaController parallelMeta(numInternalOps, &parallelRand);
+    UpdateController parallelController(parallelMeta);
+    parallelController.SetWorkerThreads(3);
+    parallelController.SetParallelThreshold(1);
+
+    // Drop the random initial connections so both networks start identical
+    auto clearConnections = [](MetaController& meta) {
+        for (const auto& layer : meta.getAllLayers()) {
+            for (const auto& entry : layer->getAllOperators()) {
+                const auto& connections = entry.second->getOutputConnections();
+                for (int d = 0; d <= static_cast<int>(connections.maxIdx()); ++d) {
+                    if (const auto* targets = connections.get(d)) {
+                        std::vector<uint32_t> ids(targets->begin(), targets->end());
+                        for (uint32_t id : ids) {
+                            layer->removeOperatorConnection(entry.first, {static_cast<int>(id), d});
+                        }
+                    }
+                }
+            }
+        }
+    };
+    clearConnections(serialMeta);
+    clearConnections(parallelMeta);
+
+    for (UpdateController* controller : {&serialController, &parallelController}) {
+        for (int round = 0; round < 4; ++round) {
+            for (uint32_t id = 6; id < 6 + numInternalOps; ++id) {
+                int target = static_cast<int>(id) + 1;
+                controller->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, id, {target, round}));
+                controller->AddToQueue(UpdateEvent(UpdateType::CHANGE_OPERATOR_PARAMETER, id, {0, round + static_cast<int>(id)}));
+                if (round % 2 == 1) {
+                    controller->AddToQueue(UpdateEvent(UpdateType::REMOVE_CONNECTION, id, {target, round - 1}));
+                }
+            }
+        }
+        controller->ProcessUpdates();
+    }
+
+    EXPECT_EQ(serialController.LastAppliedCount(), parallelController.LastAppliedCount());
+    EXPECT_EQ(serialMeta.getOperatorsAsJson(false), parallelMeta.getOperatorsAsJson(false));
+    EXPECT_TRUE(parallelController.IsQueueEmpty());
+}
+
+// Test that staged events are only applied when asked, a subset first, each subset in queue order
+TEST_F(UpdateControllerTest, StagedUpdates_AppliedBySubsetInOrder) {
+    Operator* inOp = metaController->findLayerForOperator(0)->getOperator(0);
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, 0, {TEST_TARGET_ID, 2}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::REMOVE_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+
+    EXPECT_EQ(updateController->StageUpdates(), 3u);
+    EXPECT_TRUE(updateController->IsQueueEmpty());
+    EXPECT_EQ(updateController->StagedCount(), 3u);
+    EXPECT_FALSE(updateController->HasStagedLifecycleEvents());
+    const auto* inTargets = inOp->getOutputConnections().get(2);
+    EXPECT_TRUE(inTargets == nullptr || inTargets->count(TEST_TARGET_ID) == 0);
+
+    OperatorIdSet internalOnly;
+    internalOnly.insert(INTERNAL_OP_ID);
+    EXPECT_EQ(updateController->ApplyStagedFor(internalOnly), 2u);
+    EXPECT_FALSE(hasConnection(TEST_TARGET_ID, 7)); // add then remove, in order
+    EXPECT_EQ(updateController->StagedCount(), 1u);
+    inTargets = inOp->getOutputConnections().get(2);
+    EXPECT_TRUE(inTargets == nullptr || inTargets->count(TEST_TARGET_ID) == 0);
+
+    updateController->ApplyStaged();
+    inTargets = inOp->getOutputConnections().get(2);
+    ASSERT_NE(inTargets, nullptr);
+    EXPECT_EQ(inTargets->count(TEST_TARGET_ID), 1u);
+    EXPECT_EQ(updateController->StagedCount(), 0u);
+    EXPECT_EQ(updateController->LastReceivedCount(), 3u);
+    EXPECT_EQ(updateController->LastAppliedCount(), 2u); // the internal operator's pair coalesced
+}
+
+// Test that a staged delete makes a subset apply everything, keeping the barrier order
+TEST_F(UpdateControllerTest, StagedLifecycleEvent_AppliesEverything) {
+    updateController->AddToQueue(UpdateEvent(UpdateType::CHANGE_OPERATOR_PARAMETER, 0, {0, 1}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::DELETE_OPERATOR, INTERNAL_OP_ID));
+    updateController->StageUpdates();
+    EXPECT_TRUE(updateController->HasStagedLifecycleEvents());
+
+    OperatorIdSet none;
+    EXPECT_EQ(updateController->ApplyStagedFor(none), 2u);
+    EXPECT_EQ(internalOp(), nullptr);
+    EXPECT_EQ(updateController->StagedCount(), 0u);
+    EXPECT_FALSE(updateController->HasStagedLifecycleEvents());
+}
+
+// Test that events loaded on one thread are processed on another, and a failed load leaves nothing queued
+TEST_F(UpdateControllerTest, LoadState_VisibleToProcessingThread) {
+    const std::string path = "update_controller_load_thread_test.bin";
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    ASSERT_TRUE(updateController->saveState(path));
+
+    UpdateController loaded(*metaController);
+    bool loadedOk = false;
+    std::thread loader([&]() { loadedOk = loaded.loadState(path); });
+    loader.join();
+    ASSERT_TRUE(loadedOk);
+    EXPECT_EQ(loaded.QueueSize(), 1u);
+    loaded.ProcessUpdates();
+    EXPECT_TRUE(hasConnection(TEST_TARGET_ID, 7));
+
+    {
+        std::ofstream corrupt(path, std::ios::binary | std::ios::app);
+        corrupt.put('\0'); // a block of declared size 0 after the valid event
+    }
+    UpdateController failed(*metaController);
+    size_t queuedAfterFailure = 1;
+    std::thread failingLoader([&]() {
+        loadedOk = failed.loadState(path);
+        queuedAfterFailure = failed.QueueSize();
+    });
+    failingLoader.join();
+    EXPECT_FALSE(loadedOk);
+    EXPECT_EQ(queuedAfterFailure, 0u);
+    EXPECT_EQ(failed.QueueSize(), 0u);
+    std::remove(path.c_str());
+}
+
+// Test that a save taken between StageUpdates and ApplyStaged keeps the staged events, before the queued ones
+TEST_F(UpdateControllerTest, SaveState_KeepsStagedEventsInApplyOrder) {
+    const std::string path = "update_controller_staged_save_test.bin";
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    updateController->AddToQueue(UpdateEvent(UpdateType::REMOVE_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    ASSERT_EQ(updateController->StageUpdates(), 2u);
+    updateController->AddToQueue(UpdateEvent(UpdateType::ADD_CONNECTION, INTERNAL_OP_ID, {TEST_TARGET_ID, 7}));
+    ASSERT_TRUE(updateController->saveState(path));
+
+    UpdateController loaded(*metaController);
+    ASSERT_TRUE(loaded.loadState(path));
+    std::remove(path.c_str());
+    EXPECT_EQ(loaded.QueueSize(), 3u);
+    loaded.ProcessUpdates();
+    EXPECT_TRUE(hasConnection(TEST_TARGET_ID, 7)); // add, remove, add: the queued add was last
+}
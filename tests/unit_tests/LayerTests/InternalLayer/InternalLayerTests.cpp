@@ -7,6 +7,7 @@
 #include "headers/operators/InOperator.h" // Needed for equality test
 #include "helpers/MockOperator.h"       // For verifying operator interactions if needed
 #include "headers/util/Serializer.h" // For manually crafting byte streams
+#include "headers/util/PhiloxRandomSource.h"
 
 #include <vector>
 #include <memory> // For std::unique_ptr
@@ -176,6 +177,28 @@ TEST_F(InternalLayerTest, RandomInit_NullConnectionRange) {
     EXPECT_EQ(mockRandomizer->getIntCallCount(), 3);
 }
 
+// Test that chunked randomization is reproducible per seed and independent of the thread count
+TEST_F(InternalLayerTest, RandomInit_ChunkedStreams_IdenticalAcrossThreadCounts) {
+    const uint32_t opCount = InternalLayer::RANDOM_INIT_CHUNK_SIZE + 5; // two chunks, the last partial
+    IdRange connectionRange(0, opCount - 1);
+
+    auto build = [&](size_t threads, uint64_t seed) {
+        auto layer = std::make_unique<InternalLayer>(false, new IdRange(0, opCount - 1));
+        layer->setRandomInitThreads(threads);
+        Randomizer randomizer(std::make_unique<PhiloxRandomSource>(seed));
+        layer->randomInit(&connectionRange, &randomizer);
+        return layer;
+    };
+
+    auto sequential = build(1, 42);
+    auto parallel = build(4, 42);
+    auto reseeded = build(4, 43);
+
+    EXPECT_EQ(sequential->getOpCount(), opCount);
+    EXPECT_EQ(sequential->serializeToBytes(), parallel->serializeToBytes());
+    EXPECT_NE(sequential->serializeToBytes(), reseeded->serializeToBytes());
+}
+
 // --- Deserialization Constructor Tests ---
 TEST_F(InternalLayerTest, DeserializeConstructor_EmptyLayer_Dynamic) {
     bool isFinalFromFile = false;
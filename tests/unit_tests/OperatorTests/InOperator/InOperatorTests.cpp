@@ -163,6 +163,19 @@ TEST_F(InOperatorTest, MessageInt_MultiplePositiveValues) {
     EXPECT_TRUE(compareAccumulatedData(expected, getAccumulatedDataDirect(*op)));
 }
 
+TEST_F(InOperatorTest, MessageBatch_AppendsInOrderUpToLimit) {
+    const int first[] = {7, -3, 0};
+    op->messageBatch(first, 3);
+    op->message(5);
+    std::vector<int> expected = {7, -3, 0, 5};
+    EXPECT_TRUE(compareAccumulatedData(expected, getAccumulatedDataDirect(*op)));
+
+    // a batch past the per-step bound is cut off, like single messages
+    std::vector<int> large(InOperator::MAX_ACCUMULATED_DATA, 1);
+    op->messageBatch(large.data(), large.size());
+    EXPECT_EQ(getAccumulatedDataDirect(*op).size(), InOperator::MAX_ACCUMULATED_DATA);
+}
+
 TEST_F(InOperatorTest, MessageInt_NoMessagesBeforeChecking) {
     std::vector<int> expected = {};
     EXPECT_TRUE(compareAccumulatedData(expected, getAccumulatedDataDirect(*op)));
@@ -353,6 +366,37 @@ TEST_F(InOperatorTest, ProcessData_WithNoConnections_ClearsAccumulatedData) {
     EXPECT_TRUE(getAccumulatedDataDirect(*op).empty());
 }
 
+TEST_F(InOperatorTest, MessageInt_StopsAccumulatingAtLimit) {
+    for (size_t i = 0; i < InOperator::MAX_ACCUMULATED_DATA + 10; ++i) {
+        op->message(1);
+    }
+    EXPECT_EQ(getAccumulatedDataDirect(*op).size(), InOperator::MAX_ACCUMULATED_DATA);
+
+    // the bound is per step, processing frees room for new messages
+    op->processData();
+    op->message(5);
+    std::vector<int> expected = {5};
+    EXPECT_TRUE(compareAccumulatedData(expected, getAccumulatedDataDirect(*op)));
+}
+
+TEST_F(InOperatorTest, MessageInt_DroppedValuesCountedAtBoundary) {
+    for (size_t i = 0; i < InOperator::MAX_ACCUMULATED_DATA; ++i) {
+        op->message(1);
+    }
+    EXPECT_EQ(getAccumulatedDataDirect(*op).size(), InOperator::MAX_ACCUMULATED_DATA);
+    EXPECT_EQ(op->getDroppedCount(), 0u); // exactly at the limit nothing is lost
+
+    op->message(2);
+    EXPECT_EQ(op->getDroppedCount(), 1u);
+
+    // batches count only the part past the limit
+    op->processData();
+    std::vector<int> batch(InOperator::MAX_ACCUMULATED_DATA + 3, 1);
+    op->messageBatch(batch.data(), batch.size());
+    EXPECT_EQ(getAccumulatedDataDirect(*op).size(), InOperator::MAX_ACCUMULATED_DATA);
+    EXPECT_EQ(op->getDroppedCount(), 4u);
+}
+
 // --- Other Method Tests ---
 TEST_F(InOperatorTest, GetOpType_ReturnsCorrectType) {
     EXPECT_EQ(op->getOpType(), Operator::Type::IN);
@@ -3,6 +3,7 @@
 #include "headers/operators/Operator.h"
 #include <memory>
 #include "headers/util/DynamicArray.h"
+#include "headers/util/ConnectionIndex.h"
 #include <unordered_set>
 
 class OperatorAddConnectionTest : public ::testing::Test {
@@ -108,3 +109,25 @@ TEST_F(OperatorAddConnectionTest, AddConnectionInternalZeroDistance) {
     ASSERT_EQ(bucket->size(), 1);
     EXPECT_EQ(bucket->count(600), 1);
 }
+
+TEST_F(OperatorAddConnectionTest, SetConnectionIndexAgainReRegistersAfterClear) {
+    std::unique_ptr<MockOperator> op = std::make_unique<MockOperator>(1);
+    op->addConnectionInternal(100, 2);
+    op->addConnectionInternal(101, 3);
+
+    ConnectionIndex index;
+    op->setConnectionIndex(&index);
+    ASSERT_EQ(index.getEdgeCount(), 2u);
+
+    op->setConnectionIndex(&index); // same index, still populated: no duplicates
+    EXPECT_EQ(index.getEdgeCount(), 2u);
+
+    index.clear();
+    op->setConnectionIndex(&index); // same index, emptied: the edges come back
+    EXPECT_EQ(index.getEdgeCount(), 2u);
+    EXPECT_EQ(index.getInDegree(100), 1u);
+    EXPECT_EQ(index.getInDegree(101), 1u);
+
+    op->setConnectionIndex(nullptr);
+    EXPECT_EQ(index.getEdgeCount(), 0u);
+}
@@ -10,6 +10,7 @@
 #include <string> // Required for std::string
 #include <vector> // Required for std::vector
 #include <cstddef> // Required for std::byte
+#include <thread> // For the concurrent drain test
 // #include "nlohmann/json.hpp" // Removed this include
 
 // Anonymous namespace for helper functions specific to this test file
@@ -309,6 +310,56 @@ TEST_F(OutOperatorTest, ProcessDataOnEmptyBufferHasNoEffect) {
     ASSERT_FALSE(has_output_after);
 }
 
+// Test that drainOutput hands out the oldest values in batches and consumes them
+TEST_F(OutOperatorTest, DrainOutputConsumesOldestInBatches) {
+    OutOperator local_op(210);
+    for (int i = 1; i <= 5; ++i) {
+        local_op.message(i);
+    }
+    std::vector<int> drained;
+    auto collect = [&drained](const int* values, size_t count) { drained.insert(drained.end(), values, values + count); };
+
+    EXPECT_EQ(local_op.drainOutput(3, collect), 3u);
+    EXPECT_EQ(drained, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(local_op.getOutputCount(), 2);
+
+    int buffer[8] = {};
+    EXPECT_EQ(local_op.readOutput(buffer, 8), 2u);
+    EXPECT_EQ(buffer[0], 4);
+    EXPECT_EQ(buffer[1], 5);
+    EXPECT_FALSE(local_op.hasOutput());
+    EXPECT_EQ(local_op.getDroppedCount(), 0u);
+}
+
+// Test a reader thread draining while the owning thread keeps producing (no simulation lock involved)
+TEST_F(OutOperatorTest, DrainOutputFromReaderThreadWhileProducing) {
+    constexpr int VALUES = 50000;
+    OutOperator local_op(211);
+    std::vector<int> drained;
+    drained.reserve(VALUES);
+
+    std::thread reader([&] {
+        while (drained.size() < static_cast<size_t>(VALUES)) {
+            size_t taken = local_op.drainOutput(512, [&drained](const int* values, size_t count) {
+                drained.insert(drained.end(), values, values + count);
+            });
+            if (taken == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (int i = 0; i < VALUES; ++i) {
+        local_op.message(i);
+    }
+    reader.join();
+
+    ASSERT_EQ(drained.size(), static_cast<size_t>(VALUES));
+    for (int i = 0; i < VALUES; ++i) {
+        ASSERT_EQ(drained[i], i);
+    }
+    EXPECT_EQ(local_op.getDroppedCount(), 0u);
+}
+
 class OutOperatorGetDataAsStringTests : public OutOperatorTest {};
 
 TEST_F(OutOperatorGetDataAsStringTests, GetDataAsStringEmptyBuffer) {
@@ -406,6 +457,42 @@ TEST_F(OutOperatorGetDataAsStringTests, GetDataAsStringHandlesNegativeValuesAsZe
     ASSERT_FALSE(local_op_min.hasOutput());
 }
 
+TEST_F(OutOperatorGetDataAsStringTests, GetDataAsStringHonorsBatchSize) {
+    OutOperator local_op(309);
+    const std::string text = "Hello, world";
+    for (char c : text) {
+        local_op.message(inputValueForChar(static_cast<unsigned char>(c)));
+    }
+    local_op.setBatchSize(5);
+    EXPECT_EQ(local_op.getDataAsString(), "Hello");
+    EXPECT_EQ(local_op.getOutputCount(), 7); // the rest waits for the next call
+    local_op.setBatchSize(0); // no limit
+    EXPECT_EQ(local_op.getDataAsString(), ", world");
+    ASSERT_FALSE(local_op.hasOutput());
+}
+
+TEST_F(OutOperatorGetDataAsStringTests, ReadTextMatchesScalarScaling) {
+    OutOperator local_op(310);
+    std::vector<int> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back((i % 3 == 0 ? -1 : 1) * i * 2147483); // spread over the int range, some negative
+    }
+    values.push_back(std::numeric_limits<int>::max());
+    values.push_back(std::numeric_limits<int>::min());
+    for (int value : values) {
+        local_op.message(value);
+    }
+    std::vector<char> buffer(values.size() + 16, 'x');
+    ASSERT_EQ(local_op.readText(buffer.data(), buffer.size()), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        // the scalar conversion getDataAsString used before: top 8 value bits of the magnitude
+        unsigned int magnitude = values[i] < 0 ? 0u - static_cast<unsigned int>(values[i]) : static_cast<unsigned int>(values[i]);
+        ASSERT_EQ(buffer[i], static_cast<char>(magnitude >> (std::numeric_limits<int>::digits - 8))) << "value " << values[i];
+    }
+    EXPECT_EQ(buffer[values.size()], 'x'); // nothing written past the converted values
+    ASSERT_FALSE(local_op.hasOutput());
+}
+
 TEST(OutOperatorHelperTests, ExpectedCharFromIntConsistency) {
     ASSERT_EQ(expectedCharFromInt(0), '\0');
     ASSERT_EQ(static_cast<unsigned char>(expectedCharFromInt(std::numeric_limits<int>::max())), 255);
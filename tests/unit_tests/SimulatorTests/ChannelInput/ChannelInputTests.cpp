@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+#include "Simulator.h"
+#include "operators/InOperator.h"
+#include <cstdint>
+#include <vector>
+
+// Test that a submitted frame is delivered to the network at the channel's rate, spread over steps
+TEST(SimulatorChannelInputTest, ImageFrame_SpreadAcrossSteps) {
+    Simulator simulator;
+    simulator.createNewNetwork(10);
+    ASSERT_TRUE(simulator.setChannelInputRate(ChannelType::IMAGE, 100));
+    EXPECT_FALSE(simulator.setChannelInputRate(ChannelType::TEXT, 100));
+
+    std::vector<uint8_t> frame(250, 200);
+    EXPECT_EQ(simulator.submitImageFrame(frame.data(), frame.size()), 250u);
+    EXPECT_EQ(simulator.getPendingChannelInput(ChannelType::IMAGE), 250u);
+
+    simulator.run(1);
+    EXPECT_EQ(simulator.getPendingChannelInput(ChannelType::IMAGE), 150u);
+    simulator.run(2);
+    EXPECT_EQ(simulator.getPendingChannelInput(ChannelType::IMAGE), 0u);
+}
+
+// Test that a rate above the InOperator's per-step limit is capped, leaving the excess queued
+TEST(SimulatorChannelInputTest, RateAboveOperatorLimit_IsCapped) {
+    Simulator simulator;
+    simulator.createNewNetwork(10);
+    const size_t limit = InOperator::MAX_ACCUMULATED_DATA;
+    ASSERT_TRUE(simulator.setChannelInputRate(ChannelType::AUDIO, limit + 1000));
+
+    std::vector<int16_t> samples(limit + 1000, 3);
+    EXPECT_EQ(simulator.submitAudioSamples(samples.data(), samples.size()), samples.size());
+    simulator.run(1);
+    EXPECT_EQ(simulator.getPendingChannelInput(ChannelType::AUDIO), 1000u);
+    simulator.run(1);
+    EXPECT_EQ(simulator.getPendingChannelInput(ChannelType::AUDIO), 0u);
+}
+
+// Test that audio submissions queue independently of the image channel, and outputs read without a network's output
+TEST(SimulatorChannelInputTest, Audio_QueuedAndOutputReadable) {
+    Simulator simulator;
+    const int16_t samples[] = {-5, 7, 1000};
+    EXPECT_EQ(simulator.submitAudioSamples(samples, 3), 3u);
+    EXPECT_EQ(simulator.getPendingChannelInput(ChannelType::AUDIO), 3u);
+    EXPECT_EQ(simulator.getPendingChannelInput(ChannelType::IMAGE), 0u);
+
+    int16_t audioOut[8];
+    uint8_t imageOut[8];
+    EXPECT_EQ(simulator.readAudioOutput(audioOut, 8), 0u); // no network yet
+    simulator.createNewNetwork(10);
+    EXPECT_EQ(simulator.readImageOutput(imageOut, 8), 0u);
+}
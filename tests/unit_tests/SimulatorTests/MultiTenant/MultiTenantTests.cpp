@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+#include "Simulator.h"
+#include "Scheduler.h"
+#include "UpdateEvent.h"
+#include "UpdateScheduler.h"
+#include "controllers/TimeController.h"
+#include "controllers/UpdateController.h"
+#include "util/Randomizer.h"
+#include "util/PseudoRandomSource.h"
+#include "util/WorkerPool.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    const uint32_t FIRST_INTERNAL_ID = 6; // after the 3 input and 3 output channels
+
+    struct Tenant {
+        int operators;
+        std::string text;
+    };
+
+    const std::vector<Tenant> TENANTS = {
+        {60, "first tenant"},
+        {120, "second tenant, a larger network"},
+        {90, "third"},
+        {150, "fourth tenant runs the longest text of all"},
+    };
+
+    // Builds, feeds and runs one tenant's network and returns everything the run leaves behind
+    std::string runTenant(const Tenant& tenant) {
+        Randomizer rand(std::make_unique<PseudoRandomSource>());
+        Simulator simulator("", &rand);
+        simulator.setLogFrequency(0);
+        simulator.setUpdateThreads(0);
+        simulator.createNewNetwork(tenant.operators);
+        simulator.submitText(tenant.text);
+        for (int chunk = 0; chunk < 4; ++chunk) {
+            for (int i = 0; i < tenant.operators; i += 3) {
+                uint32_t id = FIRST_INTERNAL_ID + static_cast<uint32_t>(i);
+                int target = static_cast<int>(FIRST_INTERNAL_ID + (i * 7 + chunk) % tenant.operators);
+                simulator.submitUpdate(UpdateEvent(UpdateType::ADD_CONNECTION, id, {target, chunk % 4}));
+            }
+            simulator.run(10);
+        }
+        return simulator.getNetworkJson(false) + "\n" + simulator.getCurrentPayloadsJson(false) + "\n"
+             + simulator.getNextPayloadsJson(false) + "\n" + simulator.getOutput() + "\n"
+             + std::to_string(simulator.getStatus().currentStep);
+    }
+}
+
+// Test that a scope makes an instance the thread's get() result and restores the previous one
+TEST(SchedulerScopeTest, Scope_OverridesDefaultOnThisThread) {
+    MetaController metaController("");
+    TimeController timeA(metaController);
+    TimeController timeB(metaController);
+    UpdateController updates(metaController);
+    Scheduler* first = Scheduler::CreateInstance(&timeA);
+    std::unique_ptr<Scheduler> second = Scheduler::CreateOwnedInstance(&timeB);
+    std::unique_ptr<UpdateScheduler> updateScheduler = UpdateScheduler::CreateOwnedInstance(&updates);
+
+    EXPECT_EQ(Scheduler::get(), first); // no scope, the default instance
+    {
+        Scheduler::Scope outer(second.get());
+        UpdateScheduler::Scope updateScope(updateScheduler.get());
+        EXPECT_EQ(Scheduler::get(), second.get());
+        EXPECT_EQ(UpdateScheduler::getThreadInstance(), updateScheduler.get());
+        {
+            Scheduler::Scope inner(first);
+            EXPECT_EQ(Scheduler::get(), first);
+        }
+        EXPECT_EQ(Scheduler::get(), second.get());
+
+        Scheduler* seen = second.get();
+        std::thread other([&seen]() { seen = Scheduler::getThreadInstance(); });
+        other.join();
+        EXPECT_EQ(seen, nullptr); // a scope only covers the thread that installed it
+    }
+    EXPECT_EQ(Scheduler::get(), first);
+    EXPECT_EQ(Scheduler::getThreadInstance(), nullptr);
+    Scheduler::ResetInstances(); // deletes `first`, the owned instances go with their unique_ptr
+}
+
+// Test that ResetInstances only deletes registry instances and owned instances unregister themselves
+TEST(SchedulerScopeTest, ResetInstances_KeepsOwnedInstances) {
+    MetaController metaController("");
+    TimeController timeA(metaController);
+    TimeController timeB(metaController);
+    UpdateController updatesA(metaController);
+    UpdateController updatesB(metaController);
+    Scheduler::CreateInstance(&timeA);
+    UpdateScheduler::CreateInstance(&updatesA);
+    std::unique_ptr<Scheduler> owned = Scheduler::CreateOwnedInstance(&timeB);
+    std::unique_ptr<UpdateScheduler> ownedUpdates = UpdateScheduler::CreateOwnedInstance(&updatesB);
+
+    Scheduler::ResetInstances();
+    UpdateScheduler::ResetInstances();
+    EXPECT_EQ(Scheduler::get(), owned.get()); // still alive and now the default
+    EXPECT_EQ(UpdateScheduler::get(), ownedUpdates.get());
+
+    owned.reset();
+    ownedUpdates.reset();
+    EXPECT_THROW(Scheduler::get(), std::runtime_error);
+    EXPECT_THROW(UpdateScheduler::get(), std::runtime_error);
+}
+
+// Test that a simulator keeps its own schedulers while others are created and destroyed around it
+TEST(MultiTenantTest, Simulators_CoexistInOneProcess) {
+    std::string alone = runTenant(TENANTS[1]);
+
+    Randomizer rand(std::make_unique<PseudoRandomSource>());
+    auto before = std::make_unique<Simulator>("", &rand);
+    before->createNewNetwork(20);
+    std::string between = runTenant(TENANTS[1]); // created after `before`, which stays the default instance
+    auto after = std::make_unique<Simulator>("", &rand);
+    before.reset();
+    EXPECT_EQ(between, alone);
+    EXPECT_EQ(runTenant(TENANTS[1]), alone);
+}
+
+// Test that several simulators stepping concurrently on a shared pool end like they do alone
+TEST(MultiTenantTest, ConcurrentSimulators_MatchSerialRuns) {
+    std::vector<std::string> serial;
+    for (const Tenant& tenant : TENANTS) {
+        serial.push_back(runTenant(tenant));
+    }
+
+    std::vector<std::string> concurrent(TENANTS.size());
+    WorkerPool pool(TENANTS.size() - 1);
+    pool.parallelFor(TENANTS.size(), [&](size_t i) {
+        concurrent[i] = runTenant(TENANTS[i]);
+    });
+    for (size_t i = 0; i < TENANTS.size(); ++i) {
+        EXPECT_EQ(concurrent[i], serial[i]) << "tenant " << i;
+    }
+}
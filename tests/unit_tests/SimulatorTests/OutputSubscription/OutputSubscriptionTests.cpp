@@ -0,0 +1,190 @@
+#include "gtest/gtest.h"
+#include "OutputSubscription.h"
+#include "Simulator.h"
+#include "operators/OutOperator.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <poll.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Fixture: a subscription bound to a standalone output channel operator
+class OutputSubscriptionTest : public ::testing::Test {
+protected:
+    OutOperator channel{3};
+    std::vector<int> received;
+    std::vector<size_t> batches;
+
+    OutputSubscription::BatchCallback collector() {
+        return [this](const int* values, size_t count) {
+            received.insert(received.end(), values, values + count);
+            batches.push_back(count);
+        };
+    }
+
+    static bool fdReadable(int fd) {
+        pollfd entry{fd, POLLIN, 0};
+        return ::poll(&entry, 1, 0) == 1 && (entry.revents & POLLIN) != 0;
+    }
+};
+
+// Test that poll delivers the waiting values oldest first, in batches of at most batchSize
+TEST_F(OutputSubscriptionTest, Poll_DeliversInBatches) {
+    OutputSubscription subscription(ChannelType::TEXT, 4);
+    subscription.bind(&channel);
+    for (int i = 0; i < 10; ++i) {
+        channel.message(i);
+    }
+    EXPECT_EQ(subscription.available(), 10u);
+
+    EXPECT_EQ(subscription.poll(collector(), 6), 6u);
+    EXPECT_EQ(batches, (std::vector<size_t>{4, 2}));
+    EXPECT_EQ(subscription.poll(collector()), 4u);
+    EXPECT_EQ(received, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(subscription.poll(collector()), 0u);
+    EXPECT_FALSE(channel.hasOutput());
+}
+
+// Test that the notification descriptor is readable once a batch is waiting, and reset by poll
+TEST_F(OutputSubscriptionTest, Notify_SignalsAtBatchSize) {
+    OutputSubscription subscription(ChannelType::TEXT, 3);
+    subscription.bind(&channel);
+    ASSERT_GE(subscription.getNotificationFd(), 0);
+
+    channel.message(1);
+    channel.message(2);
+    subscription.notifyIfReady(subscription.getBatchSize());
+    EXPECT_FALSE(fdReadable(subscription.getNotificationFd())); // batch not full
+
+    channel.message(3);
+    subscription.notifyIfReady(subscription.getBatchSize());
+    EXPECT_TRUE(fdReadable(subscription.getNotificationFd()));
+
+    EXPECT_EQ(subscription.poll(collector()), 3u);
+    EXPECT_FALSE(fdReadable(subscription.getNotificationFd()));
+}
+
+// Test that signals racing with polls never leave the descriptor readable once the last poll is done
+TEST_F(OutputSubscriptionTest, SignalRacingPoll_DescriptorEndsReset) {
+    OutputSubscription subscription(ChannelType::TEXT, 1);
+    subscription.bind(&channel);
+    ASSERT_GE(subscription.getNotificationFd(), 0);
+
+    std::atomic<bool> stop{false};
+    std::thread signaller([&]() {
+        while (!stop.load()) {
+            subscription.notifyIfReady(0); // signals whenever the previous signal was taken
+        }
+    });
+    for (int i = 0; i < 100000; ++i) {
+        subscription.poll(collector());
+    }
+    stop = true;
+    signaller.join();
+
+    subscription.poll(collector());
+    EXPECT_FALSE(fdReadable(subscription.getNotificationFd()));
+}
+
+// Test that waitAndPoll times out with nothing waiting and wakes up when signalled from another thread
+TEST_F(OutputSubscriptionTest, WaitAndPoll_WakesOnSignal) {
+    OutputSubscription subscription(ChannelType::TEXT, 2);
+    subscription.bind(&channel);
+    EXPECT_EQ(subscription.waitAndPoll(std::chrono::milliseconds(10), collector()), 0u);
+
+    std::thread producer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        channel.message(7);
+        channel.message(8);
+        subscription.notifyIfReady(2);
+    });
+    size_t delivered = subscription.waitAndPoll(std::chrono::seconds(10), collector());
+    producer.join();
+    EXPECT_EQ(delivered, 2u);
+    EXPECT_EQ(received, (std::vector<int>{7, 8}));
+}
+
+// Test that an unbound subscription delivers nothing
+TEST_F(OutputSubscriptionTest, Unbound_DeliversNothing) {
+    OutputSubscription subscription(ChannelType::TEXT, 2);
+    channel.message(1);
+    EXPECT_EQ(subscription.poll(collector()), 0u);
+    EXPECT_EQ(subscription.available(), 0u);
+    subscription.notifyIfReady(1);
+    EXPECT_FALSE(fdReadable(subscription.getNotificationFd()));
+}
+
+// Test the Simulator wiring: subscriptions follow network replacement and are detached on unsubscribe
+TEST(SimulatorOutputSubscriptionTest, SubscriptionFollowsNetwork) {
+    Simulator simulator;
+    simulator.createNewNetwork(10);
+    auto subscription = simulator.subscribeOutput(ChannelType::TEXT, 8);
+    ASSERT_NE(subscription, nullptr);
+    EXPECT_EQ(subscription->getChannel(), ChannelType::TEXT);
+    EXPECT_EQ(subscription->available(), 0u);
+
+    simulator.submitText("hello world");
+    simulator.run(200);
+    size_t buffered = static_cast<size_t>(simulator.getTextCount());
+    std::vector<int> received;
+    EXPECT_EQ(subscription->poll([&](const int* values, size_t count) { received.insert(received.end(), values, values + count); }),
+              buffered);
+    EXPECT_EQ(simulator.getTextCount(), 0);
+
+    simulator.createNewNetwork(5); // rebinds to the new network's text channel
+    EXPECT_EQ(subscription->available(), 0u);
+    simulator.unsubscribeOutput(subscription);
+    EXPECT_EQ(subscription->poll([](const int*, size_t) {}), 0u);
+}
+
+// Test that a failed network creation leaves the subscription bound to the network still in place
+TEST(SimulatorOutputSubscriptionTest, FailedCreateKeepsSubscriptionBound) {
+    Simulator simulator;
+    simulator.setLogFrequency(0);
+    simulator.createNewNetwork(10);
+    auto subscription = simulator.subscribeOutput(ChannelType::TEXT, 8);
+    for (int attempt = 0; attempt < 20 && simulator.getTextCount() == 0; ++attempt) {
+        simulator.submitText("hello world");
+        simulator.run(200);
+    }
+    size_t buffered = static_cast<size_t>(simulator.getTextCount());
+    ASSERT_GT(buffered, 0u);
+
+    EXPECT_THROW(simulator.createNewNetwork(-1), std::invalid_argument);
+    EXPECT_EQ(subscription->available(), buffered);
+    EXPECT_EQ(subscription->poll([](const int*, size_t) {}), buffered);
+}
+
+// Test that a consumer polling on its own thread never reaches the operators of a network being replaced
+TEST(SimulatorOutputSubscriptionTest, PollDuringNetworkReplacement) {
+    Simulator simulator;
+    simulator.setLogFrequency(0);
+    simulator.createNewNetwork(20);
+    const std::string configPath = "subscription_reload_test.bin";
+    ASSERT_TRUE(simulator.saveConfiguration(configPath));
+    auto subscription = simulator.subscribeOutput(ChannelType::TEXT, 1);
+
+    std::atomic<bool> done{false};
+    std::thread consumer([&]() {
+        while (!done.load()) {
+            subscription->poll([](const int*, size_t) {});
+            subscription->available();
+            std::this_thread::yield();
+        }
+    });
+    for (int i = 0; i < 50; ++i) {
+        simulator.submitText("reload");
+        simulator.run(20);
+        if (i % 2 == 0) {
+            simulator.createNewNetwork(20);
+        } else {
+            simulator.loadConfiguration(configPath);
+        }
+    }
+    done = true;
+    consumer.join();
+    std::remove(configPath.c_str());
+    EXPECT_EQ(subscription->available(), 0u); // rebound to the last network, which has not run yet
+}
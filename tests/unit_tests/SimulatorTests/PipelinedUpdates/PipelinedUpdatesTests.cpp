@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "Simulator.h"
+#include "UpdateEvent.h"
+#include "UpdateScheduler.h"
+#include "util/Randomizer.h"
+#include "util/PseudoRandomSource.h"
+#include <memory>
+#include <string>
+
+namespace {
+    const int INTERNAL_OPS = 200;
+    const uint32_t FIRST_INTERNAL_ID = 6; // after the 3 input and 3 output channels
+
+    // Runs the same seeded network and update stream in serial or pipelined mode and returns
+    // everything a run leaves behind: network, payloads, output and step counter.
+    std::string runScenario(bool pipelined, size_t minConcurrentUpdates) {
+        Randomizer rand(std::make_unique<PseudoRandomSource>());
+        Simulator simulator("", &rand);
+        simulator.setLogFrequency(0);
+        simulator.createNewNetwork(INTERNAL_OPS);
+        simulator.setPipelinedUpdates(pipelined, minConcurrentUpdates);
+        simulator.submitText("pipelined updates must not change the result");
+
+        for (int chunk = 0; chunk < 20; ++chunk) {
+            // Queued before the run, applied after its first step in either mode
+            for (uint32_t id = FIRST_INTERNAL_ID; id < FIRST_INTERNAL_ID + INTERNAL_OPS; ++id) {
+                int target = static_cast<int>(FIRST_INTERNAL_ID + (id * 7 + chunk) % INTERNAL_OPS);
+                UpdateScheduler::get()->Submit(UpdateEvent(UpdateType::CHANGE_OPERATOR_PARAMETER, id, {chunk % 2, chunk + static_cast<int>(id % 7)}));
+                UpdateScheduler::get()->Submit(UpdateEvent(UpdateType::ADD_CONNECTION, id, {target, chunk % 5}));
+                if (chunk % 3 == 2) {
+                    UpdateScheduler::get()->Submit(UpdateEvent(UpdateType::REMOVE_CONNECTION, id, {target, (chunk + 1) % 5}));
+                }
+            }
+            simulator.run(5);
+        }
+
+        return simulator.getNetworkJson(false) + "\n" + simulator.getCurrentPayloadsJson(false) + "\n"
+             + simulator.getNextPayloadsJson(false) + "\n" + simulator.getOutput() + "\n"
+             + std::to_string(simulator.getStatus().currentStep);
+    }
+}
+
+// Test that pipelined mode, with the remainder applied on a second thread, ends like the serial schedule
+TEST(PipelinedUpdatesTest, ConcurrentRemainder_MatchesSerialRun) {
+    std::string serial = runScenario(false, Simulator::DEFAULT_PIPELINE_THRESHOLD);
+    std::string pipelined = runScenario(true, 1);
+    EXPECT_EQ(pipelined, serial);
+}
+
+// Test that pipelined mode below the concurrency threshold also ends like the serial schedule
+TEST(PipelinedUpdatesTest, InlineRemainder_MatchesSerialRun) {
+    std::string serial = runScenario(false, Simulator::DEFAULT_PIPELINE_THRESHOLD);
+    std::string pipelined = runScenario(true, Simulator::DEFAULT_PIPELINE_THRESHOLD);
+    EXPECT_EQ(pipelined, serial);
+}
+
+// Test that a staged delete keeps the serial order
+TEST(PipelinedUpdatesTest, LifecycleEvent_MatchesSerialRun) {
+    auto scenario = [](bool pipelined) {
+        Randomizer rand(std::make_unique<PseudoRandomSource>());
+        Simulator simulator("", &rand);
+        simulator.setLogFrequency(0);
+        simulator.createNewNetwork(50);
+        simulator.setPipelinedUpdates(pipelined, 1);
+        simulator.submitText("delete");
+        UpdateScheduler::get()->Submit(UpdateEvent(UpdateType::ADD_CONNECTION, FIRST_INTERNAL_ID + 1, {static_cast<int>(FIRST_INTERNAL_ID + 2), 1}));
+        UpdateScheduler::get()->Submit(UpdateEvent(UpdateType::DELETE_OPERATOR, FIRST_INTERNAL_ID + 2));
+        simulator.run(20);
+        EXPECT_EQ(simulator.isPipelinedUpdates(), pipelined);
+        return simulator.getNetworkJson(false) + simulator.getCurrentPayloadsJson(false);
+    };
+    EXPECT_EQ(scenario(true), scenario(false));
+}
@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+#include "Simulator.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Test that the status after a run matches the steps executed, including the step statistics
+TEST(SimulatorStatusSnapshotTest, StatusAfterRun) {
+    Simulator simulator;
+    simulator.createNewNetwork(10);
+    EXPECT_EQ(simulator.getStatus().currentStep, 0);
+    simulator.submitText("status");
+    simulator.run(5);
+
+    SimulationStatus status = simulator.getStatus();
+    EXPECT_EQ(status.stepStats.totalSteps, static_cast<uint64_t>(status.currentStep));
+    EXPECT_GT(status.totalOperators, 0u);
+    EXPECT_EQ(status.layerCount, 3u);
+    // a fired operator emitted at least one payload in its step
+    EXPECT_LE(status.stepStats.operatorsFired.max, status.stepStats.payloadsCreated.max);
+}
+
+// Test that status reads during a run see steps in order and end at the final step
+TEST(SimulatorStatusSnapshotTest, ReadsDuringRunAreMonotonic) {
+    Simulator simulator;
+    simulator.createNewNetwork(50);
+    simulator.submitText("a longer text keeps the network busy for a while");
+
+    std::atomic<bool> finished{false};
+    std::thread runner([&]() {
+        simulator.run(2000);
+        finished = true;
+    });
+    long long previous = 0;
+    int reads = 0;
+    while (!finished) {
+        SimulationStatus status = simulator.getStatus();
+        EXPECT_GE(status.currentStep, previous);
+        EXPECT_LE(status.currentStep, 2000);
+        previous = status.currentStep;
+        ++reads;
+        std::this_thread::sleep_for(std::chrono::microseconds(50)); // poll, do not starve the runner
+    }
+    runner.join();
+    EXPECT_GT(reads, 0);
+    EXPECT_GE(simulator.getStatus().currentStep, previous);
+    EXPECT_EQ(simulator.getStatus().stepStats.totalSteps, static_cast<uint64_t>(simulator.getStatus().currentStep));
+}
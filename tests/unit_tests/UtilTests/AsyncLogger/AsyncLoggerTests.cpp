@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+#include "util/AsyncLogger.h"
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Helper: number of occurrences of `needle` in `text`
+static size_t countOccurrences(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+
+class AsyncLoggerTest : public ::testing::Test {
+protected:
+    std::ostringstream output;
+    AsyncLogger logger;
+
+    void SetUp() override {
+        logger.setSink(&output);
+        logger.setRateLimit(0);
+    }
+
+    std::string written() {
+        logger.flush();
+        return output.str();
+    }
+};
+
+// Test that a record is formatted with level, event, fields and text
+TEST_F(AsyncLoggerTest, Log_FormatsFieldsAndText) {
+    EXPECT_TRUE(logger.info("sim.status", {{"step", 42}, {"payloads", -3}}, "hello"));
+    std::string text = written();
+    EXPECT_NE(text.find("[INFO ] "), std::string::npos);
+    EXPECT_NE(text.find(" sim.status step=42 payloads=-3 \"hello\"\n"), std::string::npos);
+}
+
+// Test that fields beyond MAX_FIELDS are ignored and long text is truncated
+TEST_F(AsyncLoggerTest, Log_TruncatesFieldsAndText) {
+    logger.info("e", {{"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}, {"x", 5}}, std::string(500, 'z'));
+    std::string text = written();
+    EXPECT_NE(text.find("d=4"), std::string::npos);
+    EXPECT_EQ(text.find("x=5"), std::string::npos);
+    EXPECT_EQ(countOccurrences(text, "z"), AsyncLogger::TEXT_CAPACITY - 1);
+}
+
+// Test that records below the minimum level are not queued
+TEST_F(AsyncLoggerTest, Level_FiltersRecords) {
+    EXPECT_FALSE(logger.debug("hidden"));
+    logger.setLevel(AsyncLogger::Level::ERROR);
+    EXPECT_FALSE(logger.warn("hidden"));
+    EXPECT_TRUE(logger.error("shown"));
+    logger.setLevel(AsyncLogger::Level::OFF);
+    EXPECT_FALSE(logger.error("hidden"));
+
+    std::string text = written();
+    EXPECT_EQ(countOccurrences(text, "hidden"), 0u);
+    EXPECT_EQ(countOccurrences(text, "shown"), 1u);
+}
+
+// Test that the rate limit suppresses records, reports them, and exempts errors
+TEST_F(AsyncLoggerTest, RateLimit_SuppressesAndReports) {
+    logger.setRateLimit(5);
+    size_t accepted = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (logger.info("spam", {{"i", i}})) ++accepted;
+    }
+    EXPECT_TRUE(logger.error("important"));
+
+    // at most two one-second windows can be involved if the loop crosses a second boundary
+    EXPECT_LE(accepted, 10u);
+    EXPECT_EQ(logger.getSuppressedCount(), 100u - accepted);
+    std::string text = written();
+    EXPECT_EQ(countOccurrences(text, " spam "), accepted);
+    EXPECT_EQ(countOccurrences(text, "important"), 1u);
+    EXPECT_NE(text.find("log.lost dropped=0 rate_limited="), std::string::npos);
+}
+
+// Test that a full ring drops records instead of blocking, and every record is either written or counted
+TEST(AsyncLoggerCapacityTest, FullRing_DropsAndCounts) {
+    std::ostringstream output;
+    AsyncLogger logger(2);
+    logger.setSink(&output);
+    logger.setRateLimit(0);
+
+    const size_t total = 1000;
+    for (size_t i = 0; i < total; ++i) {
+        logger.info("burst", {{"i", static_cast<long long>(i)}});
+    }
+    logger.flush();
+    size_t writtenCount = countOccurrences(output.str(), " burst ");
+    EXPECT_EQ(writtenCount + logger.getDroppedCount(), total);
+}
+
+// Test that concurrent producers lose no records when the ring is large enough
+TEST_F(AsyncLoggerTest, MultipleProducers_AllRecordsWritten) {
+    const int threads = 4;
+    const int perThread = 500; // 2000 records fit the default ring
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([this, t] {
+            for (int i = 0; i < perThread; ++i) {
+                logger.info("worker", {{"thread", t}, {"i", i}});
+            }
+        });
+    }
+    for (auto& producer : producers) producer.join();
+
+    std::string text = written();
+    EXPECT_EQ(logger.getDroppedCount(), 0u);
+    EXPECT_EQ(countOccurrences(text, " worker "), static_cast<size_t>(threads * perThread));
+    EXPECT_NE(text.find("worker thread=3 i=499"), std::string::npos);
+}
+
+// Test the level name parser
+TEST(AsyncLoggerParseTest, ParseLevel) {
+    AsyncLogger::Level level = AsyncLogger::Level::INFO;
+    EXPECT_TRUE(AsyncLogger::parseLevel("debug", level));
+    EXPECT_EQ(level, AsyncLogger::Level::DEBUG);
+    EXPECT_TRUE(AsyncLogger::parseLevel("off", level));
+    EXPECT_EQ(level, AsyncLogger::Level::OFF);
+    EXPECT_FALSE(AsyncLogger::parseLevel("verbose", level));
+    EXPECT_EQ(level, AsyncLogger::Level::OFF);
+}
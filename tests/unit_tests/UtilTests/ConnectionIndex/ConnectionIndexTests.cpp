@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+#include "util/ConnectionIndex.h"
+#include <algorithm>
+#include <vector>
+
+// Test that added edges are reported as incoming edges of their target
+TEST(ConnectionIndexTest, AddEdge_RecordsIncoming) {
+    ConnectionIndex index;
+    index.addEdge(1, 10, 3);
+    index.addEdge(2, 10, 5);
+    index.addEdge(1, 11, 3);
+
+    EXPECT_EQ(index.getInDegree(10), 2u);
+    EXPECT_EQ(index.getInDegree(11), 1u);
+    EXPECT_EQ(index.getInDegree(12), 0u);
+    EXPECT_EQ(index.getEdgeCount(), 3u);
+
+    std::vector<IncomingEdge> incoming = index.getIncoming(10);
+    ASSERT_EQ(incoming.size(), 2u);
+    EXPECT_NE(std::find(incoming.begin(), incoming.end(), IncomingEdge{1, 3}), incoming.end());
+    EXPECT_NE(std::find(incoming.begin(), incoming.end(), IncomingEdge{2, 5}), incoming.end());
+}
+
+// Test that removing an edge only removes the exact (source, distance) pair
+TEST(ConnectionIndexTest, RemoveEdge_RemovesExactEdge) {
+    ConnectionIndex index;
+    index.addEdge(1, 10, 3);
+    index.addEdge(1, 10, 4);
+
+    index.removeEdge(1, 10, 3);
+    std::vector<IncomingEdge> incoming = index.getIncoming(10);
+    ASSERT_EQ(incoming.size(), 1u);
+    EXPECT_EQ(incoming[0], (IncomingEdge{1, 4}));
+
+    index.removeEdge(7, 10, 4); // unknown source, no effect
+    EXPECT_EQ(index.getInDegree(10), 1u);
+
+    index.removeEdge(1, 10, 4);
+    EXPECT_EQ(index.getInDegree(10), 0u);
+    EXPECT_EQ(index.getEdgeCount(), 0u);
+}
+
+// Test forgetTarget and clear
+TEST(ConnectionIndexTest, ForgetTargetAndClear) {
+    ConnectionIndex index;
+    index.addEdge(1, 10, 3);
+    index.addEdge(2, 10, 3);
+    index.addEdge(2, 20, 1);
+
+    index.forgetTarget(10);
+    EXPECT_EQ(index.getInDegree(10), 0u);
+    EXPECT_EQ(index.getInDegree(20), 1u);
+
+    index.clear();
+    EXPECT_EQ(index.getEdgeCount(), 0u);
+}
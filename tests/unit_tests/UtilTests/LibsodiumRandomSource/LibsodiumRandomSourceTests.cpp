@@ -0,0 +1,61 @@
+#include "gtest/gtest.h"
+#include "util/LibsodiumRandomSource.h"
+#include <climits>
+#include <vector>
+
+// Test that a batch stays within the bounds, inclusive on both ends, and covers them
+TEST(LibsodiumRandomSourceTest, FillInt_StaysInRange) {
+    LibsodiumRandomSource source;
+    std::vector<int> values(20000);
+    source.fillInt(values.data(), values.size(), -3, 4);
+    bool sawMin = false, sawMax = false;
+    for (int value : values) {
+        ASSERT_GE(value, -3);
+        ASSERT_LE(value, 4);
+        sawMin = sawMin || value == -3;
+        sawMax = sawMax || value == 4;
+    }
+    EXPECT_TRUE(sawMin);
+    EXPECT_TRUE(sawMax);
+}
+
+// Test that swapped bounds, a single value and an empty batch are handled like getInt
+TEST(LibsodiumRandomSourceTest, FillInt_EdgeBounds) {
+    LibsodiumRandomSource source;
+    std::vector<int> values(1000);
+    source.fillInt(values.data(), values.size(), 10, 0);
+    for (int value : values) {
+        ASSERT_GE(value, 0);
+        ASSERT_LE(value, 10);
+    }
+    source.fillInt(values.data(), values.size(), 7, 7);
+    for (int value : values) {
+        ASSERT_EQ(value, 7);
+    }
+    source.fillInt(values.data(), 0, 0, 1); // nothing written, nothing read
+    EXPECT_EQ(values[0], 7);
+
+    source.fillInt(values.data(), values.size(), INT_MIN, INT_MAX); // full 32-bit range
+    size_t negative = 0;
+    for (int value : values) {
+        negative += value < 0;
+    }
+    EXPECT_GT(negative, 400u);
+    EXPECT_LT(negative, 600u);
+}
+
+// Test that the mapping to a range that does not divide 2^32 shows no visible bias
+TEST(LibsodiumRandomSourceTest, FillInt_IsUniform) {
+    LibsodiumRandomSource source;
+    const int buckets = 6;
+    const size_t draws = 120000;
+    std::vector<int> values(draws);
+    source.fillInt(values.data(), draws, 0, buckets - 1);
+    std::vector<size_t> counts(buckets, 0);
+    for (int value : values) {
+        counts[value]++;
+    }
+    for (size_t count : counts) {
+        EXPECT_NEAR(static_cast<double>(count), draws / buckets, draws / buckets * 0.05); // about 14 sigma
+    }
+}
@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+#include "util/MpscBatchQueue.h"
+#include <thread>
+#include <vector>
+
+// Small batch size so tests cross batch boundaries quickly
+using SmallQueue = MpscBatchQueue<int, 4>;
+
+// Test that items pushed by the consumer thread come back in push order
+TEST(MpscBatchQueueTest, DrainReturnsItemsInPushOrder) {
+    SmallQueue queue;
+    for (int i = 0; i < 10; ++i) {
+        queue.push(i);
+    }
+    EXPECT_EQ(queue.size(), 10u);
+
+    std::vector<int> drained;
+    size_t consumed = queue.drain([&](const int& item) { drained.push_back(item); });
+
+    EXPECT_EQ(consumed, 10u);
+    ASSERT_EQ(drained.size(), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(drained[i], i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test that forEach visits items without consuming them
+TEST(MpscBatchQueueTest, ForEachDoesNotConsume) {
+    SmallQueue queue;
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+
+    int sum = 0;
+    queue.forEach([&](const int& item) { sum += item; });
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(queue.size(), 3u);
+
+    EXPECT_EQ(queue.drain([](const int&) {}), 3u);
+}
+
+// Test that clear discards pending items and the queue is reusable afterwards
+TEST(MpscBatchQueueTest, ClearEmptiesQueue) {
+    SmallQueue queue;
+    for (int i = 0; i < 7; ++i) {
+        queue.push(i);
+    }
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+
+    queue.push(42);
+    std::vector<int> drained;
+    queue.drain([&](const int& item) { drained.push_back(item); });
+    ASSERT_EQ(drained.size(), 1u);
+    EXPECT_EQ(drained[0], 42);
+}
+
+// Test that items pushed during a drain are seen by the following drain
+TEST(MpscBatchQueueTest, PushDuringDrainIsDeferred) {
+    SmallQueue queue;
+    queue.push(1);
+
+    size_t first = queue.drain([&](const int& item) {
+        if (item == 1) queue.push(2);
+    });
+    EXPECT_EQ(first, 1u);
+
+    std::vector<int> drained;
+    queue.drain([&](const int& item) { drained.push_back(item); });
+    ASSERT_EQ(drained.size(), 1u);
+    EXPECT_EQ(drained[0], 2);
+}
+
+// Test concurrent producers: every item arrives once and per-thread order is kept
+TEST(MpscBatchQueueTest, MultipleProducersDeliverAllItems) {
+    SmallQueue queue;
+    const int threadCount = 4;
+    const int perThread = 1000;
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threadCount; ++t) {
+        producers.emplace_back([&queue, t, perThread]() {
+            for (int i = 0; i < perThread; ++i) {
+                queue.push(t * perThread + i);
+            }
+            queue.flushLocal();
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    std::vector<int> lastSeen(threadCount, -1);
+    size_t consumed = queue.drain([&](const int& item) {
+        int t = item / perThread;
+        EXPECT_GT(item, lastSeen[t]);
+        lastSeen[t] = item;
+    });
+
+    EXPECT_EQ(consumed, static_cast<size_t>(threadCount * perThread));
+    for (int t = 0; t < threadCount; ++t) {
+        EXPECT_EQ(lastSeen[t], t * perThread + perThread - 1);
+    }
+}
@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+#include "util/NetworkGenerator.h"
+#include "controllers/MetaController.h"
+#include "layers/Layer.h"
+#include "operators/Operator.h"
+#include "operators/AddOperator.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string GENERATED_FILE = "temp_generated_network.bin";
+    const std::string RESAVED_FILE = "temp_generated_network_resaved.bin";
+
+    std::vector<char> readFile(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    NetworkSpec smallSpec(NetworkSpec::DegreeModel model) {
+        NetworkSpec spec;
+        spec.internalOperators = 2000;
+        spec.seed = 7;
+        spec.degreeModel = model;
+        spec.meanDegree = 6.0;
+        return spec;
+    }
+}
+
+class NetworkGeneratorTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(GENERATED_FILE.c_str());
+        std::remove(RESAVED_FILE.c_str());
+    }
+};
+
+// Test that the written file loads and re-serializes byte for byte, i.e. it is in the standard format
+TEST_F(NetworkGeneratorTest, WriteConfiguration_RoundTripsThroughMetaController) {
+    for (auto model : {NetworkSpec::DegreeModel::UNIFORM, NetworkSpec::DegreeModel::POWER_LAW, NetworkSpec::DegreeModel::SMALL_WORLD}) {
+        NetworkSpec spec = smallSpec(model);
+        spec.distanceModel = NetworkSpec::DistanceModel::GEOMETRIC;
+        NetworkGenerator generator(spec);
+        GeneratedNetworkInfo info;
+        ASSERT_TRUE(generator.writeConfiguration(GENERATED_FILE, &info));
+        EXPECT_EQ(info.operators, 2006u);
+        EXPECT_EQ(info.bytes, readFile(GENERATED_FILE).size());
+
+        MetaController meta(GENERATED_FILE, nullptr);
+        EXPECT_EQ(meta.getOpCount(), 2006u);
+        ASSERT_TRUE(meta.saveConfiguration(RESAVED_FILE));
+        EXPECT_EQ(readFile(GENERATED_FILE), readFile(RESAVED_FILE));
+    }
+}
+
+// Test that the output depends on the seed only, not on the number of threads
+TEST_F(NetworkGeneratorTest, WriteConfiguration_IdenticalAcrossThreadCounts) {
+    NetworkSpec spec = smallSpec(NetworkSpec::DegreeModel::POWER_LAW);
+    spec.internalOperators = 3 * NetworkGenerator::CHUNK_SIZE + 17; // several chunks and waves
+    spec.threads = 1;
+    ASSERT_TRUE(NetworkGenerator(spec).writeConfiguration(GENERATED_FILE));
+    spec.threads = 4;
+    ASSERT_TRUE(NetworkGenerator(spec).writeConfiguration(RESAVED_FILE));
+    EXPECT_EQ(readFile(GENERATED_FILE), readFile(RESAVED_FILE));
+}
+
+// Test that an operator's draws depend on (seed, ID) and change with the seed
+TEST_F(NetworkGeneratorTest, GenerateConnections_DeterministicPerSeed) {
+    NetworkSpec spec = smallSpec(NetworkSpec::DegreeModel::UNIFORM);
+    NetworkGenerator first(spec);
+    NetworkGenerator second(spec);
+    spec.seed = 8;
+    NetworkGenerator reseeded(spec);
+
+    std::vector<NetworkGenerator::Connection> a, b, c;
+    size_t differing = 0;
+    for (uint32_t id = 6; id < 106; ++id) {
+        first.generateConnections(id, a);
+        second.generateConnections(id, b);
+        reseeded.generateConnections(id, c);
+        EXPECT_EQ(a, b);
+        EXPECT_EQ(first.generateParameters(id), second.generateParameters(id));
+        if (!(a == c)) ++differing;
+    }
+    EXPECT_GT(differing, 90u);
+}
+
+// Test connection limits: no self connections, targets in the output + internal range, distances below max
+TEST_F(NetworkGeneratorTest, GenerateConnections_RespectsLimits) {
+    NetworkSpec spec = smallSpec(NetworkSpec::DegreeModel::POWER_LAW);
+    spec.maxDegree = 40;
+    spec.maxDistance = 5;
+    NetworkGenerator generator(spec);
+    std::vector<NetworkGenerator::Connection> connections;
+    for (uint32_t id = 6; id < 6 + spec.internalOperators; ++id) {
+        generator.generateConnections(id, connections);
+        EXPECT_LE(connections.size(), 40u);
+        for (const auto& connection : connections) {
+            EXPECT_NE(connection.target, id);
+            EXPECT_GE(connection.target, 3u);
+            EXPECT_LT(connection.target, 6u + spec.internalOperators);
+            EXPECT_LT(connection.distance, 5u);
+        }
+        std::pair<int, int> parameters = generator.generateParameters(id);
+        EXPECT_GE(parameters.first, AddOperator::MIN_WEIGHT);
+        EXPECT_LE(parameters.first, AddOperator::MAX_WEIGHT);
+        EXPECT_GE(parameters.second, AddOperator::MIN_THRESHOLD);
+        EXPECT_LE(parameters.second, AddOperator::MAX_THRESHOLD);
+    }
+}
+
+// Test the degree models: uniform mean, power-law tail, small-world ring neighbours
+TEST_F(NetworkGeneratorTest, DegreeModels_HaveExpectedShape) {
+    std::vector<NetworkGenerator::Connection> connections;
+
+    NetworkSpec uniformSpec = smallSpec(NetworkSpec::DegreeModel::UNIFORM);
+    uniformSpec.maxDistance = 512; // few duplicates
+    NetworkGenerator uniform(uniformSpec);
+    uint64_t total = 0;
+    for (uint32_t id = 6; id < 2006; ++id) {
+        uniform.generateConnections(id, connections);
+        total += connections.size();
+    }
+    EXPECT_NEAR(static_cast<double>(total) / 2000.0, 6.0, 0.5);
+
+    NetworkSpec powerSpec = smallSpec(NetworkSpec::DegreeModel::POWER_LAW);
+    powerSpec.maxDistance = 512;
+    NetworkGenerator powerLaw(powerSpec);
+    size_t maxDegree = 0;
+    for (uint32_t id = 6; id < 2006; ++id) {
+        powerLaw.generateConnections(id, connections);
+        maxDegree = std::max(maxDegree, connections.size());
+    }
+    EXPECT_GT(maxDegree, 60u); // heavy tail, far above the uniform maximum of 12
+
+    NetworkSpec ringSpec = smallSpec(NetworkSpec::DegreeModel::SMALL_WORLD);
+    ringSpec.rewireProbability = 0.0;
+    ringSpec.meanDegree = 3;
+    NetworkGenerator ring(ringSpec);
+    ring.generateConnections(2005, connections); // last operator wraps to the start of the ring
+    std::vector<uint32_t> targets;
+    for (const auto& connection : connections) targets.push_back(connection.target);
+    std::sort(targets.begin(), targets.end());
+    EXPECT_EQ(targets, (std::vector<uint32_t>{6, 7, 8}));
+}
+
+// Test that invalid specs are rejected
+TEST_F(NetworkGeneratorTest, Constructor_RejectsInvalidSpec) {
+    NetworkSpec spec;
+    spec.maxDistance = 0;
+    EXPECT_THROW(NetworkGenerator{spec}, std::invalid_argument);
+
+    spec = NetworkSpec{};
+    spec.degreeModel = NetworkSpec::DegreeModel::POWER_LAW;
+    spec.powerLawExponent = 1.5;
+    EXPECT_THROW(NetworkGenerator{spec}, std::invalid_argument);
+
+    spec = NetworkSpec{};
+    spec.rewireProbability = 1.5;
+    EXPECT_THROW(NetworkGenerator{spec}, std::invalid_argument);
+}
+
+// Test the degree model parser
+TEST_F(NetworkGeneratorTest, ParseDegreeModel) {
+    NetworkSpec::DegreeModel model = NetworkSpec::DegreeModel::UNIFORM;
+    EXPECT_TRUE(NetworkGenerator::parseDegreeModel("small-world", model));
+    EXPECT_EQ(model, NetworkSpec::DegreeModel::SMALL_WORLD);
+    EXPECT_FALSE(NetworkGenerator::parseDegreeModel("scale-free", model));
+    EXPECT_EQ(model, NetworkSpec::DegreeModel::SMALL_WORLD);
+}
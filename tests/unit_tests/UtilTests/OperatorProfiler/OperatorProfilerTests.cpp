@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+#include "util/OperatorProfiler.h"
+#include "controllers/MetaController.h"
+#include "operators/Operator.h"
+#include "util/Randomizer.h"
+#include "util/PseudoRandomSource.h"
+#include <memory>
+#include <numeric>
+
+// MetaController exposing the operator lookup so tests can edit connections directly
+class ProfilerTestMetaController : public MetaController {
+public:
+    using MetaController::MetaController;
+    using MetaController::getOperatorPtr;
+};
+
+static uint64_t sum(const std::vector<uint64_t>& histogram) {
+    return std::accumulate(histogram.begin(), histogram.end(), uint64_t{0});
+}
+
+// Test that counters are recorded per operator ID and unknown IDs read as zero
+TEST(OperatorProfilerTest, Record_CountsPerOperator) {
+    OperatorProfiler profiler;
+    profiler.recordDelivery(7);
+    profiler.recordDelivery(7);
+    profiler.recordCheck(7, 3);
+    profiler.recordCheck(7, 0); // a check that emitted nothing is not a fire
+    profiler.recordTraversal(2);
+
+    OperatorCounters seven = profiler.getCounters(7);
+    EXPECT_EQ(seven.deliveries, 2u);
+    EXPECT_EQ(seven.fires, 1u);
+    EXPECT_EQ(seven.emitted, 3u);
+    EXPECT_EQ(seven.traversals, 0u);
+    EXPECT_EQ(profiler.getCounters(2).traversals, 1u);
+    EXPECT_EQ(profiler.getCounters(1000).deliveries, 0u);
+}
+
+// Test that top-K ranks by the chosen metric, breaks ties by ID and skips idle operators
+TEST(OperatorProfilerTest, TopK_RanksByMetric) {
+    OperatorProfiler profiler;
+    for (int i = 0; i < 5; ++i) profiler.recordDelivery(10);
+    for (int i = 0; i < 2; ++i) profiler.recordDelivery(4);
+    for (int i = 0; i < 2; ++i) profiler.recordDelivery(3);
+    profiler.recordCheck(4, 9);
+
+    auto top = profiler.topK(2, OperatorProfiler::Metric::DELIVERIES);
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top[0].first, 10u);
+    EXPECT_EQ(top[1].first, 3u); // tie with 4, lower ID first
+
+    auto byEmitted = profiler.topK(10, OperatorProfiler::Metric::EMITTED);
+    ASSERT_EQ(byEmitted.size(), 1u);
+    EXPECT_EQ(byEmitted[0].first, 4u);
+}
+
+// Test that clear discards the counters
+TEST(OperatorProfilerTest, Clear_ResetsCounters) {
+    OperatorProfiler profiler;
+    profiler.recordDelivery(1);
+    profiler.clear();
+    EXPECT_EQ(profiler.getCounters(1).deliveries, 0u);
+    EXPECT_TRUE(profiler.topK(5, OperatorProfiler::Metric::DELIVERIES).empty());
+}
+
+// Test the power-of-two buckets
+TEST(OperatorProfilerTest, Buckets_PowersOfTwo) {
+    EXPECT_EQ(OperatorProfiler::bucketIndex(0), 0u);
+    EXPECT_EQ(OperatorProfiler::bucketIndex(1), 1u);
+    EXPECT_EQ(OperatorProfiler::bucketIndex(3), 2u);
+    EXPECT_EQ(OperatorProfiler::bucketIndex(4), 3u);
+    EXPECT_EQ(OperatorProfiler::bucketIndex(7), 3u);
+    EXPECT_EQ(OperatorProfiler::bucketLabel(0), "0");
+    EXPECT_EQ(OperatorProfiler::bucketLabel(1), "1");
+    EXPECT_EQ(OperatorProfiler::bucketLabel(3), "4-7");
+}
+
+// Test that the histograms account for every operator and connection of a random network
+TEST(OperatorProfilerTest, Histograms_CoverWholeNetwork) {
+    auto randomizer = std::make_unique<Randomizer>(std::make_unique<PseudoRandomSource>(7));
+    ProfilerTestMetaController metaController(20, randomizer.get());
+
+    DegreeHistograms histograms = OperatorProfiler::buildDegreeHistograms(metaController);
+    EXPECT_EQ(histograms.operatorCount, metaController.getOpCount());
+    EXPECT_EQ(sum(histograms.outDegree), histograms.operatorCount);
+    EXPECT_EQ(sum(histograms.inDegree), histograms.operatorCount);
+    EXPECT_EQ(sum(histograms.distance), histograms.connectionCount);
+}
+
+// Test that a new connection shows up in the connection count, the distance bucket and the dangling count
+TEST(OperatorProfilerTest, Histograms_TrackConnectionChanges) {
+    auto randomizer = std::make_unique<Randomizer>(std::make_unique<PseudoRandomSource>(7));
+    ProfilerTestMetaController metaController(1, randomizer.get());
+    DegreeHistograms before = OperatorProfiler::buildDegreeHistograms(metaController);
+
+    Operator* internalOp = metaController.getOperatorPtr(6);
+    ASSERT_NE(internalOp, nullptr);
+    internalOp->addConnectionInternal(999999, 5); // no operator with that ID
+
+    DegreeHistograms after = OperatorProfiler::buildDegreeHistograms(metaController);
+    size_t distanceBucket = OperatorProfiler::bucketIndex(5);
+    uint64_t distanceBefore = distanceBucket < before.distance.size() ? before.distance[distanceBucket] : 0;
+    EXPECT_EQ(after.connectionCount, before.connectionCount + 1);
+    EXPECT_EQ(after.distance[distanceBucket], distanceBefore + 1);
+    EXPECT_EQ(after.danglingConnections, before.danglingConnections + 1);
+}
+
+// Test that the report lists the top operators and the three histograms
+TEST(OperatorProfilerTest, Report_ContainsSections) {
+    auto randomizer = std::make_unique<Randomizer>(std::make_unique<PseudoRandomSource>(7));
+    ProfilerTestMetaController metaController(5, randomizer.get());
+    OperatorProfiler profiler;
+    profiler.recordDelivery(6);
+
+    std::string report = profiler.buildReport(metaController, 3, OperatorProfiler::Metric::DELIVERIES);
+    EXPECT_NE(report.find("Top 3 Operators by deliveries"), std::string::npos);
+    EXPECT_NE(report.find("Out-degree"), std::string::npos);
+    EXPECT_NE(report.find("In-degree"), std::string::npos);
+    EXPECT_NE(report.find("Distance"), std::string::npos);
+}
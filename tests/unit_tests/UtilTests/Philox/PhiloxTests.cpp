@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include "util/Philox.h"
+#include "util/PhiloxRandomSource.h"
+#include "util/Randomizer.h"
+#include <memory>
+#include <vector>
+
+// Test the Philox4x32-10 known-answer vectors of the reference implementation (Random123)
+TEST(PhiloxTest, GenerateBlock_MatchesKnownAnswers) {
+    EXPECT_EQ(Philox::generateBlock(0, 0, 0), (Philox::Block{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+    EXPECT_EQ(Philox::generateBlock(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL),
+              (Philox::Block{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+}
+
+// Test that the same seed and stream reproduce the sequence and other streams differ
+TEST(PhiloxTest, Streams_AreReproducibleAndIndependent) {
+    Philox a(42), b(42);
+    Philox other = a.substream(1);
+    size_t equalToOther = 0;
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t value = a.nextUint32();
+        EXPECT_EQ(value, b.nextUint32());
+        if (value == other.nextUint32()) ++equalToOther;
+    }
+    EXPECT_LT(equalToOther, 3u);
+}
+
+// Test that seek jumps to a block: block n holds values 4n..4n+3 of the stream
+TEST(PhiloxTest, Seek_JumpsToBlock) {
+    Philox sequential(7, 3);
+    std::vector<uint32_t> values(40);
+    for (auto& value : values) value = sequential.nextUint32();
+
+    Philox jumped(7, 3);
+    jumped.seek(5);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(jumped.nextUint32(), values[20 + i]);
+    }
+}
+
+// Test that bulk fill continues the scalar sequence exactly, including partial blocks
+TEST(PhiloxTest, Fill_MatchesScalarSequence) {
+    Philox scalar(99);
+    std::vector<uint32_t> expected(23);
+    for (auto& value : expected) value = scalar.nextUint32();
+
+    Philox bulk(99);
+    std::vector<uint32_t> actual(23);
+    actual[0] = bulk.nextUint32();         // leave a partially consumed block
+    bulk.fill(actual.data() + 1, 17);      // drain it, whole blocks, then a partial block
+    bulk.fill(actual.data() + 18, 5);
+    EXPECT_EQ(actual, expected);
+}
+
+// Test integer ranges: bounds respected, every value reachable, swapped bounds and the full range
+TEST(PhiloxTest, Ints_StayInRangeAndCoverIt) {
+    Philox rng(5);
+    std::vector<int> counts(7, 0);
+    std::vector<int> batch(7000);
+    rng.fillInt(batch.data(), batch.size(), -3, 3);
+    for (int value : batch) {
+        ASSERT_GE(value, -3);
+        ASSERT_LE(value, 3);
+        ++counts[value + 3];
+    }
+    for (int count : counts) {
+        EXPECT_GT(count, 800); // 1000 expected per value
+    }
+    for (int i = 0; i < 100; ++i) {
+        int value = rng.getInt(10, 4);
+        EXPECT_GE(value, 4);
+        EXPECT_LE(value, 10);
+    }
+    EXPECT_EQ(rng.getInt(8, 8), 8);
+    rng.getInt(INT32_MIN, INT32_MAX); // full range must not divide by zero
+}
+
+// Test doubles stay in [min, max)
+TEST(PhiloxTest, Doubles_StayInRange) {
+    Philox rng(11);
+    std::vector<double> values(1000);
+    rng.fillDouble(values.data(), values.size(), -1.0, 2.0);
+    double sum = 0.0;
+    for (double value : values) {
+        ASSERT_GE(value, -1.0);
+        ASSERT_LT(value, 2.0);
+        sum += value;
+    }
+    EXPECT_NEAR(sum / values.size(), 0.5, 0.1);
+}
+
+// Test the Randomizer batch path through PhiloxRandomSource matches the engine
+TEST(PhiloxTest, RandomizerFillInt_UsesSourceBatch) {
+    Randomizer randomizer(std::make_unique<PhiloxRandomSource>(123));
+    Philox engine(123);
+    std::vector<int> fromRandomizer(50), fromEngine(50);
+    randomizer.fillInt(fromRandomizer.data(), fromRandomizer.size(), 0, 511);
+    engine.fillInt(fromEngine.data(), fromEngine.size(), 0, 511);
+    EXPECT_EQ(fromRandomizer, fromEngine);
+}
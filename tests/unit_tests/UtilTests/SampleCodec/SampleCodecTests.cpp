@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+#include "util/SampleCodec.h"
+#include "util/ChannelInputQueue.h"
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+// Test that every byte survives the round trip and lands in the top value bits
+TEST(SampleCodecTest, Bytes_RoundTripAllValues) {
+    std::vector<uint8_t> bytes(256);
+    for (int i = 0; i < 256; ++i) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<int> messages(256);
+    SampleCodec::bytesToMessages(bytes.data(), bytes.size(), messages.data());
+    EXPECT_EQ(messages[0], 0);
+    EXPECT_EQ(messages[1], 1 << 23);
+    EXPECT_EQ(messages[255], 255 << 23);
+
+    std::vector<uint8_t> back(256);
+    SampleCodec::messagesToBytes(messages.data(), messages.size(), back.data());
+    EXPECT_EQ(back, bytes);
+}
+
+// Test that negative messages read by magnitude, as the text output does
+TEST(SampleCodecTest, MessagesToBytes_NegativeByMagnitude) {
+    const int messages[] = {-(200 << 23), -1, INT_MIN};
+    uint8_t bytes[3];
+    SampleCodec::messagesToBytes(messages, 3, bytes);
+    EXPECT_EQ(bytes[0], 200);
+    EXPECT_EQ(bytes[1], 0);
+    EXPECT_EQ(bytes[2], 0);
+}
+
+// Test that 16-bit samples keep their sign and value through the round trip
+TEST(SampleCodecTest, Samples16_RoundTripKeepsSign) {
+    const int16_t samples[] = {0, 1, -1, INT16_MAX, INT16_MIN, 1234, -4321};
+    int messages[7];
+    SampleCodec::samples16ToMessages(samples, 7, messages);
+    EXPECT_EQ(messages[1], 65536);
+    EXPECT_EQ(messages[2], -65536);
+    EXPECT_EQ(messages[4], INT_MIN);
+
+    int16_t back[7];
+    SampleCodec::messagesToSamples16(messages, 7, back);
+    for (int i = 0; i < 7; ++i) {
+        EXPECT_EQ(back[i], samples[i]);
+    }
+}
+
+// Test that the queue converts on submission and releases at most the rate per step
+TEST(ChannelInputQueueTest, NextStep_DeliversAtRate) {
+    ChannelInputQueue queue(16, 3);
+    const uint8_t pixels[] = {1, 2, 3, 4, 5};
+    EXPECT_EQ(queue.submitBytes(pixels, 5), 5u);
+    EXPECT_EQ(queue.pendingCount(), 5u);
+
+    std::vector<int> delivered;
+    auto collect = [&](const int* values, size_t count) { delivered.insert(delivered.end(), values, values + count); };
+    EXPECT_EQ(queue.nextStep(collect), 3u);
+    EXPECT_EQ(delivered, (std::vector<int>{1 << 23, 2 << 23, 3 << 23}));
+    EXPECT_EQ(queue.nextStep(collect), 2u);
+    EXPECT_EQ(queue.nextStep(collect), 0u);
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test that a full queue accepts only what fits, and the rest after a step drained room
+TEST(ChannelInputQueueTest, Submit_BackpressureWhenFull) {
+    ChannelInputQueue queue(4, 2);
+    const int16_t samples[] = {10, 20, 30, 40, 50, 60};
+    EXPECT_EQ(queue.submitSamples16(samples, 6), 4u);
+    EXPECT_EQ(queue.submitSamples16(samples + 4, 2), 0u);
+
+    std::vector<int> delivered;
+    auto collect = [&](const int* values, size_t count) { delivered.insert(delivered.end(), values, values + count); };
+    queue.nextStep(collect);
+    EXPECT_EQ(queue.submitSamples16(samples + 4, 2), 2u); // wraps around the ring
+    queue.setSamplesPerStep(10);
+    queue.nextStep(collect);
+
+    std::vector<int16_t> back(delivered.size());
+    SampleCodec::messagesToSamples16(delivered.data(), delivered.size(), back.data());
+    EXPECT_EQ(back, (std::vector<int16_t>{10, 20, 30, 40, 50, 60}));
+}
@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+#include "util/SeqLock.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace {
+    // Every field carries the same value, a torn read would mix two of them
+    struct Record {
+        uint64_t values[12];
+        int32_t tail;
+    };
+
+    Record makeRecord(uint64_t value) {
+        Record record{};
+        for (uint64_t& field : record.values) {
+            field = value;
+        }
+        record.tail = static_cast<int32_t>(value);
+        return record;
+    }
+}
+
+// Test that the initial value is value-initialized and stores are read back
+TEST(SeqLockTest, StoreThenLoad) {
+    SeqLock<Record> lock;
+    EXPECT_EQ(lock.load().values[0], 0u);
+    EXPECT_EQ(lock.getVersion(), 1u);
+
+    lock.store(makeRecord(42));
+    Record record = lock.load();
+    EXPECT_EQ(record.values[11], 42u);
+    EXPECT_EQ(record.tail, 42);
+    EXPECT_EQ(lock.getVersion(), 2u);
+}
+
+// Test that readers racing a writer only ever see complete values, in publication order
+TEST(SeqLockTest, ConcurrentReadersNeverSeeTornValues) {
+    SeqLock<Record> lock;
+    std::atomic<bool> done{false};
+    std::atomic<int> tornReads{0};
+
+    auto reader = [&]() {
+        uint64_t previous = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            Record record = lock.load();
+            for (uint64_t field : record.values) {
+                if (field != record.values[0]) {
+                    tornReads++;
+                }
+            }
+            if (record.tail != static_cast<int32_t>(record.values[0]) || record.values[0] < previous) {
+                tornReads++;
+            }
+            previous = record.values[0];
+        }
+    };
+    std::thread first(reader);
+    std::thread second(reader);
+    for (uint64_t value = 1; value <= 200000; ++value) {
+        lock.store(makeRecord(value));
+    }
+    done.store(true, std::memory_order_release);
+    first.join();
+    second.join();
+
+    EXPECT_EQ(tornReads.load(), 0);
+    EXPECT_EQ(lock.load().values[0], 200000u);
+}
@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+#include "util/SpscRing.h"
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Helper: consumes up to maxItems and returns them as a vector
+static std::vector<int> consumeAll(SpscRing<int>& ring, size_t maxItems = SIZE_MAX) {
+    std::vector<int> out;
+    ring.consume(maxItems, [&out](const int* values, size_t count) {
+        out.insert(out.end(), values, values + count);
+    });
+    return out;
+}
+
+// Test FIFO order, batch limits and size tracking
+TEST(SpscRingTest, PushConsume_FifoAndBatchLimit) {
+    SpscRing<int> ring(8);
+    EXPECT_TRUE(ring.empty());
+    for (int i = 1; i <= 5; ++i) {
+        EXPECT_TRUE(ring.push(i));
+    }
+    EXPECT_EQ(ring.size(), 5u);
+    EXPECT_EQ(consumeAll(ring, 3), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(ring.size(), 2u);
+    EXPECT_EQ(consumeAll(ring), (std::vector<int>{4, 5}));
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.consume(10, [](const int*, size_t) { FAIL() << "nothing to consume"; }), 0u);
+}
+
+// Test that a full ring rejects new items until the consumer frees space, and the capacity is exact
+TEST(SpscRingTest, Full_RejectsNewItems) {
+    SpscRing<int> ring(5); // 8 slots, but only 5 items allowed
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(ring.push(i));
+    }
+    EXPECT_FALSE(ring.push(99));
+    EXPECT_EQ(ring.size(), 5u);
+    EXPECT_EQ(consumeAll(ring, 2), (std::vector<int>{0, 1}));
+    EXPECT_TRUE(ring.push(5));
+    EXPECT_TRUE(ring.push(6));
+    EXPECT_FALSE(ring.push(7));
+    EXPECT_EQ(consumeAll(ring), (std::vector<int>{2, 3, 4, 5, 6}));
+}
+
+// Test that a range crossing the end of the slot array is handed out as two spans, in order
+TEST(SpscRingTest, Wraparound_TwoSpans) {
+    SpscRing<int> ring(4);
+    for (int i = 0; i < 3; ++i) {
+        ring.push(i);
+    }
+    consumeAll(ring);
+    for (int i = 10; i < 14; ++i) {
+        ASSERT_TRUE(ring.push(i)); // slots 3, 0, 1, 2
+    }
+
+    std::vector<size_t> spans;
+    std::vector<int> peeked;
+    EXPECT_EQ(ring.peek(10, [&](const int* values, size_t count) {
+        spans.push_back(count);
+        peeked.insert(peeked.end(), values, values + count);
+    }), 4u);
+    EXPECT_EQ(spans, (std::vector<size_t>{1, 3}));
+    EXPECT_EQ(peeked, (std::vector<int>{10, 11, 12, 13}));
+    EXPECT_EQ(ring.size(), 4u); // peek does not consume
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    EXPECT_TRUE(ring.push(20));
+    EXPECT_EQ(consumeAll(ring), (std::vector<int>{20}));
+}
+
+// Test a producer and a consumer thread: every item arrives once, in order
+TEST(SpscRingTest, Concurrent_ProducerConsumerKeepOrder) {
+    constexpr int ITEMS = 200000;
+    SpscRing<int> ring(1024);
+
+    std::thread producer([&ring] {
+        for (int i = 0; i < ITEMS; ++i) {
+            while (!ring.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    bool inOrder = true;
+    while (expected < ITEMS) {
+        size_t taken = ring.consume(256, [&](const int* values, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                inOrder = inOrder && values[i] == expected + static_cast<int>(i);
+            }
+            expected += static_cast<int>(count);
+        });
+        if (taken == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(expected, ITEMS);
+    EXPECT_TRUE(ring.empty());
+}
+
+// Test that a growing ring keeps unread items across a wrap, doubles up to the cap and then drops the newest
+TEST(SpscRingTest, Growth_KeepsItemsAndStopsAtCapacity) {
+    SpscRing<int> ring(20, 4);
+    EXPECT_EQ(ring.getAllocatedSlots(), 0u); // nothing until the first push
+    for (int i = 0; i < 3; ++i) {
+        ring.push(i);
+    }
+    EXPECT_EQ(ring.getAllocatedSlots(), 4u);
+    consumeAll(ring, 2);
+    for (int i = 3; i < 6; ++i) {
+        ASSERT_TRUE(ring.push(i)); // wraps in the 4 slots
+    }
+    ASSERT_TRUE(ring.push(6)); // full, grows to 8
+    EXPECT_EQ(ring.getAllocatedSlots(), 8u);
+    EXPECT_EQ(consumeAll(ring), (std::vector<int>{2, 3, 4, 5, 6}));
+
+    size_t produced = ring.produce(25, [](int* slots, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            slots[i] = 100;
+        }
+    });
+    EXPECT_EQ(produced, 20u); // grown straight to the 32 slots the cap of 20 rounds up to
+    EXPECT_EQ(ring.getAllocatedSlots(), 32u);
+    EXPECT_FALSE(ring.push(7));
+    EXPECT_EQ(ring.size(), 20u);
+}
+
+// Test that the consumer keeps reading correctly while the producer grows the ring
+TEST(SpscRingTest, Concurrent_GrowthKeepsOrder) {
+    constexpr int ITEMS = 200000;
+    SpscRing<int> ring(1 << 16, 2);
+
+    std::thread producer([&ring] {
+        for (int i = 0; i < ITEMS; ++i) {
+            while (!ring.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    bool inOrder = true;
+    while (expected < ITEMS) {
+        ring.consume(7, [&](const int* values, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                inOrder = inOrder && values[i] == expected + static_cast<int>(i);
+            }
+            expected += static_cast<int>(count);
+        });
+    }
+    producer.join();
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(expected, ITEMS);
+}
@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+#include "util/StepStats.h"
+
+// Helper: a sample whose traversal takes `micros` microseconds and which delivered `messages` messages
+static StepSample makeSample(uint64_t micros, uint64_t messages) {
+    StepSample sample;
+    sample.traversalNs = micros * 1000;
+    sample.messagesDelivered = messages;
+    return sample;
+}
+
+// Test that an empty window summarizes to zeros
+TEST(StepStatsTest, Summarize_EmptyIsZero) {
+    StepStats stats;
+    StepStatsSummary summary = stats.summarize();
+    EXPECT_EQ(summary.windowSteps, 0u);
+    EXPECT_EQ(summary.totalSteps, 0u);
+    EXPECT_DOUBLE_EQ(summary.traversalUs.mean, 0.0);
+    EXPECT_EQ(summary.dominantPhase(), "none");
+}
+
+// Test mean, nearest-rank percentiles, max and last over 1..100
+TEST(StepStatsTest, Summarize_MeanAndPercentiles) {
+    StepStats stats(100);
+    for (uint64_t i = 1; i <= 100; ++i) {
+        stats.record(makeSample(i, i * 2));
+    }
+
+    StepStatsSummary summary = stats.summarize();
+    EXPECT_EQ(summary.windowSteps, 100u);
+    EXPECT_DOUBLE_EQ(summary.traversalUs.mean, 50.5);
+    EXPECT_DOUBLE_EQ(summary.traversalUs.p50, 50.0);
+    EXPECT_DOUBLE_EQ(summary.traversalUs.p95, 95.0);
+    EXPECT_DOUBLE_EQ(summary.traversalUs.p99, 99.0);
+    EXPECT_DOUBLE_EQ(summary.traversalUs.max, 100.0);
+    EXPECT_DOUBLE_EQ(summary.traversalUs.last, 100.0);
+    EXPECT_DOUBLE_EQ(summary.messagesDelivered.mean, 101.0);
+    EXPECT_DOUBLE_EQ(summary.stepUs.mean, 50.5); // only traversal was timed
+}
+
+// Test that the window keeps only the most recent samples while the total keeps counting
+TEST(StepStatsTest, Record_WindowRollsOver) {
+    StepStats stats(4);
+    for (uint64_t i = 1; i <= 10; ++i) {
+        stats.record(makeSample(i, 0));
+    }
+
+    EXPECT_EQ(stats.getSampleCount(), 4u);
+    EXPECT_EQ(stats.getTotalSteps(), 10u);
+    EXPECT_EQ(stats.getLastSample().traversalNs, 10000u);
+
+    StepStatsSummary summary = stats.summarize();
+    EXPECT_DOUBLE_EQ(summary.traversalUs.mean, 8.5); // samples 7..10
+    EXPECT_DOUBLE_EQ(summary.traversalUs.max, 10.0);
+}
+
+// Test that the phase with the highest mean time is reported as dominant
+TEST(StepStatsTest, DominantPhase_HighestMeanTime) {
+    StepStats stats;
+    StepSample sample;
+    sample.traversalNs = 1000;
+    sample.operatorChecksNs = 500;
+    sample.updatesNs = 4000;
+    sample.advanceNs = 10;
+    stats.record(sample);
+
+    EXPECT_EQ(stats.summarize().dominantPhase(), "updates");
+}
+
+// Test that clear discards samples and the total
+TEST(StepStatsTest, Clear_ResetsWindow) {
+    StepStats stats(8);
+    stats.record(makeSample(5, 1));
+    stats.clear();
+
+    EXPECT_EQ(stats.getSampleCount(), 0u);
+    EXPECT_EQ(stats.getTotalSteps(), 0u);
+    EXPECT_EQ(stats.summarize().windowSteps, 0u);
+}
@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+#include "util/TextInputStream.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+// Fixture writing a corpus to a temporary file
+class TextInputStreamTest : public ::testing::Test {
+protected:
+    std::string path = "text_input_stream_test.txt";
+
+    void writeCorpus(const std::string& text) {
+        std::ofstream out(path, std::ios::binary);
+        out << text;
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    static TextStreamOptions makeOptions(size_t charsPerStep, size_t capacity, size_t maxInFlight = 0) {
+        TextStreamOptions options;
+        options.charsPerStep = charsPerStep;
+        options.bufferCapacity = capacity;
+        options.maxInFlightPayloads = maxInFlight;
+        return options;
+    }
+};
+
+// Test that a file is fed in order, at most charsPerStep per step, and drains at the end
+TEST_F(TextInputStreamTest, FeedsFileAtRateInOrder) {
+    std::string corpus;
+    for (int i = 0; i < 1000; ++i) {
+        corpus += static_cast<char>('a' + i % 26);
+    }
+    writeCorpus(corpus);
+    auto stream = TextInputStream::open(path, makeOptions(7, 64));
+    ASSERT_NE(stream, nullptr);
+
+    std::string fed;
+    std::string step;
+    int steps = 0;
+    while (!stream->isDrained()) {
+        size_t taken = stream->nextStep(0, step);
+        EXPECT_LE(taken, 7u);
+        EXPECT_EQ(step.size(), taken);
+        EXPECT_LE(stream->getStats().buffered, 64u); // never more than the ring in memory
+        fed += step;
+        ASSERT_LT(++steps, 1000) << "stream did not drain";
+    }
+    EXPECT_EQ(fed, corpus); // wrapping around the 64-byte ring keeps the order
+    EXPECT_EQ(steps, (1000 + 6) / 7);
+    EXPECT_EQ(stream->getStats().charsFed, 1000u);
+    EXPECT_EQ(stream->getStats().charsRead, 1000u);
+    EXPECT_EQ(stream->nextStep(0, step), 0u);
+}
+
+// Test that nothing is fed (or read) while the network is at the in-flight limit
+TEST_F(TextInputStreamTest, Backpressure_ThrottlesAtInFlightLimit) {
+    writeCorpus("hello world");
+    auto stream = TextInputStream::open(path, makeOptions(4, 16, 100));
+    ASSERT_NE(stream, nullptr);
+    std::string step;
+
+    EXPECT_EQ(stream->nextStep(100, step), 0u);
+    EXPECT_EQ(stream->nextStep(250, step), 0u);
+    EXPECT_TRUE(step.empty());
+    EXPECT_EQ(stream->getStats().throttledSteps, 2u);
+    EXPECT_EQ(stream->getStats().charsRead, 0u);
+
+    EXPECT_EQ(stream->nextStep(99, step), 4u);
+    EXPECT_EQ(step, "hell");
+}
+
+// Test that a pipe with no data yet feeds nothing without blocking, and ends when the writer closes
+TEST_F(TextInputStreamTest, Pipe_NonBlockingAndEndsOnClose) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    TextInputStream stream(fds[0], makeOptions(3, 8));
+    std::string step;
+
+    EXPECT_EQ(stream.nextStep(0, step), 0u); // nothing written yet, must not block
+    EXPECT_FALSE(stream.isDrained());
+
+    ASSERT_EQ(write(fds[1], "abcde", 5), 5);
+    EXPECT_EQ(stream.nextStep(0, step), 3u);
+    EXPECT_EQ(step, "abc");
+    EXPECT_EQ(stream.nextStep(0, step), 2u);
+    EXPECT_EQ(step, "de");
+    EXPECT_FALSE(stream.isDrained()); // writer still open
+
+    close(fds[1]);
+    EXPECT_EQ(stream.nextStep(0, step), 0u);
+    EXPECT_TRUE(stream.isDrained());
+    EXPECT_TRUE(stream.getStats().sourceExhausted);
+}
+
+// Test option validation and a missing file
+TEST_F(TextInputStreamTest, InvalidOptionsAndMissingFile) {
+    writeCorpus("x");
+    EXPECT_THROW(TextInputStream::open(path, makeOptions(0, 16)), std::invalid_argument);
+    EXPECT_THROW(TextInputStream::open(path, makeOptions(32, 16)), std::invalid_argument);
+    EXPECT_EQ(TextInputStream::open("does_not_exist_text_stream.txt", makeOptions(1, 16)), nullptr);
+}
@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+#include "util/Tracer.h"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// Helper: number of occurrences of `needle` in `text`
+static size_t countOccurrences(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+
+class TracerTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        Tracer::stop();
+    }
+};
+
+// Test that nothing is recorded while tracing is stopped
+TEST_F(TracerTest, Record_IgnoredWhenStopped) {
+    Tracer::start();
+    Tracer::stop();
+    Tracer::recordComplete("ignored", Tracer::nowNs(), Tracer::nowNs());
+    EXPECT_EQ(Tracer::getEventCount(), 0u);
+}
+
+// Test that recorded events show up as complete events in the JSON
+TEST_F(TracerTest, ChromeJson_ContainsCompleteEvents) {
+    Tracer::start();
+    uint64_t start = Tracer::nowNs();
+    Tracer::recordComplete("phase-a", start, start + 5000);
+    Tracer::recordComplete("phase-b", start + 6000, start + 7000);
+    Tracer::stop();
+
+    std::string json = Tracer::toChromeTraceJson();
+    EXPECT_EQ(Tracer::getEventCount(), 2u);
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"phase-a\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"phase-b\""), std::string::npos);
+    EXPECT_NE(json.find("\"dur\":5.000"), std::string::npos);
+    EXPECT_EQ(countOccurrences(json, "\"ph\":\"X\""), 2u);
+    EXPECT_LT(json.find("phase-a"), json.find("phase-b")); // sorted by start time
+}
+
+// Test that starting a new trace discards the previous one
+TEST_F(TracerTest, Start_DiscardsPreviousTrace) {
+    Tracer::start();
+    Tracer::recordComplete("old", Tracer::nowNs(), Tracer::nowNs());
+    Tracer::start();
+    Tracer::recordComplete("new", Tracer::nowNs(), Tracer::nowNs());
+    Tracer::stop();
+
+    std::string json = Tracer::toChromeTraceJson();
+    EXPECT_EQ(json.find("\"old\""), std::string::npos);
+    EXPECT_NE(json.find("\"new\""), std::string::npos);
+}
+
+// Test that a full ring keeps only the most recent events
+TEST_F(TracerTest, Ring_KeepsMostRecentEvents) {
+    Tracer::start(4);
+    const char* names[] = {"e0", "e1", "e2", "e3", "e4", "e5"};
+    for (const char* name : names) {
+        uint64_t now = Tracer::nowNs();
+        Tracer::recordComplete(name, now, now);
+    }
+    Tracer::stop();
+
+    std::string json = Tracer::toChromeTraceJson();
+    EXPECT_EQ(Tracer::getEventCount(), 4u);
+    EXPECT_EQ(json.find("\"e1\""), std::string::npos);
+    EXPECT_NE(json.find("\"e2\""), std::string::npos);
+    EXPECT_NE(json.find("\"e5\""), std::string::npos);
+}
+
+// Test that each recording thread gets its own ring and tid
+TEST_F(TracerTest, Threads_RecordIntoSeparateRings) {
+    Tracer::start();
+    auto work = [](const char* name) {
+        for (int i = 0; i < 100; ++i) {
+            uint64_t now = Tracer::nowNs();
+            Tracer::recordComplete(name, now, now + 1);
+        }
+    };
+    std::thread first(work, "worker-1");
+    std::thread second(work, "worker-2");
+    first.join();
+    second.join();
+    Tracer::stop();
+
+    // rings outlive their threads, so the events are still written out
+    std::string json = Tracer::toChromeTraceJson();
+    EXPECT_EQ(Tracer::getEventCount(), 200u);
+    EXPECT_EQ(countOccurrences(json, "\"worker-1\""), 100u);
+    EXPECT_EQ(countOccurrences(json, "\"worker-2\""), 100u);
+}
+
+// Test that threads started one after another reuse the ring of an exited thread
+TEST_F(TracerTest, Threads_ExitedRingsAreReused) {
+    Tracer::start();
+    std::thread warmup([] { Tracer::recordComplete("warmup", Tracer::nowNs(), Tracer::nowNs()); });
+    warmup.join();
+    size_t ringsBefore = Tracer::getRingCount();
+
+    for (int i = 0; i < 50; ++i) {
+        std::thread transient([] { Tracer::recordComplete("transient", Tracer::nowNs(), Tracer::nowNs()); });
+        transient.join();
+    }
+    Tracer::stop();
+
+    EXPECT_EQ(Tracer::getRingCount(), ringsBefore);
+    EXPECT_EQ(countOccurrences(Tracer::toChromeTraceJson(), "\"transient\""), 50u);
+}
+
+// Test that dumping while a thread wraps its ring only returns complete events
+TEST_F(TracerTest, Collect_WhileWrappingReturnsValidEvents) {
+    Tracer::start(8);
+    std::atomic<bool> done{false};
+    std::thread writer([&done] {
+        while (!done.load()) {
+            uint64_t now = Tracer::nowNs();
+            Tracer::recordComplete("wrapping", now, now + 3000);
+        }
+    });
+    for (int i = 0; i < 200; ++i) {
+        std::string json = Tracer::toChromeTraceJson();
+        EXPECT_EQ(countOccurrences(json, "\"ph\":\"X\""), countOccurrences(json, "\"wrapping\""));
+        EXPECT_LE(countOccurrences(json, "\"wrapping\""), 8u);
+    }
+    done.store(true);
+    writer.join();
+    Tracer::stop();
+}
+
+// Test that the scope macro records when compiled in, and the trace can be written to disk
+TEST_F(TracerTest, ScopeMacro_WritesTraceFile) {
+    Tracer::start();
+    {
+        ATHENA_TRACE_SCOPE("scoped-phase");
+    }
+    Tracer::stop();
+
+    const std::string path = "tracer_test_trace.json";
+    ASSERT_TRUE(Tracer::writeChromeTrace(path));
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::remove(path.c_str());
+
+    size_t expected = Tracer::isCompiledIn() ? 1u : 0u;
+    EXPECT_EQ(countOccurrences(contents.str(), "\"scoped-phase\""), expected);
+}
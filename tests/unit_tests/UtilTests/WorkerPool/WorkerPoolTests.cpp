@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+#include "util/WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+// Test that every task index runs exactly once
+TEST(WorkerPoolTest, ParallelFor_RunsEveryTaskOnce) {
+    WorkerPool pool(3);
+    EXPECT_EQ(pool.getThreadCount(), 4u);
+
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallelFor(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+
+    for (const auto& hit : hits) {
+        EXPECT_EQ(hit.load(), 1);
+    }
+}
+
+// Test that the pool can be reused for many consecutive phases
+TEST(WorkerPoolTest, ParallelFor_ReusableAcrossPhases) {
+    WorkerPool pool(2);
+    std::atomic<size_t> total{0};
+    for (int phase = 0; phase < 200; ++phase) {
+        pool.parallelFor(8, [&](size_t i) { total.fetch_add(i); });
+    }
+    EXPECT_EQ(total.load(), 200u * 28u);
+}
+
+// Test that a pool without workers runs everything on the calling thread
+TEST(WorkerPoolTest, ZeroWorkers_RunsInline) {
+    WorkerPool pool(0);
+    EXPECT_EQ(pool.getThreadCount(), 1u);
+
+    std::vector<int> order;
+    pool.parallelFor(5, [&](size_t i) { order.push_back(static_cast<int>(i)); });
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+// Test that a task exception is rethrown once the phase has finished
+TEST(WorkerPoolTest, TaskException_RethrownToCaller) {
+    WorkerPool pool(2);
+    std::atomic<int> completed{0};
+    EXPECT_THROW(pool.parallelFor(16, [&](size_t i) {
+        if (i == 3) throw std::runtime_error("task failed");
+        completed.fetch_add(1);
+    }), std::runtime_error);
+    EXPECT_EQ(completed.load(), 15);
+
+    // still usable afterwards
+    pool.parallelFor(4, [&](size_t) { completed.fetch_add(1); });
+    EXPECT_EQ(completed.load(), 19);
+}
+
+// Test that a dispatched phase runs on the same worker thread while the caller continues, and join waits for it
+TEST(WorkerPoolTest, DispatchJoin_RunsOnPersistentWorker) {
+    WorkerPool pool(1);
+    std::vector<std::thread::id> threads;
+    std::function<void(size_t)> task = [&](size_t) { threads.push_back(std::this_thread::get_id()); };
+    for (int phase = 0; phase < 50; ++phase) {
+        pool.dispatch(1, task);
+        pool.join();
+    }
+    pool.join(); // nothing dispatched, returns at once
+    ASSERT_EQ(threads.size(), 50u);
+    EXPECT_NE(threads[0], std::this_thread::get_id());
+    EXPECT_EQ(std::count(threads.begin(), threads.end(), threads[0]), 50);
+
+    std::function<void(size_t)> failing = [](size_t) { throw std::runtime_error("task failed"); };
+    pool.dispatch(1, failing);
+    EXPECT_THROW(pool.join(), std::runtime_error);
+}
+
+#ifdef __linux__
+// Test that pinned workers and a pinned thread run on their CPU, and pinned pools still run every task
+TEST(WorkerPoolTest, CpuPinning_PinsThreads) {
+    unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    size_t cpu = hardwareThreads - 1;
+    std::thread pinned([cpu] {
+        if (WorkerPool::pinCurrentThread(cpu)) { // a restricted cpuset may refuse it
+            EXPECT_EQ(sched_getcpu(), static_cast<int>(cpu));
+        }
+    });
+    pinned.join();
+
+    WorkerPool::setCpuPinning(true, 0);
+    {
+        WorkerPool pool(2);
+        std::vector<std::atomic<int>> hits(256);
+        pool.parallelFor(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+        for (const auto& hit : hits) {
+            EXPECT_EQ(hit.load(), 1);
+        }
+    }
+    WorkerPool::setCpuPinning(false);
+}
+
+// Test that a scoped pin restores the thread's CPUs and that threads started before it keep theirs
+TEST(WorkerPoolTest, ScopedThreadPin_RestoresAffinity) {
+    std::thread worker([] {
+        cpu_set_t before;
+        CPU_ZERO(&before);
+        ASSERT_EQ(sched_getaffinity(0, sizeof(before), &before), 0);
+        {
+            ScopedThreadPin pin(0);
+            if (pin.isPinned()) {
+                cpu_set_t during;
+                CPU_ZERO(&during);
+                sched_getaffinity(0, sizeof(during), &during);
+                EXPECT_EQ(CPU_COUNT(&during), 1);
+            }
+        }
+        cpu_set_t after;
+        CPU_ZERO(&after);
+        ASSERT_EQ(sched_getaffinity(0, sizeof(after), &after), 0);
+        EXPECT_TRUE(CPU_EQUAL(&before, &after));
+    });
+    worker.join();
+}
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "util/AllocationCounter.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * GoogleTest helpers over AllocationCounter.
+ *
+ * The test binary must install the counting operator new: include "util/AllocationHooks.h" in exactly one
+ * .cpp of the test folder. Without it the assertions fail instead of passing vacuously.
+ *
+ * Usage:
+ *     EXPECT_NO_ALLOCATIONS(timeController.processCurrentStep());
+ *     EXPECT_EQ(AllocationTestHelpers::countAllocations([&] { buildThing(); }), 3u);
+ */
+namespace AllocationTestHelpers {
+
+// Number of allocations made by the calling thread while running `fn`
+template <typename Fn>
+uint64_t countAllocations(Fn&& fn) {
+    AllocationCounter::Scope scope;
+    fn();
+    return scope.allocations();
+}
+
+// Success if `fn` made no allocation on the calling thread, otherwise a failure with the count and bytes
+template <typename Fn>
+::testing::AssertionResult allocatesNothing(Fn&& fn) {
+    if (!AllocationCounter::isInstalled()) {
+        return ::testing::AssertionFailure()
+               << "allocation hooks are not installed, include util/AllocationHooks.h in one .cpp of this test binary";
+    }
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    {
+        AllocationCounter::Scope scope;
+        fn();
+        allocations = scope.allocations();
+        bytes = scope.bytes();
+    }
+    if (allocations == 0) {
+        return ::testing::AssertionSuccess();
+    }
+    return ::testing::AssertionFailure() << allocations << " allocation(s), " << bytes << " bytes";
+}
+
+} // namespace AllocationTestHelpers
+
+#define EXPECT_NO_ALLOCATIONS(statement) \
+    EXPECT_TRUE(AllocationTestHelpers::allocatesNothing([&]() { statement; })) << "in: " #statement
+
+#define ASSERT_NO_ALLOCATIONS(statement) \
+    ASSERT_TRUE(AllocationTestHelpers::allocatesNothing([&]() { statement; })) << "in: " #statement
@@ -10,7 +10,7 @@
 #include <unordered_map>
 #include <stdexcept>
 //#include "Payload.h"
-//#include "UpdateEvent.h"
+#include "UpdateEvent.h"
 
 /**
  * @class MockMetaController
@@ -176,7 +176,7 @@ public:
 
     /* NOT NEEDED ATM
     // --- Mocked Update Handlers ---
-    void handleCreateOperator(const std::vector<int>& params) override {
+    void handleCreateOperator(const UpdateParams& params) override {
         callCount++;
         lastCall = LastCall::HANDLE_CREATE_OPERATOR;
         lastParams = params;
@@ -188,28 +188,28 @@ public:
         lastOperatorId = targetOperatorId;
     }
 
-    void handleParameterChange(uint32_t targetOperatorId, const std::vector<int>& params) override {
+    void handleParameterChange(uint32_t targetOperatorId, const UpdateParams& params) override {
         callCount++;
         lastCall = LastCall::HANDLE_PARAM_CHANGE;
         lastOperatorId = targetOperatorId;
         lastParams = params;
     }
 
-    void handleAddConnection(uint32_t targetOperatorId, const std::vector<int>& params) override {
+    void handleAddConnection(uint32_t targetOperatorId, const UpdateParams& params) override {
         callCount++;
         lastCall = LastCall::HANDLE_ADD_CONN;
         lastOperatorId = targetOperatorId;
         lastParams = params;
     }
 
-    void handleRemoveConnection(uint32_t targetOperatorId, const std::vector<int>& params) override {
+    void handleRemoveConnection(uint32_t targetOperatorId, const UpdateParams& params) override {
         callCount++;
         lastCall = LastCall::HANDLE_REMOVE_CONN;
         lastOperatorId = targetOperatorId;
         lastParams = params;
     }
     
-    void handleMoveConnection(uint32_t targetOperatorId, const std::vector<int>& params) override {
+    void handleMoveConnection(uint32_t targetOperatorId, const UpdateParams& params) override {
         callCount++;
         lastCall = LastCall::HANDLE_MOVE_CONN;
         lastOperatorId = targetOperatorId;
@@ -313,7 +313,7 @@ public:
         MetaController::traversePayload(payload);
     }
 
-    void baseHandleCreateOperator(const std::vector<int>& params){
+    void baseHandleCreateOperator(const UpdateParams& params){
         MetaController::handleCreateOperator(params);
     }
 
@@ -322,22 +322,22 @@ public:
     }
 
 
-    void baseHandleParameterChange(uint32_t targetOperatorId, const std::vector<int>& params){
+    void baseHandleParameterChange(uint32_t targetOperatorId, const UpdateParams& params){
         MetaController::handleParameterChange(targetOperatorId, params);
     }
 
   
-    void baseHandleAddConnection(uint32_t targetOperatorId, const std::vector<int>& params){
+    void baseHandleAddConnection(uint32_t targetOperatorId, const UpdateParams& params){
         MetaController::handleAddConnection(targetOperatorId, params);
     }
 
     
-    void baseHandleRemoveConnection(uint32_t targetOperatorId, const std::vector<int>& params){
+    void baseHandleRemoveConnection(uint32_t targetOperatorId, const UpdateParams& params){
         MetaController::handleRemoveConnection(targetOperatorId, params);
     }
 
     
-    void baseHandleMoveConnection(uint32_t targetOperatorId, const std::vector<int>& params){
+    void baseHandleMoveConnection(uint32_t targetOperatorId, const UpdateParams& params){
         MetaController::handleMoveConnection(targetOperatorId, params);
     }
 
@@ -70,7 +70,7 @@ public:
     void processData() override {
         lastMethodCalled = CalledMethod::PROCESS_DATA;
     }
-    void changeParams(const std::vector<int>& params) override {
+    void changeParams(const UpdateParams& params) override {
         lastMethodCalled = CalledMethod::CHANGE_PARAMS;
     }
     void randomInit(uint32_t maxId, Randomizer* rng) override {
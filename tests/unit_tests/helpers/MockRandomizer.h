@@ -61,6 +61,15 @@ public:
         return nextValue;
     }
 
+    /**
+     * @brief Overrides the base class fillInt so batched draws consume the queue like getInt calls.
+     */
+    void fillInt(int* out, size_t count, int min, int max) override {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = getInt(min, max);
+        }
+    }
+
     /**
      * @brief Overrides the base class getDouble method. Not used by the provided tests. 
      * @param min Minimum value.
@@ -30,7 +30,24 @@ public:
         SUBMIT_TEXT,
         GET_OUTPUT,
         GET_STATUS,
-        GET_JSON
+        RESET_STATS,
+        START_TRACE,
+        STOP_TRACE,
+        SET_LOG_LEVEL,
+        GENERATE_NETWORK,
+        SET_PROFILING,
+        RESET_PROFILE,
+        GET_PROFILE_REPORT,
+        GET_JSON,
+        OPEN_TEXT_STREAM,
+        CLOSE_TEXT_STREAM,
+        GET_TEXT_STREAM_STATS,
+        SUBMIT_IMAGE_FRAME,
+        SUBMIT_AUDIO_SAMPLES,
+        SET_CHANNEL_INPUT_RATE,
+        READ_IMAGE_OUTPUT,
+        READ_AUDIO_OUTPUT,
+        SET_PIPELINED_UPDATES
     };
 
     // --- Public State for Test Inspection ---
@@ -39,7 +56,18 @@ public:
     int lastNumOperators = -1;
     int lastNumSteps = -1;
     int lastLogFrequency = -1;
+    AsyncLogger::Level lastLogLevel = AsyncLogger::Level::INFO;
+    NetworkSpec lastNetworkSpec;
+    bool lastProfilingEnabled = false;
+    size_t lastTopK = 0;
+    OperatorProfiler::Metric lastMetric = OperatorProfiler::Metric::DELIVERIES;
     std::string lastSubmittedText;
+    TextStreamOptions lastTextStreamOptions;
+    std::vector<int> lastSamples; // submitted image/audio samples, widened to int
+    ChannelType lastChannel = ChannelType::TEXT;
+    size_t lastSamplesPerStep = 0;
+    bool lastPipelinedUpdates = false;
+    size_t lastPipelineThreshold = 0;
     bool stopRequested = false;
     int callCount = 0;
     
@@ -68,7 +96,16 @@ public:
         lastNumOperators = -1;
         lastNumSteps = -1;
         lastLogFrequency = -1;
+        lastProfilingEnabled = false;
+        lastTopK = 0;
+        lastMetric = OperatorProfiler::Metric::DELIVERIES;
         lastSubmittedText = "";
+        lastTextStreamOptions = TextStreamOptions();
+        lastSamples.clear();
+        lastChannel = ChannelType::TEXT;
+        lastSamplesPerStep = 0;
+        lastPipelinedUpdates = false;
+        lastPipelineThreshold = 0;
         stopRequested = false;
         callCount = 0;
         runPromise = std::promise<void>();
@@ -92,20 +129,22 @@ public:
         return true;
     }
 
-    void loadState(const std::string& filePath) override {
+    bool loadState(const std::string& filePath) override {
         std::lock_guard<std::mutex> lock(mockMutex);
         callCount++;
         lastCall = LastCall::LOAD_STATE;
         lastPath = filePath;
+        return true;
     }
     
-    void saveState(const std::string& filePath) const override {
+    bool saveState(const std::string& filePath) const override {
         std::lock_guard<std::mutex> lock(mockMutex);
         // We need to cast away constness to modify mock state in a const method.
         auto* nonConstThis = const_cast<MockSimulator*>(this);
         nonConstThis->callCount++;
         nonConstThis->lastCall = LastCall::SAVE_STATE;
         nonConstThis->lastPath = filePath;
+        return true;
     }
 
     void createNewNetwork(int numOperators) override {
@@ -161,6 +200,69 @@ public:
         lastSubmittedText = text;
     }
 
+    bool openTextStream(const std::string& filePath, const TextStreamOptions& options = TextStreamOptions()) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::OPEN_TEXT_STREAM;
+        lastPath = filePath;
+        lastTextStreamOptions = options;
+        return true;
+    }
+
+    void closeTextStream() override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::CLOSE_TEXT_STREAM;
+    }
+
+    bool getTextStreamStats(TextStreamStats& stats) const override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        auto* nonConstThis = const_cast<MockSimulator*>(this);
+        nonConstThis->callCount++;
+        nonConstThis->lastCall = LastCall::GET_TEXT_STREAM_STATS;
+        stats = TextStreamStats();
+        return true;
+    }
+
+    size_t submitImageFrame(const uint8_t* pixels, size_t count) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::SUBMIT_IMAGE_FRAME;
+        lastSamples.assign(pixels, pixels + count);
+        return count;
+    }
+
+    size_t submitAudioSamples(const int16_t* samples, size_t count) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::SUBMIT_AUDIO_SAMPLES;
+        lastSamples.assign(samples, samples + count);
+        return count;
+    }
+
+    bool setChannelInputRate(ChannelType channel, size_t samplesPerStep) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::SET_CHANNEL_INPUT_RATE;
+        lastChannel = channel;
+        lastSamplesPerStep = samplesPerStep;
+        return true;
+    }
+
+    size_t readImageOutput(uint8_t* pixels, size_t maxPixels) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::READ_IMAGE_OUTPUT;
+        return 0;
+    }
+
+    size_t readAudioOutput(int16_t* samples, size_t maxSamples) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::READ_AUDIO_OUTPUT;
+        return 0;
+    }
+
     std::string getOutput() override {
         std::lock_guard<std::mutex> lock(mockMutex);
         callCount++;
@@ -176,6 +278,73 @@ public:
         return {100, 5, 2, 50, 3};
     }
 
+    void resetStepStats() override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::RESET_STATS;
+    }
+
+    void startTrace() override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::START_TRACE;
+    }
+
+    bool stopTrace(const std::string& filePath) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::STOP_TRACE;
+        lastPath = filePath;
+        return true;
+    }
+
+    bool generateNetworkFile(const NetworkSpec& spec, const std::string& filePath, GeneratedNetworkInfo* info = nullptr) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::GENERATE_NETWORK;
+        lastNetworkSpec = spec;
+        lastPath = filePath;
+        return true;
+    }
+
+    void setLogLevel(AsyncLogger::Level level) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::SET_LOG_LEVEL;
+        lastLogLevel = level;
+    }
+
+    void setProfiling(bool enabled) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::SET_PROFILING;
+        lastProfilingEnabled = enabled;
+    }
+
+    void setPipelinedUpdates(bool enabled, size_t minConcurrentUpdates) override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::SET_PIPELINED_UPDATES;
+        lastPipelinedUpdates = enabled;
+        lastPipelineThreshold = minConcurrentUpdates;
+    }
+
+    void resetProfile() override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        callCount++;
+        lastCall = LastCall::RESET_PROFILE;
+    }
+
+    std::string getProfileReport(size_t topK, OperatorProfiler::Metric metric) const override {
+        std::lock_guard<std::mutex> lock(mockMutex);
+        auto* nonConstThis = const_cast<MockSimulator*>(this);
+        nonConstThis->callCount++;
+        nonConstThis->lastCall = LastCall::GET_PROFILE_REPORT;
+        nonConstThis->lastTopK = topK;
+        nonConstThis->lastMetric = metric;
+        return "[Mock Profile]\n";
+    }
+
     std::string getNetworkJson(bool prettyPrint = true) const override {
         std::lock_guard<std::mutex> lock(mockMutex);
         auto* nonConstThis = const_cast<MockSimulator*>(this);
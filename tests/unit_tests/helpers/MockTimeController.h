@@ -85,6 +85,12 @@ public:
         lastScheduledPayload = payload;
     }
 
+    void emplaceNextStepPayload(int messageData, uint32_t sourceOperatorId) override {
+        callCount++;
+        lastCall = LastCall::ADD_TO_NEXT_STEP;
+        lastScheduledPayload = Payload(messageData, sourceOperatorId);
+    }
+
     void deliverAndFlagOperator(uint32_t targetOperatorId, int messageData) override {
         callCount++;
         lastCall = LastCall::DELIVER_AND_FLAG;
@@ -128,7 +134,7 @@ public:
     }
 
    
-    std::unordered_set<uint32_t> baseLoadOperatorsToProcess(std::istream& in, uint64_t count){
+    OperatorIdSet baseLoadOperatorsToProcess(std::istream& in, uint64_t count){
         return TimeController::loadOperatorsToProcess(in, count);
     }
 
@@ -164,6 +170,31 @@ public:
         TimeController::addToNextStepPayloads(payload);
     }
 
+    void baseEmplaceNextStepPayload(int messageData, uint32_t sourceOperatorId) {
+        TimeController::emplaceNextStepPayload(messageData, sourceOperatorId);
+    }
+
+    void baseReserveNextStepPayloads(size_t additionalCount) {
+        TimeController::reserveNextStepPayloads(additionalCount);
+    }
+
+    size_t baseGetNextStepPayloadCount() const {
+        return TimeController::getNextStepPayloadCount();
+    }
+
+    size_t baseGetLastStepEmittedCount() const {
+        return TimeController::getLastStepEmittedCount();
+    }
+
+    StepSample baseGetLastStepSample() const {
+        return TimeController::getLastStepSample();
+    }
+
+    // capacity of the next step's payload list, used to verify reserve hints
+    size_t nextStepPayloadCapacity() const {
+        return nextStepPayloads.capacity();
+    }
+
     void baseDeliverAndFlagOperator(uint32_t targetOperatorId, int messageData) {
         TimeController::deliverAndFlagOperator(targetOperatorId, messageData);
     }